@@ -0,0 +1,141 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+// Compares as_json and as_json_view on a large document of
+// which only a few fields are read.
+//
+// Usage: boost_burl_bench_json_view [megabytes] [iterations]
+
+#include <boost/burl/json_view.hpp>
+#include <boost/json/parse.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+namespace burl = boost::burl;
+namespace json = boost::json;
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+// An API-style listing: many records, then the metadata
+// the caller actually wants
+std::string
+make_document(std::size_t size, std::size_t& count)
+{
+    std::string s = R"({"items":[)";
+    count = 0;
+    while(s.size() < size)
+    {
+        if(count)
+            s += ',';
+        auto const n = std::to_string(count);
+        s += R"({"id":)" + n +
+            R"(,"name":"item-)" + n +
+            R"(","score":)" + n + R"(.25,"active":)" +
+            (count % 3 ? "true" : "false") +
+            R"(,"tags":["alpha","beta","gamma"],"owner":{"login":"user)" +
+            n + R"(","url":"https:\/\/example.com\/users\/)" + n +
+            R"("},"note":"a \"quoted\" note with \\ escapes"})";
+        ++count;
+    }
+    s += R"(],"meta":{"total":)" + std::to_string(count) +
+        R"(,"next":"cursor-abc"}})";
+    return s;
+}
+
+double
+ms_since(clock_type::time_point t0)
+{
+    return std::chrono::duration<double, std::milli>(
+        clock_type::now() - t0).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::size_t const mb = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 5;
+    int const iterations = argc > 2 ? std::atoi(argv[2]) : 20;
+    if(mb == 0 || mb > 4000 || iterations <= 0)
+    {
+        std::fprintf(stderr,
+            "usage: %s [megabytes 1-4000] [iterations > 0]\n", argv[0]);
+        return 2;
+    }
+
+    std::size_t count = 0;
+    std::string const doc = make_document(mb * 1024 * 1024, count);
+    std::string const last = "/items/" + std::to_string(count - 1) + "/id";
+    std::string const mid = "/items/" + std::to_string(count / 2) + "/owner/login";
+
+    std::printf("document: %zu bytes, %zu items, %d iterations\n",
+        doc.size(), count, iterations);
+
+    // as_json: parse everything, then look up
+    double dom_ms = 0;
+    std::int64_t dom_sum = 0;
+    for(int i = 0; i < iterations; ++i)
+    {
+        auto const t0 = clock_type::now();
+        json::value const jv = json::parse(doc);
+        dom_sum += jv.at_pointer("/meta/total").as_int64();
+        dom_sum += jv.at_pointer(last).as_int64();
+        dom_sum += static_cast<std::int64_t>(
+            jv.at_pointer(mid).as_string().size());
+        dom_ms += ms_since(t0);
+    }
+
+    // as_json_view: index, then parse only what is read. The
+    // copy stands in for the body the session would move in
+    double view_ms = 0;
+    std::int64_t view_sum = 0;
+    for(int i = 0; i < iterations; ++i)
+    {
+        std::string body = doc;
+        auto const t0 = clock_type::now();
+        burl::json_view const v(std::move(body));
+        auto const total = v.at_pointer("/meta/total");
+        auto const id = v.at_pointer(last);
+        auto const login = v.at_pointer(mid);
+        if(!total || !id || !login)
+        {
+            std::printf("lookup failed\n");
+            return 1;
+        }
+        view_sum += total->get_int64().value_or(0);
+        view_sum += id->get_int64().value_or(0);
+        view_sum += static_cast<std::int64_t>(
+            login->get_string().value_or("").size());
+        view_ms += ms_since(t0);
+    }
+
+    if(dom_sum != view_sum)
+    {
+        std::printf("results differ: %lld vs %lld\n",
+            static_cast<long long>(dom_sum),
+            static_cast<long long>(view_sum));
+        return 1;
+    }
+
+    double const mbytes = static_cast<double>(doc.size()) / (1024 * 1024);
+    auto report = [&](char const* name, double total_ms)
+    {
+        double const per = total_ms / iterations;
+        std::printf("%-14s %9.3f ms/doc %9.1f MB/s\n",
+            name, per, mbytes / (per / 1000));
+    };
+    report("as_json", dom_ms);
+    report("as_json_view", view_ms);
+    std::printf("speedup: %.2fx\n", dom_ms / view_ms);
+    return 0;
+}
@@ -51,7 +51,22 @@ Options:
   -I, --head               Fetch headers only
   -m, --max-time <secs>    Maximum time for request
       --connect-timeout <secs>  Connection timeout
+      --expect100-timeout <secs>  How long to wait for 100-continue
       --max-redirs <num>   Maximum redirects
+      --limit-rate <speed> Limit transfer speed to RATE
+      --rate <N/U>         Request rate for serial transfers
+      --tcp-nodelay        Use TCP_NODELAY (default)
+      --tcp-fastopen       Use TCP Fast Open
+      --keepalive-time <secs>  Interval for keepalive probing
+      --keepalive-cnt <num>  Maximum number of keepalive probes
+      --no-keepalive       Disable TCP keepalive on the connection
+      --interface <name>   Use network interface or address (several: a,b)
+      --local-port <num/range>  Force use of RANGE for local port numbers
+      --resolve <host:port:addr[,addr]...>  Resolve host+port to address
+      --connect-to <HOST1:PORT1:HOST2:PORT2>  Connect to host2 instead
+      --warm-state <file>  Reuse DNS, TLS sessions and cookies across runs
+      --hsts <file>        Enable HSTS with this cache file
+      --alt-svc <file>     Enable alt-svc with this cache file
       --compressed         Request compressed response
       --cacert <file>      CA certificate file
       --cert <file>        Client certificate
@@ -284,18 +299,75 @@ int main(int argc, char** argv)
 
     // Configure session from args
     if(args.user_agent.has_value())
-        sess.headers().set(http::field::user_agent, args.user_agent.value());
+        sess.headers()->set(http::field::user_agent, args.user_agent.value());
     else
-        sess.headers().set(http::field::user_agent, version_string);
+        sess.headers()->set(http::field::user_agent, version_string);
 
     if(args.referer.has_value())
-        sess.headers().set(http::field::referer, args.referer.value());
+        sess.headers()->set(http::field::referer, args.referer.value());
 
     if(args.follow_redirects)
         sess.set_max_redirects(args.max_redirs);
     else
         sess.set_max_redirects(0);
 
+    if(args.expect100_timeout.has_value())
+        sess.set_expect_continue(burl::expect_continue{
+            burl::expect_continue{}.threshold,
+            std::chrono::milliseconds(static_cast<std::int64_t>(
+                args.expect100_timeout.value() * 1000))});
+
+    if(args.limit_rate.has_value())
+        sess.set_limit_rate(burl::bandwidth_limit{
+            args.limit_rate.value(),
+            args.limit_rate.value()});
+
+    if(args.rate.has_value())
+        sess.set_request_rate(burl::request_rate{
+            args.rate.value(),
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                args.rate_period)});
+
+    burl::socket_options sock_opts;
+    sock_opts.tcp_nodelay = args.tcp_nodelay;
+    sock_opts.tcp_fastopen = args.tcp_fastopen;
+    sock_opts.keepalive = !args.no_keepalive;
+    if(args.keepalive_time.has_value())
+    {
+        // curl uses the same value for idle time and interval
+        sock_opts.keepalive_idle =
+            std::chrono::seconds(args.keepalive_time.value());
+        sock_opts.keepalive_interval = sock_opts.keepalive_idle;
+    }
+    if(args.keepalive_cnt.has_value())
+        sock_opts.keepalive_count = args.keepalive_cnt.value();
+    sess.set_socket_options(sock_opts);
+
+    if(!args.interfaces.empty() || args.local_port.has_value())
+        sess.set_source_binding(burl::source_binding{
+            args.interfaces,
+            args.local_port.value_or(0),
+            args.local_port_last.value_or(0)});
+
+    for(auto const& r : args.resolve)
+        sess.add_resolve_override(r);
+    for(auto const& c : args.connect_to)
+        sess.add_connect_override(c);
+
+    // A missing or stale file just means a cold start
+    if(args.warm_state.has_value())
+        (void)sess.load_state(args.warm_state.value());
+    if(args.hsts.has_value())
+    {
+        (void)sess.load_hsts(args.hsts.value());
+        sess.set_hsts(true);
+    }
+    if(args.alt_svc.has_value())
+    {
+        (void)sess.load_alt_svc(args.alt_svc.value());
+        sess.set_alt_svc(true);
+    }
+
     // Run the request
     int exit_code = 0;
     capy::run_async(ioc.get_executor())(
@@ -307,5 +379,24 @@ int main(int argc, char** argv)
 
     ioc.run();
 
+    if(args.warm_state.has_value())
+    {
+        auto ec = sess.save_state(args.warm_state.value());
+        if(ec && !args.silent)
+            std::cerr << "burl: --warm-state: " << ec.message() << '\n';
+    }
+    if(args.hsts.has_value())
+    {
+        auto ec = sess.save_hsts(args.hsts.value());
+        if(ec && !args.silent)
+            std::cerr << "burl: --hsts: " << ec.message() << '\n';
+    }
+    if(args.alt_svc.has_value())
+    {
+        auto ec = sess.save_alt_svc(args.alt_svc.value());
+        if(ec && !args.silent)
+            std::cerr << "burl: --alt-svc: " << ec.message() << '\n';
+    }
+
     return exit_code;
 }
@@ -17,6 +17,7 @@
 
 #include <iostream>
 #include <thread>
+#include <utility>
 #include <vector>
 
 namespace burl = boost::burl;
@@ -205,8 +206,9 @@ capy::io_task<> example_session_cookies(burl::session& s)
         co_return ec1;
     
     // Check cookies in the session's jar
-    std::cout << "Cookies in jar: " << s.cookies().size() << "\n";
-    for (auto const& c : s.cookies()) {
+    auto const& jar = std::as_const(s).cookies();
+    std::cout << "Cookies in jar: " << jar.size() << "\n";
+    for (auto const& c : jar) {
         std::cout << "  " << c.name << " = " << c.value << "\n";
     }
     
@@ -230,8 +232,8 @@ capy::io_task<> example_session_cookies(burl::session& s)
 capy::io_task<> example_session_defaults(burl::session& s)
 {
     // Set headers that apply to all requests from this session
-    s.headers().set(http::field::authorization, "Bearer mytoken");
-    s.headers().set("X-Api-Version", "2.0");
+    s.headers()->set(http::field::authorization, "Bearer mytoken");
+    s.headers()->set("X-Api-Version", "2.0");
     
     // All requests include these headers automatically
     auto [ec1, r1] = co_await s.get("https://api.example.com/resource1");
@@ -733,7 +735,7 @@ void example_basic_session()
     burl::session s(ioc, tls_ctx);
     
     // Configure session defaults
-    s.headers().set(http::field::user_agent, "MyApp/1.0");
+    s.headers()->set(http::field::user_agent, "MyApp/1.0");
     s.set_timeout(std::chrono::milliseconds{30000});
     
     // Launch work and run
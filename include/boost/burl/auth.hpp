@@ -13,14 +13,39 @@
 #include <boost/burl/fwd.hpp>
 #include <boost/http/request.hpp>
 
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 
 namespace boost {
 namespace burl {
 
 //----------------------------------------------------------
 
+/** What a scheme may need to know about the request it signs.
+
+    Passed to @ref auth_base::apply once the request is
+    otherwise complete, so a signature can cover its final
+    headers and body.
+*/
+struct auth_context
+{
+    /// Hex SHA-256 of the body; empty unless the scheme's
+    /// needs_payload_hash() returned true and the body is
+    /// held in memory
+    std::string_view payload_hash;
+
+    /// The time to sign the request at
+    std::chrono::system_clock::time_point now =
+        std::chrono::system_clock::now();
+};
+
+//----------------------------------------------------------
+
 /** Base class for HTTP authentication schemes.
 
     Derive from this class to implement custom authentication
@@ -45,6 +70,34 @@ public:
     virtual void
     apply(http::request& req) const = 0;
 
+    /** Apply authentication to a complete request.
+
+        The session calls this overload after every other
+        header, and the body, are in place. The default calls
+        `apply(req)`; schemes which sign the request override
+        it.
+
+        @param req The request to authenticate
+        @param ctx The body hash and signing time
+    */
+    virtual void
+    apply(http::request& req, auth_context const& ctx) const
+    {
+        (void)ctx;
+        apply(req);
+    }
+
+    /** Return true if apply needs the body's SHA-256.
+
+        The session only hashes the body for schemes which
+        return true.
+    */
+    virtual bool
+    needs_payload_hash() const noexcept
+    {
+        return false;
+    }
+
     /** Clone this authentication object.
 
         @return A new instance with the same credentials
@@ -93,6 +146,8 @@ public:
     void
     apply(http::request& req) const override;
 
+    using auth_base::apply;
+
     /** Clone this authentication object.
     */
     std::unique_ptr<auth_base>
@@ -150,6 +205,8 @@ public:
     void
     apply(http::request& req) const override;
 
+    using auth_base::apply;
+
     /** Clone this authentication object.
     */
     std::unique_ptr<auth_base>
@@ -200,10 +257,152 @@ public:
     void
     apply(http::request& req) const override;
 
+    using auth_base::apply;
+
+    /** Clone this authentication object.
+    */
+    std::unique_ptr<auth_base>
+    clone() const override;
+};
+
+//----------------------------------------------------------
+
+/** AWS Signature Version 4 request signing.
+
+    Signs requests for S3 and S3-compatible object stores, or
+    any other service which accepts SigV4. The signature
+    covers the method, path, query, every header except a
+    few which proxies may change, and the body's SHA-256,
+    which the session computes for this scheme. A request
+    signed without it, through `apply(req)`, is sent as
+    `UNSIGNED-PAYLOAD`.
+
+    The signing key depends only on the day, region and
+    service, so the four HMACs deriving it run once a day;
+    the key cache is shared with clones. Canonical requests
+    are built in buffers reused across requests.
+
+    @par Example
+    @code
+    burl::session s;
+    s.set_auth(std::make_shared<burl::aws_sigv4_auth>(
+        access_key, secret_key, "us-east-1"));
+    auto [ec, r] = co_await s.get(
+        urls::url_view("https://bucket.s3.amazonaws.com/key"));
+    @endcode
+*/
+class aws_sigv4_auth : public auth_base
+{
+    struct state;
+
+    std::string access_key_;
+    std::string secret_key_;
+    std::string region_;
+    std::string service_;
+    std::string session_token_;
+    std::shared_ptr<state> state_;
+
+public:
+    /** Signs the chunks of a streamed upload.
+
+        Returned by @ref aws_sigv4_auth::apply_streaming. Each
+        chunk's signature chains from the one before, starting
+        with the request's. Send, for every chunk in order,
+        `chunk_header(data)`, the data, and "\r\n"; then
+        `chunk_header({})` and "\r\n" to end the body.
+    */
+    class chunk_signer
+    {
+        friend class aws_sigv4_auth;
+
+        std::array<unsigned char, 32> key_;
+        std::string amz_date_;
+        std::string scope_;
+        std::string previous_;
+        std::string sts_;
+
+    public:
+        /** Return the line to send before a chunk.
+
+            This is the chunk's size in hex and its signature,
+            ending in CRLF.
+        */
+        std::string
+        chunk_header(std::string_view data);
+    };
+
+    /** Constructor.
+
+        @param access_key The access key ID
+        @param secret_key The secret access key
+        @param region The region, such as "us-east-1"
+        @param service The service; "s3" paths are signed as
+            sent, other services' are encoded again
+        @param session_token Temporary credentials' token,
+            sent as x-amz-security-token, if any
+    */
+    aws_sigv4_auth(
+        std::string access_key,
+        std::string secret_key,
+        std::string region,
+        std::string service = "s3",
+        std::string session_token = {});
+
+    /** Sign a request without a body hash.
+
+        The payload is signed as `UNSIGNED-PAYLOAD`, which S3
+        accepts over HTTPS.
+    */
+    void
+    apply(http::request& req) const override;
+
+    /** Sign a complete request.
+
+        Sets x-amz-date, x-amz-content-sha256, the security
+        token if any, and Authorization.
+    */
+    void
+    apply(http::request& req, auth_context const& ctx) const override;
+
+    /** Return true; the signature covers the body.
+    */
+    bool
+    needs_payload_hash() const noexcept override;
+
+    /** Sign a request whose body is streamed in chunks.
+
+        Sets Content-Encoding: aws-chunked, the decoded and
+        encoded lengths, and the seed signature.
+
+        @param req The request, without its body
+        @param length The body's size before chunk framing
+        @param chunk_size The size of every chunk but the
+            last; S3 wants at least 8 KiB
+        @param now The time to sign at
+
+        @return The signer for the body's chunks
+    */
+    chunk_signer
+    apply_streaming(
+        http::request& req,
+        std::uint64_t length,
+        std::size_t chunk_size = 65536,
+        std::chrono::system_clock::time_point now =
+            std::chrono::system_clock::now()) const;
+
     /** Clone this authentication object.
+
+        The clone shares the signing key cache.
     */
     std::unique_ptr<auth_base>
     clone() const override;
+
+private:
+    std::string
+    sign(
+        http::request& req,
+        std::string_view payload_hash,
+        std::string const& amz_date) const;
 };
 
 } // namespace burl
@@ -66,6 +66,32 @@ inline constexpr as_json_t as_json{};
 
 //----------------------------------------------------------
 
+/** Tag type for requesting body as a lazy JSON view.
+
+    When passed to session request methods, indicates the
+    response body should be indexed into a json_view, which
+    parses only the values that are looked up.
+
+    @see as_json_view, json_view
+*/
+struct as_json_view_t
+{
+    explicit constexpr as_json_view_t() = default;
+};
+
+/** Tag value for requesting body as a lazy JSON view.
+
+    @par Example
+    @code
+    auto [ec, r] = co_await session.get(url, burl::as_json_view);
+    // r.body is json_view
+    auto id = r.body.at_pointer("/items/0/id");
+    @endcode
+*/
+inline constexpr as_json_view_t as_json_view{};
+
+//----------------------------------------------------------
+
 /** Tag type for requesting body as a custom type.
 
     When passed to session request methods, indicates the
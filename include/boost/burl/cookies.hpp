@@ -86,17 +86,17 @@ struct cookie
     @par Example
     @code
     burl::session s;
-    auto& jar = s.cookies();
+    auto jar = s.cookies();
     
     // Add a cookie manually
-    jar.set(burl::cookie{
+    jar->set(burl::cookie{
         .name = "session_id",
         .value = "abc123",
         .domain = "example.com"
     });
     
     // Get all cookies for a URL
-    auto cookies = jar.get_cookies(url);
+    auto cookies = jar->get_cookies(url);
     @endcode
 */
 class cookie_jar
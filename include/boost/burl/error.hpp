@@ -61,6 +61,27 @@ enum class error
     /// Operation cancelled
     cancelled,
 
+    /// Request deadline passed or can no longer be met
+    deadline_exceeded,
+
+    /// Request shed because the origin's queue is full
+    overloaded,
+
+    /// Request refused because the origin's circuit is open
+    circuit_open,
+
+    /// Request refused because the session is shutting down
+    session_closed,
+
+    /// Server did not accept the WebSocket upgrade
+    websocket_handshake_failed,
+
+    /// WebSocket peer broke the protocol
+    websocket_protocol_error,
+
+    /// Response body did not match its expected digest
+    digest_mismatch,
+
     /// Operation not yet implemented
     not_implemented
 };
@@ -199,6 +220,13 @@ error_category::message(int ev) const
     case error::invalid_response:   return "invalid HTTP response";
     case error::connection_closed:  return "connection closed";
     case error::cancelled:          return "operation cancelled";
+    case error::deadline_exceeded:  return "deadline exceeded";
+    case error::overloaded:         return "request shed: origin overloaded";
+    case error::circuit_open:       return "circuit open: origin failing";
+    case error::session_closed:     return "session closed";
+    case error::websocket_handshake_failed: return "WebSocket handshake failed";
+    case error::websocket_protocol_error: return "WebSocket protocol error";
+    case error::digest_mismatch:    return "body digest mismatch";
     case error::not_implemented:    return "not implemented";
     default:                        return "unknown error";
     }
@@ -28,6 +28,8 @@ namespace burl {
 //----------------------------------------------------------
 
 class session;
+class json_view;
+class share;
 
 template<class Body = std::string>
 struct response;
@@ -35,12 +37,33 @@ struct response;
 struct streamed_response;
 struct streamed_request;
 
+class paginator;
+
+struct websocket_message;
+class websocket_stream;
+
 //----------------------------------------------------------
 // Configuration types
 //----------------------------------------------------------
 
+struct adaptive_concurrency;
+struct bandwidth_limit;
+struct circuit_breaker_config;
+struct connect_override;
+enum class digest_algorithm;
+struct digest_check;
+struct expect_continue;
+struct load_balancing;
+struct paginate_options;
+struct pool_options;
+enum class request_priority;
 struct request_options;
+struct request_rate;
+struct resolve_override;
+struct socket_options;
+struct source_binding;
 struct verify_config;
+struct websocket_options;
 
 //----------------------------------------------------------
 // Body tag types
@@ -48,6 +71,7 @@ struct verify_config;
 
 struct as_string_t;
 struct as_json_t;
+struct as_json_view_t;
 
 template<class T>
 struct as_type_t;
@@ -64,6 +88,8 @@ class cookie_jar;
 //----------------------------------------------------------
 
 class auth_base;
+struct auth_context;
+class aws_sigv4_auth;
 class http_basic_auth;
 class http_digest_auth;
 
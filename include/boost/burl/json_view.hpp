@@ -0,0 +1,216 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_JSON_VIEW_HPP
+#define BOOST_BURL_JSON_VIEW_HPP
+
+#include <boost/burl/fwd.hpp>
+#include <boost/json/value.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace boost {
+namespace burl {
+
+//----------------------------------------------------------
+
+/** A JSON document read on demand.
+
+    The body is kept as received. Constructing the view scans
+    it once, with SIMD compares where the CPU has them, to
+    record where every token starts and which brackets pair
+    up; no values are parsed and no DOM is built. A lookup
+    then steps over whole arrays and objects in one move and
+    parses only the keys and values on its path.
+
+    For a large document of which a few fields are read, this
+    costs a fraction of `as_json`'s time and memory. When most
+    of a document is used, `as_json` is the better choice.
+
+    Only the structure the scan needs is checked up front;
+    malformed JSON elsewhere shows as a failed lookup when it
+    is reached. Elements refer into the view and must not
+    outlive it; copies of a view share the same document.
+
+    @par Example
+    @code
+    auto [ec, r] = co_await s.get(url, burl::as_json_view);
+    auto total = r.body.at_pointer("/meta/total");
+    if(total)
+        std::cout << total->get_int64().value_or(0);
+    @endcode
+
+    @see as_json_view
+*/
+class json_view
+{
+    struct impl;
+    std::shared_ptr<impl const> impl_;
+
+public:
+    /// The kind of a JSON value
+    enum class value_kind
+    {
+        null,
+        boolean,
+        number,
+        string,
+        array,
+        object
+    };
+
+    /** A value within the document.
+    */
+    class element
+    {
+        friend class json_view;
+
+        impl const* v_ = nullptr;
+        std::uint32_t tok_ = 0;
+
+        element(impl const* v, std::uint32_t tok) noexcept
+            : v_(v)
+            , tok_(tok)
+        {
+        }
+
+    public:
+        /// Constructor; a default element refers to nothing
+        element() = default;
+
+        /// Return the kind of the value
+        value_kind
+        kind() const noexcept;
+
+        /** Return the value of an object's member.
+
+            Members before it are skipped without being
+            parsed; those after it are not looked at.
+
+            @return std::nullopt if this is not an object, it
+                has no such member, or it is malformed
+        */
+        std::optional<element>
+        find(std::string_view key) const;
+
+        /** Return an array's element.
+
+            @return std::nullopt if this is not an array, the
+                index is out of range, or it is malformed
+        */
+        std::optional<element>
+        at(std::size_t i) const;
+
+        /** Return the number of elements or members.
+
+            This walks the container, but not its values.
+            It is zero for anything else.
+        */
+        std::size_t
+        size() const;
+
+        /// Return the string, unescaped, if this is one
+        std::optional<std::string>
+        get_string() const;
+
+        /// Return the number if it is an integer in range
+        std::optional<std::int64_t>
+        get_int64() const;
+
+        /// Return the number if it is a non-negative integer in range
+        std::optional<std::uint64_t>
+        get_uint64() const;
+
+        /// Return the number, if this is one
+        std::optional<double>
+        get_double() const;
+
+        /// Return the boolean, if this is one
+        std::optional<bool>
+        get_bool() const;
+
+        /// Return true if this is null
+        bool
+        is_null() const noexcept;
+
+        /** Return the value's text as it appears in the body.
+
+            For a string this includes the quotes; for an
+            array or object, everything up to the closing
+            bracket.
+        */
+        std::string_view
+        raw() const noexcept;
+
+        /** Parse this value, and only this one, into a DOM.
+
+            @return std::nullopt if the text is not valid JSON
+        */
+        std::optional<json::value>
+        to_value() const;
+    };
+
+    /** Constructor.
+
+        A default constructed view is not valid.
+    */
+    json_view() noexcept;
+
+    /** Constructor.
+
+        Takes the body and indexes it.
+
+        @param data The JSON text
+    */
+    explicit
+    json_view(std::string data);
+
+    /** Return true if the body could be indexed.
+
+        This is false for an unterminated string, unbalanced
+        brackets, or anything other than one value at the top
+        level.
+    */
+    bool
+    valid() const noexcept;
+
+    /** Return the JSON text.
+    */
+    std::string const&
+    data() const noexcept;
+
+    /** Return the top-level value.
+
+        @par Preconditions
+        `valid()`
+    */
+    element
+    root() const noexcept;
+
+    /** Return the value a JSON Pointer (RFC 6901) refers to.
+
+        @param ptr A pointer such as "/items/0/id"; the empty
+            string is the whole document
+
+        @return std::nullopt if the view is not valid or
+            nothing is at the pointer
+    */
+    std::optional<element>
+    at_pointer(std::string_view ptr) const;
+};
+
+} // namespace burl
+} // namespace boost
+
+#endif
@@ -14,8 +14,13 @@
 #include <boost/http/fields.hpp>
 
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <optional>
+#include <stop_token>
 #include <string>
+#include <vector>
 
 namespace boost {
 namespace burl {
@@ -41,6 +46,408 @@ struct verify_config
 
 //----------------------------------------------------------
 
+/** Bandwidth limits for request and response bodies.
+
+    Limits are enforced with token buckets. A value of zero
+    means the direction is not limited.
+*/
+struct bandwidth_limit
+{
+    /// Maximum upload rate in bytes per second
+    std::uint64_t upload = 0;
+
+    /// Maximum download rate in bytes per second
+    std::uint64_t download = 0;
+};
+
+//----------------------------------------------------------
+
+/** A limit on how often requests may start.
+
+    At most `count` requests are started per `interval`,
+    spaced evenly. Requests over the limit are suspended
+    until admitted rather than failed.
+*/
+struct request_rate
+{
+    /// Requests allowed per interval (0 = unlimited)
+    std::uint64_t count = 0;
+
+    /// Length of the interval
+    std::chrono::milliseconds interval{1000};
+
+    /// Requests which may start back-to-back after an idle period
+    std::uint64_t burst = 1;
+};
+
+//----------------------------------------------------------
+
+/** Configuration for adaptive per-origin concurrency limits.
+
+    When enabled, the session measures the round trip time and
+    failure rate of requests to each origin and raises or lowers
+    that origin's concurrency limit to match what it can serve.
+    Requests beyond the limit are queued, and shed once the
+    queue is full.
+*/
+struct adaptive_concurrency
+{
+    /// Limit algorithm
+    enum class algorithm
+    {
+        /// Additive increase, multiplicative decrease on failure
+        aimd,
+
+        /// Shrink as RTT rises above its long-term average
+        gradient
+    };
+
+    /// The algorithm to use
+    algorithm algo = algorithm::gradient;
+
+    /// Limit for an origin with no samples yet
+    std::size_t initial_limit = 20;
+
+    /// Lowest limit
+    std::size_t min_limit = 1;
+
+    /// Highest limit
+    std::size_t max_limit = 200;
+
+    /// Factor applied to the limit on failure (AIMD)
+    double backoff_ratio = 0.9;
+
+    /// RTT increase tolerated before shrinking (gradient)
+    double rtt_tolerance = 1.5;
+
+    /// Weight of each new limit estimate (gradient)
+    double smoothing = 0.2;
+
+    /// Requests queued per origin before new ones are shed (0 = unbounded)
+    std::size_t max_queue = 0;
+};
+
+//----------------------------------------------------------
+
+/** Configuration for per-origin circuit breakers.
+
+    The session tracks the outcome of recent requests to each
+    origin. When enough of them fail, the origin's circuit
+    opens and further requests fail at once with
+    @ref error::circuit_open instead of waiting on a dead
+    server. After `open_duration` a few probe requests are let
+    through; if they succeed the circuit closes, otherwise it
+    opens again.
+
+    Connection failures, timeouts and 5xx responses count as
+    failures.
+*/
+struct circuit_breaker_config
+{
+    /// Fraction of failed requests which opens the circuit
+    double failure_ratio = 0.5;
+
+    /// Requests needed in the window before the ratio applies
+    std::size_t minimum_requests = 20;
+
+    /// Span of recent history the ratio is computed over
+    std::chrono::milliseconds window{10000};
+
+    /// Time the circuit stays open before probing
+    std::chrono::milliseconds open_duration{5000};
+
+    /// Concurrent probes allowed, all of which must succeed
+    std::size_t half_open_probes = 1;
+};
+
+//----------------------------------------------------------
+
+/** Configuration for balancing requests across addresses.
+
+    When a host name resolves to several addresses, each one
+    is treated as a separate endpoint with its own connections.
+    New connections go to the endpoint chosen by `policy`.
+
+    An endpoint is ejected for a while when it fails
+    `consecutive_failures` times in a row, or when its average
+    latency exceeds `latency_ratio` times the median of its
+    peers. Each further ejection lasts longer, up to
+    `max_ejection_time`. No more than `max_ejection_percent`
+    of a host's endpoints are ejected at once.
+*/
+struct load_balancing
+{
+    /// How an endpoint is chosen
+    enum class policy
+    {
+        /// The endpoint with the fewest requests in flight
+        least_outstanding,
+
+        /// The better of two endpoints picked at random
+        power_of_two
+    };
+
+    /// The policy to use
+    policy algo = policy::power_of_two;
+
+    /// Failures in a row which eject an endpoint (0 = never)
+    std::size_t consecutive_failures = 5;
+
+    /// Latency relative to the median which ejects an endpoint (0 = never)
+    double latency_ratio = 3.0;
+
+    /// Requests an endpoint must complete before its latency is judged
+    std::size_t minimum_requests = 10;
+
+    /// Length of the first ejection
+    std::chrono::milliseconds base_ejection_time{30000};
+
+    /// Longest ejection
+    std::chrono::milliseconds max_ejection_time{300000};
+
+    /// Largest share of endpoints ejected at once, in percent
+    unsigned max_ejection_percent = 50;
+};
+
+//----------------------------------------------------------
+
+/** Options applied to each new TCP socket.
+
+    Options which the platform does not support are skipped.
+    TCP Fast Open and deferred port binding are hints; if the
+    system refuses them the connection proceeds without.
+*/
+struct socket_options
+{
+    /// Disable Nagle's algorithm (TCP_NODELAY)
+    bool tcp_nodelay = true;
+
+    /// Send request data with the SYN when possible (TCP Fast Open)
+    bool tcp_fastopen = false;
+
+    /// Probe idle connections so dead peers are noticed (SO_KEEPALIVE)
+    bool keepalive = true;
+
+    /// Idle time before the first keepalive probe
+    std::chrono::seconds keepalive_idle{60};
+
+    /// Time between keepalive probes
+    std::chrono::seconds keepalive_interval{60};
+
+    /// Unanswered probes before the connection drops (0 = system default)
+    unsigned keepalive_count = 0;
+
+    /// Receive buffer size in bytes (SO_RCVBUF, 0 = system default)
+    std::size_t receive_buffer = 0;
+
+    /// Send buffer size in bytes (SO_SNDBUF, 0 = system default)
+    std::size_t send_buffer = 0;
+
+    /// Choose the local port at connect, not bind (IP_BIND_ADDRESS_NO_PORT)
+    bool bind_address_no_port = true;
+};
+
+//----------------------------------------------------------
+
+/** Local addresses and ports for outgoing connections.
+
+    Equivalent to curl's `--interface` and `--local-port`.
+    When several addresses are given, new connections take
+    those of the server address's family in turn; a server
+    address no source shares a family with is skipped. Each
+    local address has its own range of ephemeral ports, so
+    spreading connections to one server over several
+    addresses multiplies how many can be open.
+*/
+struct source_binding
+{
+    /// Local addresses or interface names (empty = any)
+    std::vector<std::string> addresses;
+
+    /// First local port to try (0 = any)
+    std::uint16_t first_port = 0;
+
+    /// Last local port to try (0 = only first_port)
+    std::uint16_t last_port = 0;
+};
+
+//----------------------------------------------------------
+
+/** Housekeeping of pooled connections.
+
+    A background task owned by the session closes idle
+    connections past their timeout, retires connections which
+    reach their maximum age, and opens connections so that each
+    origin keeps a minimum number idle. None of this runs on
+    the request path.
+
+    Ages and run times are spread at random by `jitter`, and
+    new connections are paced by `connect_rate`, so that
+    connections opened together are not all replaced together.
+*/
+struct pool_options
+{
+    /// How long an idle connection is kept
+    std::chrono::milliseconds idle_timeout{60000};
+
+    /// Retire connections this old once idle (0 = no limit)
+    std::chrono::milliseconds max_age{0};
+
+    /// Idle connections to keep open per origin
+    std::size_t min_idle = 0;
+
+    /// How often the task runs
+    std::chrono::milliseconds interval{1000};
+
+    /// Random spread of ages and intervals, as a fraction
+    double jitter = 0.1;
+
+    /// Connections the task may open per second (0 = unlimited)
+    std::uint64_t connect_rate = 10;
+};
+
+//----------------------------------------------------------
+
+/** When to send request bodies only on 100 Continue.
+
+    Requests with a body of at least `threshold` bytes, or of
+    unknown length, are sent with `Expect: 100-continue`. The
+    body is held back until the server answers 100 Continue,
+    or for at most `timeout`. If the server refuses the
+    request first, for instance with 401 or 413, the body is
+    never sent.
+*/
+struct expect_continue
+{
+    /// Smallest body sent with the expectation, in bytes
+    std::uint64_t threshold = 1048576;
+
+    /// How long to wait for 100 Continue before sending anyway
+    std::chrono::milliseconds timeout{1000};
+};
+
+//----------------------------------------------------------
+
+/** Options for a WebSocket connection.
+
+    The upgrade request itself is built like any other
+    request of the session, with its default headers, cookies
+    and authentication.
+*/
+struct websocket_options
+{
+    /// Subprotocols to offer, in order of preference
+    std::vector<std::string> protocols;
+
+    /// Offer permessage-deflate compression (needs zlib)
+    bool permessage_deflate = true;
+
+    /// Messages smaller than this are sent uncompressed
+    std::size_t compress_threshold = 64;
+
+    /// Largest frame payload sent (0 = one frame per message)
+    std::size_t fragment_size = 16384;
+
+    /// Largest message received, after decompression
+    std::size_t max_message_size = 16 * 1024 * 1024;
+
+    /// Send a ping after this long without traffic (0 = never)
+    std::chrono::milliseconds ping_interval{0};
+
+    /// Additional headers for the upgrade request
+    std::optional<http::fields> headers;
+};
+
+//----------------------------------------------------------
+
+/** Algorithms a response body can be checked with.
+*/
+enum class digest_algorithm
+{
+    /// SHA-256
+    sha256,
+
+    /// MD5, for servers which only send Content-MD5
+    md5,
+
+    /// CRC-32C, as cloud object stores report it
+    crc32c
+};
+
+/** Verify a response body against a digest.
+
+    The digest is computed as the body arrives, over the bytes
+    as sent, before any Content-Encoding is undone, so the
+    body is never read twice. It is compared with `expected`,
+    if set, and with every value for the same algorithm in the
+    `Content-Digest`, `Repr-Digest`, `Digest`, `Content-MD5`
+    and `x-goog-hash` response headers. Any difference fails
+    the request with @ref error::digest_mismatch.
+
+    SHA-256 uses the CPU's SHA extensions through OpenSSL, and
+    CRC-32C its CRC instructions, where available.
+*/
+struct digest_check
+{
+    /// The algorithm
+    digest_algorithm algorithm = digest_algorithm::sha256;
+
+    /// Expected digest in hex, as sha256sum prints it; empty
+    /// to rely on the response headers
+    std::string expected;
+
+    /// Fail when there is nothing to compare against
+    bool required = true;
+};
+
+//----------------------------------------------------------
+
+/** Options for paging through a collection.
+
+    By default the next page is the target of the response's
+    `Link` header with `rel="next"` (RFC 8288), as GitHub and
+    many other APIs send. For APIs which put a cursor in the
+    JSON body instead, set `cursor_pointer`.
+*/
+struct paginate_options
+{
+    /// Pages fetched ahead of the caller (0 = only on demand)
+    std::size_t lookahead = 1;
+
+    /// Stop after this many pages (0 = no limit)
+    std::size_t max_pages = 0;
+
+    /// JSON pointer (RFC 6901) to the next cursor in the body,
+    /// such as "/meta/next_cursor"; empty to follow Link headers
+    std::string cursor_pointer;
+
+    /// Query parameter the cursor is sent in; if empty, the
+    /// value at `cursor_pointer` is the next page's URL
+    std::string cursor_param;
+};
+
+//----------------------------------------------------------
+
+/** Scheduling priority of a request.
+
+    When the session limits concurrency, queued requests of a
+    higher priority are started before those of a lower one,
+    whatever their origin or arrival order.
+*/
+enum class request_priority
+{
+    /// Batch or background work
+    low,
+
+    /// The default
+    normal,
+
+    /// Latency-sensitive, interactive work
+    high
+};
+
+//----------------------------------------------------------
+
 /** Options for individual HTTP requests.
 
     These options override session defaults for a single request.
@@ -70,6 +477,24 @@ struct request_options
 
     /// Authentication to use for this request
     std::shared_ptr<auth_base> auth;
+
+    /// Bandwidth limit for this request (applied in addition to the session limit)
+    std::optional<bandwidth_limit> limit_rate;
+
+    /// Verify the response body against a digest
+    std::optional<digest_check> digest;
+
+    /// Scheduling priority when the request must queue (default: normal)
+    std::optional<request_priority> priority;
+
+    /// Absolute time by which the request must complete,
+    /// queueing and redirects included; with `timeout`, the
+    /// earlier applies. It fails with error::deadline_exceeded
+    std::optional<std::chrono::steady_clock::time_point> deadline;
+
+    /// Cancels the request when stop is requested; it then
+    /// fails with error::cancelled
+    std::stop_token stop_token;
 };
 
 } // namespace burl
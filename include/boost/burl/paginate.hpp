@@ -0,0 +1,117 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_PAGINATE_HPP
+#define BOOST_BURL_PAGINATE_HPP
+
+#include <boost/burl/fwd.hpp>
+#include <boost/burl/error.hpp>
+#include <boost/burl/response.hpp>
+#include <boost/capy/io_task.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace boost {
+namespace burl {
+
+//----------------------------------------------------------
+
+/** The pages of a paginated collection, in order.
+
+    Returned by @ref session::paginate. Each call to @ref next
+    yields one page. While the caller works on a page, the
+    request for the following one is already in flight, so
+    network latency overlaps processing instead of
+    alternating with it; `paginate_options::lookahead` bounds
+    how many finished pages may wait.
+
+    Every page is a request of the session, with its options,
+    cookies, authentication and limits. A failed page, or a
+    response which is not 2xx, is yielded and ends the
+    sequence.
+
+    The paginator shares its session's state, so the session
+    may be moved or destroyed while pages are still read; its
+    connections are closed once both are gone. Destroying the
+    paginator cancels any prefetch in flight.
+
+    @par Example
+    @code
+    auto pages = s.paginate(
+        urls::url_view("https://api.github.com/repos/boostorg/url/issues"));
+    while(!pages.done())
+    {
+        auto [ec, r] = co_await pages.next();
+        if(ec || !r.ok())
+            break;
+        process(r.text());
+    }
+    @endcode
+*/
+class paginator
+{
+    struct impl;
+
+    // Shared with the prefetch in flight
+    std::shared_ptr<impl> impl_;
+
+    friend class session;
+
+    explicit
+    paginator(std::shared_ptr<impl> p) noexcept;
+
+public:
+    /** Constructor.
+
+        A default constructed paginator has no pages.
+    */
+    paginator() noexcept;
+
+    /// Destructor
+    ~paginator();
+
+    /// Move constructor
+    paginator(paginator&&) noexcept;
+
+    /// Move assignment
+    paginator&
+    operator=(paginator&&) noexcept;
+
+    /** Return true once every page was yielded.
+
+        This becomes true after the page without a next link
+        is returned by @ref next, after a failure, or once
+        `paginate_options::max_pages` pages were yielded.
+    */
+    bool
+    done() const noexcept;
+
+    /** Return the number of pages yielded so far.
+    */
+    std::size_t
+    pages() const noexcept;
+
+    /** Return the next page.
+
+        Completes at once if the page was already prefetched.
+        Calling it when @ref done is true fails with
+        `std::errc::result_out_of_range`.
+
+        @return An awaitable yielding `(error_code, response<std::string>)`
+    */
+    capy::io_task<response<std::string>>
+    next();
+};
+
+} // namespace burl
+} // namespace boost
+
+#endif
@@ -11,7 +11,10 @@
 #define BOOST_BURL_PARSE_ARGS_HPP
 
 #include <boost/burl/fwd.hpp>
+#include <boost/burl/resolve.hpp>
 
+#include <chrono>
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <system_error>
@@ -167,6 +170,57 @@ struct burl_args
     /// Connection timeout (--connect-timeout)
     std::optional<double> connect_timeout;
 
+    /// Seconds to wait for 100 Continue, at most 86400 (--expect100-timeout)
+    std::optional<double> expect100_timeout;
+
+    /// Disable Nagle's algorithm (--tcp-nodelay, on by default)
+    bool tcp_nodelay = true;
+
+    /// Use TCP Fast Open (--tcp-fastopen)
+    bool tcp_fastopen = false;
+
+    /// Disable TCP keepalive probes (--no-keepalive)
+    bool no_keepalive = false;
+
+    /// Idle seconds before keepalive probes (--keepalive-time)
+    std::optional<long> keepalive_time;
+
+    /// Unanswered keepalive probes before giving up (--keepalive-cnt)
+    std::optional<unsigned> keepalive_cnt;
+
+    /// Local addresses or interfaces to connect from (--interface)
+    std::vector<std::string> interfaces;
+
+    /// First local port to use (--local-port N[-M])
+    std::optional<std::uint16_t> local_port;
+
+    /// Last local port to use, if a range was given
+    std::optional<std::uint16_t> local_port_last;
+
+    /// Fixed addresses for host:port (--resolve)
+    std::vector<resolve_override> resolve;
+
+    /// Connect to another host:port instead (--connect-to)
+    std::vector<connect_override> connect_to;
+
+    /// File to load warm state from and save it to (--warm-state)
+    std::optional<std::string> warm_state;
+
+    /// File of HSTS hosts; enables HSTS (--hsts)
+    std::optional<std::string> hsts;
+
+    /// File of alternative services; enables them (--alt-svc)
+    std::optional<std::string> alt_svc;
+
+    /// Maximum transfer rate in bytes per second (--limit-rate)
+    std::optional<std::uint64_t> limit_rate;
+
+    /// Maximum requests started per rate_period (--rate)
+    std::optional<std::uint64_t> rate;
+
+    /// Time unit for rate (--rate N/U, default per hour)
+    std::chrono::seconds rate_period{3600};
+
     //------------------------------------------------------
     // Verbosity options
     //------------------------------------------------------
@@ -0,0 +1,73 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_RESOLVE_HPP
+#define BOOST_BURL_RESOLVE_HPP
+
+#include <boost/burl/fwd.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace burl {
+
+//----------------------------------------------------------
+
+/** Fixed addresses for a host and port.
+
+    Equivalent to curl's `--resolve host:port:addr[,addr]...`.
+    Connections to the host and port use these addresses
+    instead of asking DNS. The URL's host is still used for
+    the Host header, TLS SNI and certificate checks, and
+    connection pooling.
+*/
+struct resolve_override
+{
+    /// Host name to match, or "*" for any host
+    std::string host;
+
+    /// Port to match
+    std::uint16_t port = 0;
+
+    /// Numeric addresses to connect to, without brackets.
+    /// Empty removes an earlier override for the host and port.
+    std::vector<std::string> addresses;
+};
+
+//----------------------------------------------------------
+
+/** Connect to another host and port.
+
+    Equivalent to curl's `--connect-to HOST1:PORT1:HOST2:PORT2`.
+    Requests for HOST1:PORT1 connect to HOST2:PORT2 instead,
+    which is then resolved as usual (including through any
+    @ref resolve_override). As with @ref resolve_override, the
+    request itself still names HOST1.
+*/
+struct connect_override
+{
+    /// Host to match (empty = any host)
+    std::string host;
+
+    /// Port to match (0 = any port)
+    std::uint16_t port = 0;
+
+    /// Host to connect to (empty = the original host)
+    std::string to_host;
+
+    /// Port to connect to (0 = the original port)
+    std::uint16_t to_port = 0;
+};
+
+} // namespace burl
+} // namespace boost
+
+#endif
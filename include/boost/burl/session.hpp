@@ -15,8 +15,13 @@
 #include <boost/burl/body_tags.hpp>
 #include <boost/burl/cookies.hpp>
 #include <boost/burl/error.hpp>
+#include <boost/burl/json_view.hpp>
 #include <boost/burl/options.hpp>
+#include <boost/burl/paginate.hpp>
+#include <boost/burl/resolve.hpp>
 #include <boost/burl/response.hpp>
+#include <boost/burl/share.hpp>
+#include <boost/burl/websocket.hpp>
 
 #include <boost/capy/ex/run_async.hpp>
 #include <boost/capy/io_task.hpp>
@@ -71,9 +76,65 @@ namespace burl {
 class session
 {
     struct impl;
-    std::unique_ptr<impl> impl_;
+
+    // Shared with this session's paginators
+    std::shared_ptr<impl> impl_;
+
+    explicit
+    session(std::shared_ptr<impl> p) noexcept;
+
+    static void end_edit(impl& i, http::fields const*) noexcept;
+    static void end_edit(impl& i, cookie_jar const*) noexcept;
 
 public:
+    /** A scoped handle for changing a session setting.
+
+        Returned by @ref headers and @ref cookies. While it
+        lives, the setting is this session's own, and sessions
+        derived in the meantime get a copy of it. Once it is
+        destroyed, derived sessions share the setting again,
+        so do not keep references obtained through it. It must
+        not outlive the session.
+    */
+    template<class T>
+    class editor
+    {
+        friend class session;
+
+        impl* i_;
+        T* p_;
+
+        editor(impl& i, T& t) noexcept
+            : i_(&i)
+            , p_(&t)
+        {
+        }
+
+    public:
+        editor(editor const&) = delete;
+        editor& operator=(editor const&) = delete;
+
+        /// Destructor
+        ~editor()
+        {
+            session::end_edit(*i_, p_);
+        }
+
+        /// Return the setting for writing
+        T&
+        operator*() const noexcept
+        {
+            return *p_;
+        }
+
+        /// Return the setting for writing
+        T*
+        operator->() const noexcept
+        {
+            return p_;
+        }
+    };
+
     //------------------------------------------------------
     // Construction
     //------------------------------------------------------
@@ -91,9 +152,22 @@ public:
         corosio::io_context& ioc,
         corosio::tls::context& tls_ctx);
 
+    /** Construct a session which shares connections.
+
+        The session uses the share's io_context, TLS context,
+        connection pools, DNS cache and TLS session cache.
+        Its cookies, headers and other settings are its own.
+
+        @param sh The state to share
+    */
+    explicit
+    session(share const& sh);
+
     /** Destructor.
 
-        Closes all connections.
+        Closes all connections, once no paginator of this
+        session is left. Idle connections of a share stay
+        open for the other sessions using it.
     */
     ~session();
 
@@ -110,6 +184,33 @@ public:
     session(session const&) = delete;
     session& operator=(session const&) = delete;
 
+    /** Return a session derived from this one.
+
+        The new session starts with this session's headers,
+        cookies, authentication, TLS verification, redirect
+        and timeout settings, and the settings for making
+        connections, and uses the same connections, DNS cache
+        and TLS session cache. Settings are shared, not copied,
+        until one of the two sessions changes them, so deriving
+        costs a few allocations whatever the configuration.
+        The exception is headers and cookies with an
+        @ref editor alive, which are copied at once.
+
+        Rate, bandwidth and concurrency limits, circuit
+        breakers and pool maintenance are not inherited.
+        Closing a derived session leaves the idle connections
+        open for this one.
+
+        @par Example
+        @code
+        // One per incoming request
+        burl::session s = base.derive();
+        s.set_auth(std::make_shared<burl::http_bearer_auth>(token));
+        @endcode
+    */
+    session
+    derive() const;
+
     //------------------------------------------------------
     // Context access
     //------------------------------------------------------
@@ -146,32 +247,38 @@ public:
     // Session configuration
     //------------------------------------------------------
 
-    /** Get default headers.
+    /** Change default headers.
 
-        Returns the headers that are sent with every request.
-        Modify these to set defaults like User-Agent.
+        Returns an @ref editor for the headers that are sent
+        with every request, to set defaults like User-Agent.
+        Headers still shared with a derived session are copied
+        first. To read without copying, call the const
+        overload, e.g. through `std::as_const(s).headers()`.
 
         @par Example
         @code
         burl::session s;
-        s.headers().set(http::field::user_agent, "MyApp/1.0");
+        s.headers()->set(http::field::user_agent, "MyApp/1.0");
         @endcode
     */
-    http::fields&
-    headers() noexcept;
+    editor<http::fields>
+    headers();
 
     /** Get default headers (const).
     */
     http::fields const&
     headers() const noexcept;
 
-    /** Get the cookie jar.
+    /** Change the cookie jar.
 
-        Returns the cookie storage for this session. Cookies
-        are automatically managed for all requests.
+        Returns an @ref editor for the cookie storage of this
+        session. Cookies are automatically managed for all
+        requests. Cookies still shared with a derived session
+        are copied first. To read without copying, call the
+        const overload, e.g. through `std::as_const(s).cookies()`.
     */
-    cookie_jar&
-    cookies() noexcept;
+    editor<cookie_jar>
+    cookies();
 
     /** Get the cookie jar (const).
     */
@@ -209,12 +316,255 @@ public:
     void
     set_timeout(std::chrono::milliseconds timeout);
 
+    /** Set when request bodies wait for 100 Continue.
+
+        Large uploads are sent with `Expect: 100-continue`, so
+        a server which refuses them does not receive the body
+        first. A server answering 417 gets the request again
+        without the expectation. This is enabled by default
+        with the defaults of @ref expect_continue.
+
+        @param cfg The configuration, or `std::nullopt` to
+            always send bodies at once
+    */
+    void
+    set_expect_continue(std::optional<expect_continue> cfg);
+
+    /** Set the session-wide bandwidth limit.
+
+        The limit is shared by all requests made through this
+        session. A per-request limit in request_options is
+        applied in addition to this one.
+
+        @param limit Upload and download rates in bytes per second
+    */
+    void
+    set_limit_rate(bandwidth_limit limit);
+
+    /** Set the maximum rate at which requests start.
+
+        The limit applies across all origins. Requests over
+        the limit are suspended until admitted, without
+        polling; they do not fail.
+
+        @param rate The session-wide request rate
+    */
+    void
+    set_request_rate(request_rate rate);
+
+    /** Set the maximum rate at which requests start per origin.
+
+        Each origin (scheme, host and port) is limited
+        independently, in addition to the session-wide limit.
+
+        @param rate The request rate for each origin
+    */
+    void
+    set_origin_request_rate(request_rate rate);
+
+    /** Set the maximum number of requests in flight.
+
+        Requests beyond the limit are queued and started as
+        others complete, taking turns across origins so that
+        a large batch for one origin cannot starve the rest.
+
+        @param n Maximum concurrent requests (0 = unlimited)
+    */
+    void
+    set_max_in_flight(std::size_t n);
+
+    /** Set the maximum number of requests in flight per origin.
+
+        @param n Maximum concurrent requests to any one origin
+            (0 = unlimited)
+    */
+    void
+    set_max_in_flight_per_origin(std::size_t n);
+
+    /** Set the scheduling weight of an origin.
+
+        When requests are queued, an origin with weight `w`
+        is given `w` turns for every turn given to an origin
+        with weight 1. The default weight is 1.
+
+        @param origin A URL identifying the origin
+        @param weight The relative share of turns
+    */
+    void
+    set_origin_weight(urls::url_view origin, unsigned weight);
+
+    /** Enable adaptive per-origin concurrency limits.
+
+        Each origin's limit is adjusted from the latency and
+        failures of its completed requests, within the bounds
+        given in `cfg` and never above the fixed per-origin
+        limit. When `cfg.max_queue` is nonzero, requests which
+        would queue beyond it fail with @ref error::overloaded.
+
+        @param cfg The configuration, or `std::nullopt` to
+            return to fixed limits
+    */
+    void
+    set_adaptive_concurrency(
+        std::optional<adaptive_concurrency> cfg);
+
+    /** Set how requests are spread across a host's addresses.
+
+        Every address a host name resolves to is used, each
+        with its own connections. Addresses which keep failing
+        or respond far slower than the others are left out for
+        a while.
+
+        @param lb The load balancing configuration
+    */
+    void
+    set_load_balancing(load_balancing lb);
+
+    /** Set the options applied to new TCP sockets.
+
+        @param opts The socket options
+    */
+    void
+    set_socket_options(socket_options opts);
+
+    /** Set the options applied to new TCP sockets for an origin.
+
+        These replace the session's socket options for
+        connections to the origin.
+
+        @param origin A URL identifying the origin
+        @param opts The socket options
+    */
+    void
+    set_origin_socket_options(
+        urls::url_view origin,
+        socket_options opts);
+
+    /** Enable background maintenance of the connection pools.
+
+        A task owned by the session closes idle connections
+        past their timeout and connections past their maximum
+        age, and keeps a minimum number of idle connections
+        open to each origin, so that none of this happens on
+        the request path.
+
+        @param opts The pool options, or `std::nullopt` to
+            stop the task
+    */
+    void
+    set_pool_options(std::optional<pool_options> opts);
+
+    /** Set the idle connections kept open to an origin.
+
+        This replaces the `min_idle` of the pool options for
+        the origin. It has no effect unless maintenance is
+        enabled with @ref set_pool_options.
+
+        @param origin A URL identifying the origin
+        @param n The minimum number of idle connections
+    */
+    void
+    set_origin_min_idle(
+        urls::url_view origin,
+        std::size_t n);
+
+    /** Set the local addresses and ports to connect from.
+
+        New connections are bound to the addresses of the
+        server address's family in turn. Interface names are replaced by their addresses.
+
+        @param b The addresses and port range
+    */
+    void
+    set_source_binding(source_binding b);
+
+    /** Use fixed addresses for a host and port.
+
+        The addresses are used instead of DNS. An override
+        with no addresses removes an earlier one.
+
+        @param r The host, port and addresses
+    */
+    void
+    add_resolve_override(resolve_override r);
+
+    /** Connect to another host and port for a host and port.
+
+        The Host header, TLS server name and connection pool
+        still use the host in the request URL.
+
+        @param c The host and port to match and their replacement
+    */
+    void
+    add_connect_override(connect_override c);
+
+    /** Remove every resolve and connect override.
+    */
+    void
+    clear_resolver_overrides();
+
+    /** Enable per-origin circuit breakers.
+
+        While an origin's circuit is open, requests to it fail
+        immediately with @ref error::circuit_open.
+
+        @param cfg The configuration, or `std::nullopt` to
+            disable circuit breaking
+    */
+    void
+    set_circuit_breaker(
+        std::optional<circuit_breaker_config> cfg);
+
+    /** Enable HTTP Strict Transport Security.
+
+        While enabled, the session remembers hosts which sent a
+        `Strict-Transport-Security` header over HTTPS, and
+        requests and redirects to them using `http` are sent
+        with `https` instead, without first making the plain
+        request. The hosts are kept with the connections, so
+        sessions constructed from one @ref share know the same
+        hosts. It is disabled by default.
+
+        @param enable true to enable HSTS
+
+        @see load_hsts, save_hsts
+    */
+    void
+    set_hsts(bool enable);
+
+    /** Enable alternative services.
+
+        While enabled, the session remembers the `Alt-Svc`
+        headers of HTTPS responses, and connects later requests
+        to the origin's preferred alternative, such as HTTP/2
+        on another port or another host, that it can speak.
+        The Host header and certificate check still use the
+        origin. If the alternative cannot be reached it is
+        forgotten and the request falls back to the origin.
+        Alternatives are kept with the connections, so sessions
+        constructed from one @ref share know the same ones. It
+        is disabled by default.
+
+        @param enable true to enable alternative services
+
+        @see load_alt_svc, save_alt_svc
+    */
+    void
+    set_alt_svc(bool enable);
+
     //------------------------------------------------------
     // HTTP request methods - string body (default)
     //------------------------------------------------------
 
     /** Perform an HTTP request.
 
+        If `opts.stop_token` is stopped while the request is
+        queued, resolving, connecting, in the TLS handshake,
+        writing or reading, the pending operation is cancelled
+        and the request fails with @ref error::cancelled. Its
+        connection is pooled again only if it is between
+        messages, and closed otherwise.
+
         @param method HTTP method
         @param url Request URL
         @param opts Request options
@@ -337,6 +687,32 @@ public:
     capy::io_task<response<json::value>>
     post(urls::url_view url, as_json_t tag, request_options opts = {});
 
+    /** Perform an HTTP GET request with a lazy JSON view.
+
+        The response body is indexed but not parsed; values
+        are parsed when they are looked up. This suits large
+        documents of which only a few fields are read.
+
+        @param url Request URL
+        @param tag JSON view body tag
+        @param opts Request options
+
+        @return An awaitable yielding `(error_code, response<json_view>)`
+    */
+    capy::io_task<response<json_view>>
+    get(urls::url_view url, as_json_view_t tag, request_options opts = {});
+
+    /** Perform an HTTP POST request with a lazy JSON view.
+
+        @param url Request URL
+        @param tag JSON view body tag
+        @param opts Request options
+
+        @return An awaitable yielding `(error_code, response<json_view>)`
+    */
+    capy::io_task<response<json_view>>
+    post(urls::url_view url, as_json_view_t tag, request_options opts = {});
+
     //------------------------------------------------------
     // HTTP request methods - custom type deserialization
     //------------------------------------------------------
@@ -397,6 +773,59 @@ public:
     capy::io_task<streamed_response>
     post_streamed(urls::url_view url, request_options opts = {});
 
+    //------------------------------------------------------
+    // Pagination
+    //------------------------------------------------------
+
+    /** Page through a collection with GET requests.
+
+        No request is made until the paginator's first
+        @ref paginator::next; from then on the following page
+        is requested as soon as each page is handed over.
+
+        @param url The first page
+        @param opts Request options for every page
+        @param popts How to find the next page, and how far
+            to read ahead
+
+        @return The paginator. It shares the session's state,
+            so it stays usable if the session is moved or
+            destroyed
+    */
+    paginator
+    paginate(
+        urls::url_view url,
+        request_options opts = {},
+        paginate_options popts = {});
+
+    //------------------------------------------------------
+    // WebSocket
+    //------------------------------------------------------
+
+    /** Open a WebSocket connection (RFC 6455).
+
+        The upgrade request goes through the same connection
+        setup as other requests: HSTS, Alt-Svc, proxies, DNS
+        caching, TLS session resumption and the session's
+        cookies, authentication and default headers all apply.
+        Once upgraded, the connection belongs to the returned
+        stream and is never returned to the pool.
+
+        permessage-deflate (RFC 7692) is offered when
+        `opts.permessage_deflate` is set and the library was
+        built with zlib.
+
+        @param url A `ws://` or `wss://` URL; `http://` and
+            `https://` are accepted as their equivalents
+        @param opts WebSocket options
+
+        @return An awaitable yielding `(error_code, websocket_stream)`;
+            the error is @ref error::websocket_handshake_failed
+            if the server did not accept the upgrade
+    */
+    capy::io_task<websocket_stream>
+    websocket(urls::url_view url, websocket_options opts = {});
+
     //------------------------------------------------------
     // Connection management
     //------------------------------------------------------
@@ -405,9 +834,119 @@ public:
 
         After calling close(), the session cannot be used for
         new requests. Pending requests may be cancelled.
+
+        @see shutdown
     */
     void
     close();
+
+    /** Save what the session has learned to a file.
+
+        Writes the unexpired DNS answers and TLS sessions, the
+        cookie jar, and what is known about each origin, such
+        as HTTP/2 support, in a compact binary form. Loading
+        the file in a later process with @ref load_state lets
+        its first requests skip DNS lookups and full TLS
+        handshakes.
+
+        The file is replaced atomically. It holds session
+        cookies and TLS session keys, so it should be as
+        private as the process's credentials.
+
+        @param path The file to write
+
+        @return The error, if any
+    */
+    std::error_code
+    save_state(std::string const& path) const;
+
+    /** Load state saved by @ref save_state.
+
+        Entries which expired since the file was written are
+        skipped. Loaded cookies replace cookies with the same
+        name, domain and path.
+
+        @param path The file to read
+
+        @return The error, if any. A file which is not saved
+            state, or is damaged, gives
+            `std::errc::bad_message` and changes nothing.
+    */
+    std::error_code
+    load_state(std::string const& path);
+
+    /** Load HSTS hosts from a file.
+
+        The file uses curl's HSTS cache format: a host and its
+        expiry on each line, with a leading dot on hosts whose
+        subdomains are covered too. Entries replace those for
+        the same host; expired and malformed ones are skipped.
+        Loading does not enable HSTS; see @ref set_hsts.
+
+        @param path The file to read
+
+        @return The error, if any
+    */
+    std::error_code
+    load_hsts(std::string const& path);
+
+    /** Save HSTS hosts to a file.
+
+        Writes the unexpired hosts in the format read by
+        @ref load_hsts. The file is replaced atomically.
+
+        @param path The file to write
+
+        @return The error, if any
+    */
+    std::error_code
+    save_hsts(std::string const& path) const;
+
+    /** Load alternative services from a file.
+
+        The file uses curl's Alt-Svc cache format. Entries
+        replace those for the same origin and alternative;
+        expired and malformed ones are skipped. Loading does
+        not enable alternative services; see @ref set_alt_svc.
+
+        @param path The file to read
+
+        @return The error, if any
+    */
+    std::error_code
+    load_alt_svc(std::string const& path);
+
+    /** Save alternative services to a file.
+
+        Writes the unexpired alternatives in the format read by
+        @ref load_alt_svc. The file is replaced atomically.
+
+        @param path The file to write
+
+        @return The error, if any
+    */
+    std::error_code
+    save_alt_svc(std::string const& path) const;
+
+    /** Shut down gracefully.
+
+        New requests fail at once with @ref error::session_closed.
+        Requests already in flight, queued ones included, may
+        finish until `deadline`; meanwhile idle connections are
+        closed, all at the same time, each sending TLS
+        close_notify first. At the deadline any request still
+        running is cancelled and fails with @ref error::cancelled,
+        and its connection is closed.
+
+        The awaitable completes once every connection is closed.
+        Calling it again waits for the same shutdown.
+
+        @param deadline When to stop waiting for requests
+
+        @return An awaitable yielding `(error_code)`
+    */
+    capy::io_task<>
+    shutdown(std::chrono::steady_clock::time_point deadline);
 };
 
 //----------------------------------------------------------
@@ -0,0 +1,98 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SHARE_HPP
+#define BOOST_BURL_SHARE_HPP
+
+#include <boost/burl/fwd.hpp>
+#include <boost/corosio/io_context.hpp>
+#include <boost/corosio/tls/openssl_stream.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace boost {
+namespace burl {
+
+namespace detail {
+struct shared_state;
+} // namespace detail
+
+//----------------------------------------------------------
+
+/** Connections, DNS answers and TLS sessions shared by sessions.
+
+    Equivalent to curl's share interface. Sessions constructed
+    from the same share use one set of connection pools, one
+    DNS cache and one TLS session cache, so several sessions
+    calling the same upstreams do not each open their own
+    connections. Cookies, default headers, authentication,
+    limits and every other setting stay with each session.
+    A connection or TLS session is only reused for a request
+    whose certificate verification, connect and resolve
+    overrides, alternative service and socket options match
+    those it was opened with.
+
+    A share is a handle: copies refer to the same state, which
+    lives as long as any share or session using it. Sessions
+    sharing state run on the share's io_context and TLS
+    context.
+
+    @par Example
+    @code
+    burl::share sh(ioc, tls_ctx);
+
+    burl::session tenant_a(sh);
+    tenant_a.headers()->set(http::field::authorization, "Bearer a");
+
+    burl::session tenant_b(sh);
+    tenant_b.headers()->set(http::field::authorization, "Bearer b");
+    @endcode
+*/
+class share
+{
+    std::shared_ptr<detail::shared_state> state_;
+
+    friend class session;
+
+public:
+    /** Constructor.
+
+        The caller is responsible for running the io_context
+        and ensuring both contexts outlive the share and every
+        session constructed from it.
+
+        @param ioc Reference to the io_context to use
+        @param tls_ctx Reference to the TLS context for HTTPS
+            connections
+    */
+    share(
+        corosio::io_context& ioc,
+        corosio::tls::context& tls_ctx);
+
+    /** Get a reference to the io_context.
+    */
+    corosio::io_context&
+    get_io_context() const noexcept;
+
+    /** Get a reference to the TLS context.
+    */
+    corosio::tls::context&
+    tls_context() const noexcept;
+
+    /** Return the number of idle pooled connections.
+    */
+    std::size_t
+    idle_connections() const noexcept;
+};
+
+} // namespace burl
+} // namespace boost
+
+#endif
@@ -0,0 +1,180 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_WEBSOCKET_HPP
+#define BOOST_BURL_WEBSOCKET_HPP
+
+#include <boost/burl/fwd.hpp>
+#include <boost/burl/error.hpp>
+#include <boost/capy/io_task.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace boost {
+namespace burl {
+
+//----------------------------------------------------------
+
+/** A message received on a WebSocket.
+*/
+struct websocket_message
+{
+    /// The payload, decompressed and reassembled from its frames
+    std::string data;
+
+    /// True for a binary message, false for text
+    bool binary = false;
+};
+
+//----------------------------------------------------------
+
+/** A client WebSocket connection.
+
+    Returned by @ref session::websocket once the upgrade
+    handshake succeeds. It reads and writes whole messages:
+    outgoing messages are compressed if permessage-deflate
+    was negotiated, split into frames of at most
+    `websocket_options::fragment_size`, and masked; incoming
+    frames are checked, reassembled and decompressed.
+
+    Pings from the server are answered while reading, so a
+    connection stays alive as long as it is read from. Only
+    one read and one write may be outstanding at a time.
+
+    @par Example
+    @code
+    auto [ec, ws] = co_await s.websocket(
+        urls::url_view("wss://example.com/feed"));
+    if(ec)
+        co_return;
+    co_await ws.write("subscribe");
+    for(;;)
+    {
+        auto [ec, msg] = co_await ws.read();
+        if(ec)
+            break;
+        handle(msg.data);
+    }
+    @endcode
+*/
+class websocket_stream
+{
+    struct impl;
+    std::unique_ptr<impl> impl_;
+
+    friend class session;
+
+    explicit
+    websocket_stream(std::unique_ptr<impl> p) noexcept;
+
+public:
+    /** Constructor.
+
+        A default constructed stream is not open.
+    */
+    websocket_stream() noexcept;
+
+    /// Destructor; the connection is dropped without a close frame
+    ~websocket_stream();
+
+    /// Move constructor
+    websocket_stream(websocket_stream&&) noexcept;
+
+    /// Move assignment
+    websocket_stream&
+    operator=(websocket_stream&&) noexcept;
+
+    /** Return true until the stream is closed or fails.
+    */
+    bool
+    is_open() const noexcept;
+
+    /** Return the subprotocol the server chose, if any.
+    */
+    std::string const&
+    protocol() const noexcept;
+
+    /** Return true if permessage-deflate was negotiated.
+    */
+    bool
+    compressed() const noexcept;
+
+    /** Read the next message.
+
+        Control frames are handled while reading: pings are
+        answered with pongs, and a close frame is answered
+        and ends the stream with @ref error::connection_closed,
+        after which @ref close_code and @ref close_reason give
+        the server's reasons. A message larger than
+        `websocket_options::max_message_size`, invalid UTF-8
+        in a text message or a malformed frame closes the
+        connection and fails with
+        @ref error::websocket_protocol_error.
+
+        @return An awaitable yielding `(error_code, websocket_message)`
+    */
+    capy::io_task<websocket_message>
+    read();
+
+    /** Send a message.
+
+        @param data The payload; it must stay valid until the
+            awaitable completes
+        @param binary true to send a binary message, false
+            for text
+
+        @return An awaitable yielding `(error_code)`
+    */
+    capy::io_task<>
+    write(std::string_view data, bool binary = false);
+
+    /** Send a ping.
+
+        @param payload At most 125 bytes, echoed in the pong
+
+        @return An awaitable yielding `(error_code)`
+    */
+    capy::io_task<>
+    ping(std::string_view payload = {});
+
+    /** Close the connection.
+
+        Sends a close frame, waits for the server's, and
+        closes the connection.
+
+        @param code The close code
+        @param reason Text for the server, cut to fit a
+            control frame
+
+        @return An awaitable yielding `(error_code)`
+    */
+    capy::io_task<>
+    close(std::uint16_t code = 1000, std::string_view reason = {});
+
+    /** Return the close code the server sent.
+
+        This is 1005 if its close frame had no code, and 0
+        if none was received.
+    */
+    std::uint16_t
+    close_code() const noexcept;
+
+    /** Return the close reason the server sent.
+    */
+    std::string const&
+    close_reason() const noexcept;
+};
+
+} // namespace burl
+} // namespace boost
+
+#endif
@@ -10,6 +10,12 @@
 #include <boost/burl/auth.hpp>
 #include <boost/http/field.hpp>
 
+#include "src/detail/sigv4.hpp"
+
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
 // TODO: Include base64 encoding utilities
 // #include <boost/beast/core/detail/base64.hpp>
 
@@ -126,5 +132,192 @@ http_bearer_auth::clone() const
     return std::make_unique<http_bearer_auth>(token_);
 }
 
+//----------------------------------------------------------
+// aws_sigv4_auth
+//----------------------------------------------------------
+
+// Shared by clones; signing from several threads is serialized
+struct aws_sigv4_auth::state
+{
+    std::mutex mutex;
+    detail::sigv4_key_cache keys;
+    detail::sigv4_builder builder;
+    std::vector<detail::sigv4_builder::header> headers;
+    std::string canonical;
+    std::string signed_headers;
+    std::string sts;
+};
+
+namespace {
+
+// Headers left out of the signature, since proxies and the
+// transport may add or change them
+bool
+sigv4_skip(std::string_view name) noexcept
+{
+    auto iequals = [](std::string_view a, std::string_view b)
+    {
+        if(a.size() != b.size())
+            return false;
+        for(std::size_t i = 0; i < a.size(); ++i)
+        {
+            char c = a[i];
+            if(c >= 'A' && c <= 'Z')
+                c = static_cast<char>(c + 32);
+            if(c != b[i])
+                return false;
+        }
+        return true;
+    };
+    return
+        iequals(name, "authorization") ||
+        iequals(name, "user-agent") ||
+        iequals(name, "expect") ||
+        iequals(name, "connection");
+}
+
+} // namespace
+
+aws_sigv4_auth::aws_sigv4_auth(
+    std::string access_key,
+    std::string secret_key,
+    std::string region,
+    std::string service,
+    std::string session_token)
+    : access_key_(std::move(access_key))
+    , secret_key_(std::move(secret_key))
+    , region_(std::move(region))
+    , service_(std::move(service))
+    , session_token_(std::move(session_token))
+    , state_(std::make_shared<state>())
+{
+}
+
+void
+aws_sigv4_auth::apply(http::request& req) const
+{
+    apply(req, auth_context{});
+}
+
+void
+aws_sigv4_auth::apply(
+    http::request& req,
+    auth_context const& ctx) const
+{
+    auto const amz_date = detail::format_amz_date(ctx.now);
+    sign(req,
+        ctx.payload_hash.empty() ?
+            detail::sigv4_unsigned_payload : ctx.payload_hash,
+        amz_date);
+}
+
+bool
+aws_sigv4_auth::needs_payload_hash() const noexcept
+{
+    return true;
+}
+
+aws_sigv4_auth::chunk_signer
+aws_sigv4_auth::apply_streaming(
+    http::request& req,
+    std::uint64_t length,
+    std::size_t chunk_size,
+    std::chrono::system_clock::time_point now) const
+{
+    req.set(http::field::content_encoding, "aws-chunked");
+    req.set("x-amz-decoded-content-length", std::to_string(length));
+    req.set(http::field::content_length, std::to_string(
+        detail::aws_chunked_length(length, chunk_size)));
+
+    chunk_signer cs;
+    cs.amz_date_ = detail::format_amz_date(now);
+    cs.previous_ = sign(req, detail::sigv4_streaming_payload, cs.amz_date_);
+    auto const date = std::string_view(cs.amz_date_).substr(0, 8);
+    cs.scope_.append(date).push_back('/');
+    cs.scope_.append(region_).push_back('/');
+    cs.scope_.append(service_).append("/aws4_request");
+    cs.key_ = state_->keys.get(secret_key_, date, region_, service_);
+    return cs;
+}
+
+std::unique_ptr<auth_base>
+aws_sigv4_auth::clone() const
+{
+    auto copy = std::make_unique<aws_sigv4_auth>(
+        access_key_, secret_key_, region_, service_, session_token_);
+    copy->state_ = state_;
+    return copy;
+}
+
+std::string
+aws_sigv4_auth::sign(
+    http::request& req,
+    std::string_view payload_hash,
+    std::string const& amz_date) const
+{
+    req.erase(http::field::authorization);
+    req.set("x-amz-date", amz_date);
+    req.set("x-amz-content-sha256", payload_hash);
+    if(!session_token_.empty())
+        req.set("x-amz-security-token", session_token_);
+
+    auto const date = std::string_view(amz_date).substr(0, 8);
+    std::string scope;
+    scope.append(date).push_back('/');
+    scope.append(region_).push_back('/');
+    scope.append(service_).append("/aws4_request");
+
+    std::string const target(req.target());
+    auto const q = target.find('?');
+    std::string_view const path =
+        std::string_view(target).substr(0, q);
+    std::string_view const query = q == std::string::npos ?
+        std::string_view() : std::string_view(target).substr(q + 1);
+
+    auto& st = *state_;
+    std::lock_guard<std::mutex> lock(st.mutex);
+    st.headers.clear();
+    for(auto const& f : req)
+        if(!sigv4_skip(f.name))
+            st.headers.emplace_back(f.name, f.value);
+
+    st.canonical.clear();
+    st.builder.canonical_request(st.canonical,
+        req.method_text(), path, query, st.headers,
+        payload_hash, service_ != "s3", st.signed_headers);
+    st.sts.clear();
+    detail::sigv4_builder::string_to_sign(
+        st.sts, amz_date, scope, st.canonical);
+
+    std::string signature;
+    detail::sigv4_builder::sign(signature,
+        st.keys.get(secret_key_, date, region_, service_), st.sts);
+
+    std::string value = "AWS4-HMAC-SHA256 Credential=";
+    value.append(access_key_).push_back('/');
+    value.append(scope);
+    value.append(", SignedHeaders=").append(st.signed_headers);
+    value.append(", Signature=").append(signature);
+    req.set(http::field::authorization, value);
+    return signature;
+}
+
+std::string
+aws_sigv4_auth::chunk_signer::chunk_header(std::string_view data)
+{
+    sts_.clear();
+    detail::sigv4_builder::chunk_string_to_sign(
+        sts_, amz_date_, scope_, previous_, data);
+    previous_.clear();
+    detail::sigv4_builder::sign(previous_, key_, sts_);
+
+    char size[20];
+    std::snprintf(size, sizeof(size), "%zx", data.size());
+    std::string line(size);
+    line.append(";chunk-signature=").append(previous_);
+    line.append("\r\n");
+    return line;
+}
+
 } // namespace burl
 } // namespace boost
@@ -0,0 +1,157 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_ADAPTIVE_LIMIT_HPP
+#define BOOST_BURL_SRC_DETAIL_ADAPTIVE_LIMIT_HPP
+
+#include <boost/burl/options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/** A concurrency limit which adapts to observed latency.
+
+    Each completed request contributes a sample: its round
+    trip time, the number of requests in flight when it
+    started, and whether it failed. The limit is recomputed
+    from every sample, in the manner of Netflix's
+    concurrency-limits library:
+
+    @li AIMD grows the limit by one when a request succeeds
+        while the limit is well used, and multiplies it by the
+        backoff ratio when a request fails.
+
+    @li Gradient compares a short-term RTT with a slowly moving
+        long-term RTT. When queueing makes the short-term RTT
+        rise, the ratio falls below one and the limit shrinks;
+        when they agree, the limit grows by a queue allowance
+        of about the square root of the limit. Failures back
+        off multiplicatively, as with AIMD.
+
+    Growth only happens while at least half the limit is in
+    use, so an idle origin does not drift to the maximum.
+*/
+class adaptive_limit
+{
+public:
+    using duration = std::chrono::nanoseconds;
+
+    explicit
+    adaptive_limit(adaptive_concurrency const& cfg) noexcept
+        : cfg_(cfg)
+        , limit_(static_cast<double>(std::clamp(
+            cfg.initial_limit, cfg.min_limit, cfg.max_limit)))
+    {
+    }
+
+    /** Return the current limit.
+    */
+    std::size_t
+    limit() const noexcept
+    {
+        return static_cast<std::size_t>(limit_);
+    }
+
+    /** Return the smoothed long-term RTT.
+
+        This is zero until the first sample.
+    */
+    duration
+    expected_rtt() const noexcept
+    {
+        return duration(static_cast<duration::rep>(long_rtt_));
+    }
+
+    /** Record a completed request.
+
+        @param rtt The time from start to completion
+        @param in_flight Requests in flight when it started
+        @param failed Whether it failed or timed out
+    */
+    void
+    on_sample(
+        duration rtt,
+        std::size_t in_flight,
+        bool failed) noexcept
+    {
+        auto const r = static_cast<double>(rtt.count());
+        if(cfg_.algo == adaptive_concurrency::algorithm::aimd)
+            aimd(in_flight, failed);
+        else
+            gradient(r, in_flight, failed);
+        if(!failed)
+            long_rtt_ = long_rtt_ == 0 ? r :
+                long_rtt_ * (1 - long_alpha) + r * long_alpha;
+        limit_ = std::clamp(limit_,
+            static_cast<double>(cfg_.min_limit),
+            static_cast<double>(cfg_.max_limit));
+    }
+
+private:
+    // Weight of a new sample in the long-term average
+    static constexpr double long_alpha = 0.01;
+
+    bool
+    app_limited(std::size_t in_flight) const noexcept
+    {
+        return static_cast<double>(in_flight) * 2 < limit_;
+    }
+
+    void
+    aimd(std::size_t in_flight, bool failed) noexcept
+    {
+        if(failed)
+            limit_ = std::floor(limit_ * cfg_.backoff_ratio);
+        else if(!app_limited(in_flight))
+            limit_ += 1;
+    }
+
+    void
+    gradient(double rtt, std::size_t in_flight, bool failed) noexcept
+    {
+        if(failed)
+        {
+            limit_ = std::floor(limit_ * cfg_.backoff_ratio);
+            return;
+        }
+        if(long_rtt_ == 0)
+            return;
+
+        double const short_rtt = rtt;
+
+        // Let the baseline catch up after a lasting shift
+        if(long_rtt_ / short_rtt > 2)
+            long_rtt_ *= 0.95;
+
+        double const grad = std::clamp(
+            cfg_.rtt_tolerance * long_rtt_ / short_rtt, 0.5, 1.0);
+        if(grad >= 1.0 && app_limited(in_flight))
+            return;
+        double const queue = std::sqrt(limit_);
+        double const target = limit_ * grad + queue;
+        limit_ = limit_ * (1 - cfg_.smoothing) +
+            target * cfg_.smoothing;
+    }
+
+    adaptive_concurrency cfg_;
+    double limit_;
+    double long_rtt_ = 0;   // nanoseconds
+};
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
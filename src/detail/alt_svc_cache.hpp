@@ -0,0 +1,544 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_ALT_SVC_CACHE_HPP
+#define BOOST_BURL_SRC_DETAIL_ALT_SVC_CACHE_HPP
+
+#include "src/detail/curl_date.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/** Alternative services advertised by origins (RFC 7838).
+
+    Each origin maps to its alternatives in the order the
+    server listed them, which is its order of preference.
+    A new Alt-Svc header replaces every alternative of its
+    origin.
+
+    The text form is curl's Alt-Svc file, one alternative
+    per line:
+
+    @code
+    h2 example.com 443 h2 alt.example.com 8443 "20250102 03:04:05" 0 0
+    @endcode
+
+    The fields are the protocol, host and port of the origin
+    and of the alternative, the expiry in UTC, the persist
+    flag and a priority, which is unused. The origin's
+    protocol is not part of the key: it is written as "h1"
+    and ignored when read.
+*/
+class alt_svc_cache
+{
+public:
+    using clock_type = std::chrono::system_clock;
+    using time_point = clock_type::time_point;
+
+    /// Protocols an alternative can speak, as bit flags
+    enum protocol : unsigned
+    {
+        proto_h1 = 1,
+        proto_h2 = 2,
+        proto_h3 = 4
+    };
+
+    /// An alternative service
+    struct alternative
+    {
+        protocol proto = proto_h1;
+        std::string host;
+        std::uint16_t port = 0;
+        time_point expires;
+        bool persist = false;
+    };
+
+    /// Most alternatives kept for one origin
+    static constexpr std::size_t max_alternatives = 8;
+
+    /// Return the number of alternatives, expired ones included
+    std::size_t
+    size() const noexcept
+    {
+        std::size_t n = 0;
+        for(auto const& [o, alts] : entries_)
+            n += alts.size();
+        return n;
+    }
+
+    /** Record an Alt-Svc header from an origin.
+
+        Alternatives with protocols not known here are
+        dropped; "clear" removes every alternative of the
+        origin. An invalid header changes nothing.
+
+        @return true if the header was valid
+    */
+    bool
+    update(
+        std::string_view host,
+        std::uint16_t port,
+        std::string_view value,
+        time_point now)
+    {
+        value = trim(value);
+        origin o{lower(host), port};
+        if(o.host.empty() || value.empty())
+            return false;
+        if(value == "clear")
+        {
+            entries_.erase(o);
+            return true;
+        }
+        std::vector<alternative> alts;
+        while(!value.empty())
+        {
+            auto const item = trim(next(value, ','));
+            if(item.empty())
+                continue;
+            alternative a;
+            bool known;
+            if(!parse_alternative(item, o.host, now, a, known))
+                return false;
+            if( known && a.expires > now &&
+                alts.size() < max_alternatives)
+                alts.push_back(std::move(a));
+        }
+        if(alts.empty())
+            entries_.erase(o);
+        else
+            entries_[std::move(o)] = std::move(alts);
+        return true;
+    }
+
+    /** Add or replace one alternative of an origin.
+    */
+    void
+    add(std::string_view host, std::uint16_t port, alternative a)
+    {
+        a.host = lower(a.host);
+        auto& alts = entries_[origin{lower(host), port}];
+        auto it = std::find_if(alts.begin(), alts.end(),
+            [&](alternative const& b)
+            {
+                return same(a, b);
+            });
+        if(it != alts.end())
+            *it = std::move(a);
+        else if(alts.size() < max_alternatives)
+            alts.push_back(std::move(a));
+    }
+
+    /** Return the preferred alternative for an origin.
+
+        @param protocols The protocol flags the caller can speak
+
+        @return The first unexpired alternative with one of
+            `protocols`, or `nullptr`
+    */
+    alternative const*
+    find(
+        std::string_view host,
+        std::uint16_t port,
+        unsigned protocols,
+        time_point now) const
+    {
+        auto it = entries_.find(origin{lower(host), port});
+        if(it == entries_.end())
+            return nullptr;
+        for(auto const& a : it->second)
+            if((a.proto & protocols) != 0 && a.expires > now)
+                return &a;
+        return nullptr;
+    }
+
+    /** Remove an alternative of an origin.
+
+        Called when connecting to the alternative fails, so
+        later requests go to the origin itself.
+
+        @return true if it was present
+    */
+    bool
+    remove(
+        std::string_view host,
+        std::uint16_t port,
+        alternative const& a)
+    {
+        auto it = entries_.find(origin{lower(host), port});
+        if(it == entries_.end())
+            return false;
+        auto& alts = it->second;
+        auto const n = std::erase_if(alts,
+            [&](alternative const& b)
+            {
+                return same(a, b);
+            });
+        if(alts.empty())
+            entries_.erase(it);
+        return n != 0;
+    }
+
+    /** Merge alternatives from curl's Alt-Svc file format.
+
+        Comments, malformed lines, unknown protocols and
+        expired entries are skipped.
+
+        @return The number of alternatives added or replaced
+    */
+    std::size_t
+    load(std::string_view text, time_point now)
+    {
+        std::size_t count = 0;
+        while(!text.empty())
+        {
+            auto const eol = text.find('\n');
+            auto line = trim(text.substr(0, eol));
+            text = eol == std::string_view::npos ?
+                std::string_view() : text.substr(eol + 1);
+            if(line.empty() || line.front() == '#')
+                continue;
+            std::string_view f[6];
+            bool ok = true;
+            for(auto& field : f)
+            {
+                field = word(line);
+                ok = ok && !field.empty();
+            }
+            line = trim(line);
+            auto const q = line.find('"', 1);
+            if( !ok || line.empty() || line.front() != '"' ||
+                q == std::string_view::npos)
+                continue;
+            alternative a;
+            std::uint16_t src_port;
+            if( !parse_curl_date(line.substr(1, q - 1), a.expires) ||
+                a.expires <= now ||
+                !parse_port(f[2], src_port) ||
+                !parse_port(f[5], a.port) ||
+                !parse_protocol(f[3], a.proto))
+                continue;
+            line.remove_prefix(q + 1);
+            a.persist = trim(word(line)) == "1";
+            a.host = std::string(f[4]);
+            add(f[1], src_port, std::move(a));
+            ++count;
+        }
+        return count;
+    }
+
+    /** Return the unexpired alternatives in curl's Alt-Svc file format.
+    */
+    std::string
+    save(time_point now) const
+    {
+        std::string out =
+            "# Your alt-svc cache. https://curl.se/docs/alt-svc.html\n"
+            "# This file was generated by burl! Edit at your own risk.\n";
+        for(auto const& [o, alts] : entries_)
+        {
+            for(auto const& a : alts)
+            {
+                if(a.expires <= now)
+                    continue;
+                out.append("h1 ");
+                out.append(o.host);
+                out.push_back(' ');
+                out.append(std::to_string(o.port));
+                out.push_back(' ');
+                out.append(protocol_name(a.proto));
+                out.push_back(' ');
+                out.append(a.host);
+                out.push_back(' ');
+                out.append(std::to_string(a.port));
+                out.append(" \"");
+                out.append(format_curl_date(a.expires));
+                out.append(a.persist ? "\" 1 0\n" : "\" 0 0\n");
+            }
+        }
+        return out;
+    }
+
+    /// Remove every expired alternative
+    void
+    prune(time_point now)
+    {
+        for(auto it = entries_.begin(); it != entries_.end();)
+        {
+            std::erase_if(it->second,
+                [now](alternative const& a)
+                {
+                    return a.expires <= now;
+                });
+            if(it->second.empty())
+                it = entries_.erase(it);
+            else
+                ++it;
+        }
+    }
+
+private:
+    struct origin
+    {
+        std::string host;
+        std::uint16_t port;
+
+        auto operator<=>(origin const&) const = default;
+    };
+
+    static
+    bool
+    same(alternative const& a, alternative const& b) noexcept
+    {
+        return a.proto == b.proto && a.port == b.port && a.host == b.host;
+    }
+
+    static
+    std::string_view
+    trim(std::string_view s) noexcept
+    {
+        while(!s.empty() && (s.front() == ' ' || s.front() == '\t' ||
+            s.front() == '\r'))
+            s.remove_prefix(1);
+        while(!s.empty() && (s.back() == ' ' || s.back() == '\t' ||
+            s.back() == '\r'))
+            s.remove_suffix(1);
+        return s;
+    }
+
+    static
+    std::string
+    lower(std::string_view s)
+    {
+        std::string r(s);
+        for(auto& c : r)
+            if(c >= 'A' && c <= 'Z')
+                c = static_cast<char>(c - 'A' + 'a');
+        return r;
+    }
+
+    // Remove and return the text before the next `sep` which
+    // is not inside a quoted string
+    static
+    std::string_view
+    next(std::string_view& s, char sep) noexcept
+    {
+        bool quoted = false;
+        for(std::size_t i = 0; i < s.size(); ++i)
+        {
+            if(s[i] == '"')
+                quoted = !quoted;
+            else if(s[i] == '\\' && quoted)
+                ++i;
+            else if(s[i] == sep && !quoted)
+            {
+                auto const r = s.substr(0, i);
+                s.remove_prefix(i + 1);
+                return r;
+            }
+        }
+        auto const r = s;
+        s = {};
+        return r;
+    }
+
+    // Remove and return the next space separated word
+    static
+    std::string_view
+    word(std::string_view& s) noexcept
+    {
+        s = trim(s);
+        auto const n = (std::min)(s.find_first_of(" \t"), s.size());
+        auto const r = s.substr(0, n);
+        s.remove_prefix(n);
+        return r;
+    }
+
+    static
+    std::string_view
+    unquote(std::string_view s) noexcept
+    {
+        if(s.size() >= 2 && s.front() == '"' && s.back() == '"')
+            return s.substr(1, s.size() - 2);
+        return s;
+    }
+
+    static
+    bool
+    parse_port(std::string_view s, std::uint16_t& port) noexcept
+    {
+        if(s.empty() || s.size() > 5)
+            return false;
+        unsigned n = 0;
+        for(char c : s)
+        {
+            if(c < '0' || c > '9')
+                return false;
+            n = n * 10 + static_cast<unsigned>(c - '0');
+        }
+        if(n == 0 || n > 65535)
+            return false;
+        port = static_cast<std::uint16_t>(n);
+        return true;
+    }
+
+    // ALPN names as written in curl's file
+    static
+    char const*
+    protocol_name(protocol p) noexcept
+    {
+        switch(p)
+        {
+        case proto_h2: return "h2";
+        case proto_h3: return "h3";
+        default: return "h1";
+        }
+    }
+
+    static
+    bool
+    parse_protocol(std::string_view s, protocol& p) noexcept
+    {
+        if(s == "h1" || s == "http/1.1")
+            p = proto_h1;
+        else if(s == "h2")
+            p = proto_h2;
+        else if(s == "h3")
+            p = proto_h3;
+        else
+            return false;
+        return true;
+    }
+
+    // Decode the percent-encoding of a protocol-id
+    static
+    bool
+    percent_decode(std::string_view s, std::string& out)
+    {
+        auto hex = [](char c) -> int
+        {
+            if(c >= '0' && c <= '9') return c - '0';
+            if(c >= 'a' && c <= 'f') return c - 'a' + 10;
+            if(c >= 'A' && c <= 'F') return c - 'A' + 10;
+            return -1;
+        };
+        for(std::size_t i = 0; i < s.size(); ++i)
+        {
+            if(s[i] != '%')
+            {
+                out.push_back(s[i]);
+                continue;
+            }
+            if(i + 2 >= s.size())
+                return false;
+            int const hi = hex(s[i + 1]);
+            int const lo = hex(s[i + 2]);
+            if(hi < 0 || lo < 0)
+                return false;
+            out.push_back(static_cast<char>(hi * 16 + lo));
+            i += 2;
+        }
+        return true;
+    }
+
+    // Parse `protocol-id="[host]:port" *( ";" parameter )`.
+    // `known` is set false for protocols not listed in
+    // `protocol`, which are valid but not kept
+    static
+    bool
+    parse_alternative(
+        std::string_view item,
+        std::string const& origin_host,
+        time_point now,
+        alternative& a,
+        bool& known)
+    {
+        auto head = trim(next(item, ';'));
+        auto const eq = head.find('=');
+        if(eq == std::string_view::npos || eq == 0)
+            return false;
+        std::string id;
+        if(!percent_decode(trim(head.substr(0, eq)), id))
+            return false;
+        known = parse_protocol(id, a.proto) && id != "h1";
+
+        // alt-authority is a quoted string
+        auto auth = trim(head.substr(eq + 1));
+        if(auth.size() < 2 || auth.front() != '"' || auth.back() != '"')
+            return false;
+        auth = auth.substr(1, auth.size() - 2);
+        auto const colon = auth.rfind(':');
+        if( colon == std::string_view::npos ||
+            !parse_port(auth.substr(colon + 1), a.port))
+            return false;
+        auto host = auth.substr(0, colon);
+        if(host.empty())
+            a.host = origin_host;
+        else
+            a.host = lower(host);
+
+        std::uint64_t max_age = 86400;
+        while(!item.empty())
+        {
+            auto const param = trim(next(item, ';'));
+            if(param.empty())
+                continue;
+            auto const peq = param.find('=');
+            if(peq == std::string_view::npos)
+                return false;
+            auto const name = trim(param.substr(0, peq));
+            auto const value = unquote(trim(param.substr(peq + 1)));
+            if(name == "ma")
+            {
+                if(value.empty())
+                    return false;
+                std::uint64_t n = 0;
+                for(char c : value)
+                {
+                    if(c < '0' || c > '9')
+                        return false;
+                    if(n < 0xffffffffffffULL)
+                        n = n * 10 + static_cast<unsigned>(c - '0');
+                }
+                max_age = n;
+            }
+            else if(name == "persist")
+            {
+                a.persist = value == "1";
+            }
+
+            // Unknown parameters are ignored
+        }
+        auto const limit = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::seconds>(
+                time_point::max() - now).count());
+        a.expires = now + std::chrono::seconds(
+            static_cast<std::int64_t>((std::min)(max_age, limit)));
+        return true;
+    }
+
+    std::map<origin, std::vector<alternative>> entries_;
+};
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
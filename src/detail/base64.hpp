@@ -0,0 +1,107 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_BASE64_HPP
+#define BOOST_BURL_SRC_DETAIL_BASE64_HPP
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/** Encode bytes as base64 (RFC 4648), with padding.
+*/
+inline
+std::string
+base64_encode(void const* data, std::size_t n)
+{
+    static constexpr char alphabet[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    auto const* p = static_cast<unsigned char const*>(data);
+    std::string out;
+    out.reserve((n + 2) / 3 * 4);
+    std::size_t i = 0;
+    for(; i + 3 <= n; i += 3)
+    {
+        unsigned const v = (p[i] << 16) | (p[i + 1] << 8) | p[i + 2];
+        out.push_back(alphabet[(v >> 18) & 63]);
+        out.push_back(alphabet[(v >> 12) & 63]);
+        out.push_back(alphabet[(v >> 6) & 63]);
+        out.push_back(alphabet[v & 63]);
+    }
+    if(i < n)
+    {
+        unsigned v = p[i] << 16;
+        if(i + 1 < n)
+            v |= p[i + 1] << 8;
+        out.push_back(alphabet[(v >> 18) & 63]);
+        out.push_back(alphabet[(v >> 12) & 63]);
+        out.push_back(i + 1 < n ? alphabet[(v >> 6) & 63] : '=');
+        out.push_back('=');
+    }
+    return out;
+}
+
+/** Decode base64 (RFC 4648).
+
+    Padding may be left off, as some servers do in digest
+    headers. Any character outside the alphabet, or a length
+    no encoder produces, fails.
+*/
+inline
+std::optional<std::string>
+base64_decode(std::string_view s)
+{
+    while(!s.empty() && s.back() == '=')
+        s.remove_suffix(1);
+    if(s.size() % 4 == 1)
+        return std::nullopt;
+    auto value = [](char c) -> int
+    {
+        if(c >= 'A' && c <= 'Z')
+            return c - 'A';
+        if(c >= 'a' && c <= 'z')
+            return c - 'a' + 26;
+        if(c >= '0' && c <= '9')
+            return c - '0' + 52;
+        if(c == '+')
+            return 62;
+        if(c == '/')
+            return 63;
+        return -1;
+    };
+    std::string out;
+    out.reserve(s.size() * 3 / 4);
+    unsigned v = 0;
+    int bits = 0;
+    for(char c : s)
+    {
+        int const d = value(c);
+        if(d < 0)
+            return std::nullopt;
+        v = (v << 6) | static_cast<unsigned>(d);
+        bits += 6;
+        if(bits >= 8)
+        {
+            bits -= 8;
+            out.push_back(static_cast<char>((v >> bits) & 0xff));
+        }
+    }
+    return out;
+}
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
@@ -0,0 +1,311 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_BODY_DIGEST_HPP
+#define BOOST_BURL_SRC_DETAIL_BODY_DIGEST_HPP
+
+#include "src/detail/base64.hpp"
+#include "src/detail/crc32c.hpp"
+
+#include <openssl/evp.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/** The digest algorithms a body can be checked with.
+*/
+enum class digest_kind
+{
+    sha256,
+    md5,
+    crc32c
+};
+
+/** A digest computed incrementally over a body.
+
+    SHA-256 and MD5 go through OpenSSL's EVP interface, which
+    picks the SHA extensions or AVX2 code paths of the CPU it
+    runs on. CRC-32C uses crc32c().
+*/
+class body_digest
+{
+public:
+    explicit
+    body_digest(digest_kind k)
+        : kind_(k)
+    {
+        if(k == digest_kind::crc32c)
+            return;
+        ctx_ = EVP_MD_CTX_new();
+        EVP_DigestInit_ex(ctx_,
+            k == digest_kind::sha256 ? EVP_sha256() : EVP_md5(),
+            nullptr);
+    }
+
+    body_digest(body_digest&& other) noexcept
+        : kind_(other.kind_)
+        , ctx_(std::exchange(other.ctx_, nullptr))
+        , crc_(other.crc_)
+    {
+    }
+
+    body_digest& operator=(body_digest&&) = delete;
+
+    ~body_digest()
+    {
+        if(ctx_)
+            EVP_MD_CTX_free(ctx_);
+    }
+
+    digest_kind
+    kind() const noexcept
+    {
+        return kind_;
+    }
+
+    /// Add body bytes, in order
+    void
+    update(void const* data, std::size_t n) noexcept
+    {
+        if(ctx_)
+            EVP_DigestUpdate(ctx_, data, n);
+        else
+            crc_ = crc32c(crc_, data, n);
+    }
+
+    /** Return the digest of the bytes so far.
+
+        A CRC-32C is returned as four bytes, most significant
+        first, which is how digest headers carry it. This may
+        be called once.
+    */
+    std::string
+    finish()
+    {
+        if(!ctx_)
+        {
+            std::string s(4, '\0');
+            for(int i = 0; i < 4; ++i)
+                s[i] = static_cast<char>(crc_ >> (24 - 8 * i));
+            return s;
+        }
+        unsigned char md[EVP_MAX_MD_SIZE];
+        unsigned int len = 0;
+        EVP_DigestFinal_ex(ctx_, md, &len);
+        return std::string(reinterpret_cast<char const*>(md), len);
+    }
+
+private:
+    digest_kind kind_;
+    EVP_MD_CTX* ctx_ = nullptr;
+    std::uint32_t crc_ = 0;
+};
+
+//----------------------------------------------------------
+
+/** Decode a hex digest, as printed by sha256sum.
+
+    @return std::nullopt unless every character is a hex digit
+        and there is an even number of them
+*/
+inline
+std::optional<std::string>
+parse_hex_digest(std::string_view s)
+{
+    auto nibble = [](char c) -> int
+    {
+        if(c >= '0' && c <= '9')
+            return c - '0';
+        if(c >= 'a' && c <= 'f')
+            return c - 'a' + 10;
+        if(c >= 'A' && c <= 'F')
+            return c - 'A' + 10;
+        return -1;
+    };
+    if(s.size() % 2 != 0)
+        return std::nullopt;
+    std::string out;
+    out.reserve(s.size() / 2);
+    for(std::size_t i = 0; i < s.size(); i += 2)
+    {
+        int const hi = nibble(s[i]);
+        int const lo = nibble(s[i + 1]);
+        if(hi < 0 || lo < 0)
+            return std::nullopt;
+        out.push_back(static_cast<char>((hi << 4) | lo));
+    }
+    return out;
+}
+
+/** Find the expected digest in a response header.
+
+    Understands:
+
+    @li `Content-Digest` and `Repr-Digest` (RFC 9530), such as
+        `sha-256=:base64:`
+    @li `Digest` (RFC 3230), such as `SHA-256=base64`
+    @li `Content-MD5` (RFC 1864)
+    @li `x-goog-hash`, such as `crc32c=base64`
+
+    @param name The header name, in any case
+    @param value The header value
+
+    @return The digest bytes for `k`, or std::nullopt if the
+        header carries none
+*/
+inline
+std::optional<std::string>
+find_header_digest(
+    digest_kind k,
+    std::string_view name,
+    std::string_view value)
+{
+    auto iequals = [](std::string_view a, std::string_view b)
+    {
+        if(a.size() != b.size())
+            return false;
+        for(std::size_t i = 0; i < a.size(); ++i)
+        {
+            char x = a[i], y = b[i];
+            if(x >= 'A' && x <= 'Z')
+                x = static_cast<char>(x + 32);
+            if(y >= 'A' && y <= 'Z')
+                y = static_cast<char>(y + 32);
+            if(x != y)
+                return false;
+        }
+        return true;
+    };
+    auto trim = [](std::string_view s)
+    {
+        while(!s.empty() && (s.front() == ' ' || s.front() == '\t'))
+            s.remove_prefix(1);
+        while(!s.empty() && (s.back() == ' ' || s.back() == '\t'))
+            s.remove_suffix(1);
+        return s;
+    };
+
+    char const* algo =
+        k == digest_kind::sha256 ? "sha-256" :
+        k == digest_kind::md5 ? "md5" : "crc32c";
+
+    if(iequals(name, "content-md5"))
+    {
+        if(k != digest_kind::md5)
+            return std::nullopt;
+        return base64_decode(trim(value));
+    }
+
+    bool structured;
+    if(iequals(name, "content-digest") || iequals(name, "repr-digest"))
+        structured = true;
+    else if(iequals(name, "digest") || iequals(name, "x-goog-hash"))
+        structured = false;
+    else
+        return std::nullopt;
+
+    // A comma-separated list of algorithm=value
+    while(!value.empty())
+    {
+        auto const comma = value.find(',');
+        auto item = trim(value.substr(0, comma));
+        value = comma == std::string_view::npos ?
+            std::string_view() : value.substr(comma + 1);
+        auto const eq = item.find('=');
+        if(eq == std::string_view::npos ||
+            !iequals(trim(item.substr(0, eq)), algo))
+            continue;
+        auto v = trim(item.substr(eq + 1));
+        if(structured)
+        {
+            // A byte sequence is base64 between colons
+            if(v.size() < 2 || v.front() != ':' || v.back() != ':')
+                return std::nullopt;
+            v = v.substr(1, v.size() - 2);
+        }
+        return base64_decode(v);
+    }
+    return std::nullopt;
+}
+
+//----------------------------------------------------------
+
+/** Checks a body against the digests it is expected to have.
+
+    Expected values come from the caller and from response
+    headers; every one must match. With none at all, the
+    check passes only if it was not required.
+*/
+class digest_check_state
+{
+public:
+    digest_check_state(digest_kind k, bool required)
+        : digest_(k)
+        , required_(required)
+    {
+    }
+
+    /// Add an expected digest, in raw bytes
+    void
+    expect(std::string d)
+    {
+        expected_.push_back(std::move(d));
+    }
+
+    /// Look for an expected digest in a response header
+    void
+    on_header(std::string_view name, std::string_view value)
+    {
+        if(auto d = find_header_digest(digest_.kind(), name, value))
+            expected_.push_back(std::move(*d));
+    }
+
+    /// Add body bytes, as they arrive
+    void
+    update(void const* data, std::size_t n) noexcept
+    {
+        digest_.update(data, n);
+    }
+
+    /** Return true if the body matched.
+
+        Call once, after the last byte.
+    */
+    bool
+    verify()
+    {
+        if(expected_.empty())
+            return !required_;
+        auto const d = digest_.finish();
+        for(auto const& e : expected_)
+            if(e != d)
+                return false;
+        return true;
+    }
+
+private:
+    body_digest digest_;
+    std::vector<std::string> expected_;
+    bool required_;
+};
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
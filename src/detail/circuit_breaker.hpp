@@ -0,0 +1,251 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_CIRCUIT_BREAKER_HPP
+#define BOOST_BURL_SRC_DETAIL_CIRCUIT_BREAKER_HPP
+
+#include <boost/burl/options.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/** A circuit breaker for one origin.
+
+    @li Closed: requests pass. Outcomes are counted in a
+        rolling window of buckets; when at least
+        `minimum_requests` were seen and the failure ratio
+        reaches `failure_ratio`, the circuit opens.
+
+    @li Open: requests are refused until `open_duration` has
+        passed, then the circuit is half-open.
+
+    @li Half-open: up to `half_open_probes` requests pass at
+        once. Any failure opens the circuit again; when that
+        many probes have succeeded it closes with an empty
+        window.
+
+    Each admitted request is given a @ref permit, which must
+    be handed back with its outcome. Permits carry the
+    generation they were issued in, which changes with every
+    state change, so results and abandons of requests started
+    in an earlier period, such as a probe from a previous
+    half-open period, are ignored.
+*/
+class circuit_breaker
+{
+public:
+    using clock_type = std::chrono::steady_clock;
+    using time_point = clock_type::time_point;
+
+    enum class state
+    {
+        closed,
+        open,
+        half_open
+    };
+
+    /// Whether a request may start
+    enum class admission
+    {
+        /// The request must fail with error::circuit_open
+        denied,
+
+        /// The request may start
+        allowed,
+
+        /// The request may start and is a half-open probe
+        probe
+    };
+
+    /// The result of asking to start a request
+    struct permit
+    {
+        admission kind = admission::denied;
+
+        /// The state period the permit was issued in
+        std::uint64_t generation = 0;
+    };
+
+    explicit
+    circuit_breaker(circuit_breaker_config const& cfg) noexcept
+        : cfg_(cfg)
+    {
+        auto const w = cfg_.window / buckets;
+        width_ = w.count() > 0 ? w : clock_type::duration(1);
+    }
+
+    /// Return the current state, as of the last call
+    state
+    current() const noexcept
+    {
+        return state_;
+    }
+
+    /** Ask to start a request.
+    */
+    permit
+    allow(time_point now) noexcept
+    {
+        if(state_ == state::open)
+        {
+            if(now < open_until_)
+                return {admission::denied, generation_};
+            enter(state::half_open);
+            probes_ = 0;
+            successes_ = 0;
+        }
+        if(state_ == state::closed)
+            return {admission::allowed, generation_};
+        if(probes_ >= probe_limit())
+            return {admission::denied, generation_};
+        ++probes_;
+        return {admission::probe, generation_};
+    }
+
+    /** Record the outcome of a request.
+
+        @param p The permit returned when it started
+        @param failed Whether it failed
+        @param now The current time
+    */
+    void
+    on_result(permit p, bool failed, time_point now) noexcept
+    {
+        if( p.kind == admission::denied ||
+            p.generation != generation_)
+            return;
+        if(p.kind == admission::probe)
+        {
+            // Only probes of this half-open period match the
+            // generation, and each was counted in probes_
+            --probes_;
+            if(failed)
+            {
+                trip(now);
+                return;
+            }
+            if(++successes_ >= probe_limit())
+                close();
+            return;
+        }
+        auto& b = bucket_at(now);
+        ++b.total;
+        if(failed)
+            ++b.failures;
+        if(should_trip(now))
+            trip(now);
+    }
+
+    /** Release a permit for a request which was never sent.
+
+        Nothing is recorded, but a probe slot of the current
+        half-open period is freed.
+    */
+    void
+    abandon(permit p) noexcept
+    {
+        if( p.kind == admission::probe &&
+            p.generation == generation_)
+            --probes_;
+    }
+
+private:
+    static constexpr std::size_t buckets = 10;
+
+    struct bucket
+    {
+        std::int64_t index = -1;
+        std::size_t total = 0;
+        std::size_t failures = 0;
+    };
+
+    std::size_t
+    probe_limit() const noexcept
+    {
+        return cfg_.half_open_probes ? cfg_.half_open_probes : 1;
+    }
+
+    std::int64_t
+    index_of(time_point now) const noexcept
+    {
+        return now.time_since_epoch() / width_;
+    }
+
+    bucket&
+    bucket_at(time_point now) noexcept
+    {
+        auto const i = index_of(now);
+        auto& b = window_[static_cast<std::size_t>(i) % buckets];
+        if(b.index != i)
+            b = bucket{i, 0, 0};
+        return b;
+    }
+
+    bool
+    should_trip(time_point now) const noexcept
+    {
+        auto const oldest = index_of(now) -
+            static_cast<std::int64_t>(buckets) + 1;
+        std::size_t total = 0;
+        std::size_t failures = 0;
+        for(auto const& b : window_)
+        {
+            if(b.index < oldest)
+                continue;
+            total += b.total;
+            failures += b.failures;
+        }
+        if(total == 0 || total < cfg_.minimum_requests)
+            return false;
+        return static_cast<double>(failures) >=
+            cfg_.failure_ratio * static_cast<double>(total);
+    }
+
+    void
+    enter(state st) noexcept
+    {
+        state_ = st;
+        ++generation_;
+    }
+
+    void
+    trip(time_point now) noexcept
+    {
+        enter(state::open);
+        open_until_ = now + cfg_.open_duration;
+    }
+
+    void
+    close() noexcept
+    {
+        enter(state::closed);
+        window_ = {};
+    }
+
+    circuit_breaker_config cfg_;
+    clock_type::duration width_;
+    std::array<bucket, buckets> window_{};
+    state state_ = state::closed;
+    time_point open_until_{};
+    std::size_t probes_ = 0;
+    std::size_t successes_ = 0;
+    std::uint64_t generation_ = 0;
+};
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
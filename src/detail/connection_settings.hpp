@@ -0,0 +1,110 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_CONNECTION_SETTINGS_HPP
+#define BOOST_BURL_SRC_DETAIL_CONNECTION_SETTINGS_HPP
+
+#include <boost/burl/options.hpp>
+
+#include "src/detail/alt_svc_cache.hpp"
+#include "src/detail/resolve_table.hpp"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/** Return what a connection must match to be reused.
+
+    The sessions of a share draw on the same pools and TLS
+    sessions, but each may verify certificates differently,
+    route a host elsewhere, or set other socket options. A
+    connection opened, or a TLS session negotiated, under one
+    set of these must not serve a request made under another;
+    a session which verifies could otherwise be handed a
+    connection opened with verification off, or one pinned to
+    another address.
+
+    The result is compared rather than hashed, so different
+    settings never collide. Every field is length-prefixed.
+    Verification only matters for HTTPS, so plain connections
+    are shared whatever it is.
+
+    @param https Whether the connection uses TLS
+    @param verify The verification in effect for the request
+    @param target Where the host is reached, after connect overrides
+    @param pinned Fixed addresses for the target, or null for DNS
+    @param alt The alternative service used, or null
+    @param so The socket options for the origin
+*/
+inline
+std::string
+connection_settings(
+    bool https,
+    verify_config const& verify,
+    resolve_table::target const& target,
+    std::vector<std::string> const* pinned,
+    alt_svc_cache::alternative const* alt,
+    socket_options const& so)
+{
+    std::string s;
+    auto str = [&](std::string_view v)
+    {
+        s += std::to_string(v.size());
+        s += ':';
+        s.append(v);
+    };
+    auto num = [&](std::uint64_t v)
+    {
+        str(std::to_string(v));
+    };
+
+    if(https)
+    {
+        num(verify.verify_peer);
+        str(verify.ca_file);
+        str(verify.ca_path);
+        str(verify.hostname);
+    }
+
+    str(target.host);
+    num(target.port);
+    num(pinned ? pinned->size() + 1 : 0);
+    if(pinned)
+        for(auto const& a : *pinned)
+            str(a);
+
+    num(alt ? static_cast<std::uint64_t>(alt->proto) : 0);
+    if(alt)
+    {
+        str(alt->host);
+        num(alt->port);
+    }
+
+    num(so.tcp_nodelay);
+    num(so.tcp_fastopen);
+    num(so.keepalive);
+    num(static_cast<std::uint64_t>(so.keepalive_idle.count()));
+    num(static_cast<std::uint64_t>(so.keepalive_interval.count()));
+    num(so.keepalive_count);
+    num(so.receive_buffer);
+    num(so.send_buffer);
+    num(so.bind_address_no_port);
+    return s;
+}
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
@@ -0,0 +1,153 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_CONTINUE_WAIT_HPP
+#define BOOST_BURL_SRC_DETAIL_CONTINUE_WAIT_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/** Decides when to send the body of an `Expect: 100-continue` request.
+
+    After the request head is written the body is held back
+    until the server answers 100 Continue, or the wait times
+    out, since servers which ignore the expectation never
+    answer it (RFC 9110 section 10.1.1). A final response
+    before that means the server does not want the body, so
+    it is never sent; this is what saves the upload when a
+    request is refused with 401 or 413.
+*/
+class continue_wait
+{
+public:
+    using clock_type = std::chrono::steady_clock;
+    using time_point = clock_type::time_point;
+
+    enum class action
+    {
+        /// Keep waiting for a response
+        wait,
+
+        /// Send the body now
+        send_body,
+
+        /// A final response arrived; do not send the body
+        skip_body
+    };
+
+    /** Return true if a request should carry the expectation.
+
+        @param body_size The body's length, or `std::nullopt`
+            if it is not known in advance
+        @param threshold The smallest body worth waiting for
+    */
+    static
+    bool
+    should_expect(
+        std::optional<std::uint64_t> body_size,
+        std::uint64_t threshold) noexcept
+    {
+        if(!body_size)
+            return true;
+        return *body_size > 0 && *body_size >= threshold;
+    }
+
+    /** Called once the request head is written.
+
+        @param deadline When to send the body without an answer
+    */
+    void
+    start(time_point deadline) noexcept
+    {
+        waiting_ = true;
+        deadline_ = deadline;
+    }
+
+    /// Return true while the body is held back
+    bool
+    waiting() const noexcept
+    {
+        return waiting_;
+    }
+
+    /// Return when the wait ends without an answer
+    time_point
+    deadline() const noexcept
+    {
+        return deadline_;
+    }
+
+    /** Called for each interim (1xx) response.
+
+        100 Continue releases the body; other interim
+        responses, such as 103 Early Hints, do not.
+    */
+    action
+    on_interim(unsigned status) noexcept
+    {
+        if(!waiting_)
+            return action::send_body;
+        if(status != 100)
+            return action::wait;
+        waiting_ = false;
+        return action::send_body;
+    }
+
+    /** Called when a final response arrives while waiting.
+
+        A 417 (Expectation Failed) means the server will not
+        accept the expectation; the request should be sent
+        again without it.
+    */
+    action
+    on_final(unsigned status) noexcept
+    {
+        if(!waiting_)
+            return action::send_body;
+        waiting_ = false;
+        retry_ = status == 417;
+        return action::skip_body;
+    }
+
+    /** Called when the wait timer fires.
+    */
+    action
+    on_timer(time_point now) noexcept
+    {
+        if(!waiting_)
+            return action::send_body;
+        if(now < deadline_)
+            return action::wait;
+        waiting_ = false;
+        return action::send_body;
+    }
+
+    /// Return true if the request must be repeated without the expectation
+    bool
+    retry_without_expect() const noexcept
+    {
+        return retry_;
+    }
+
+private:
+    time_point deadline_;
+    bool waiting_ = false;
+    bool retry_ = false;
+};
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
@@ -0,0 +1,144 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_COW_HPP
+#define BOOST_BURL_SRC_DETAIL_COW_HPP
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/** A value shared between copies until one changes it.
+
+    Copying is a reference count increment. The first call
+    to @ref write on a shared value gives that copy a value
+    of its own; later writes go straight to it.
+
+    A reference from @ref lend may be kept and written
+    through until the matching @ref unlend, so until then
+    the value is not shared: copies of it are deep copies.
+
+    Copies must not be used from more than one thread at a
+    time, as the sharing check is not synchronized with
+    concurrent writers.
+*/
+template<class T>
+class cow
+{
+public:
+    /// Constructor
+    cow()
+        : p_(std::make_shared<T>())
+    {
+    }
+
+    /// Constructor
+    explicit
+    cow(T t)
+        : p_(std::make_shared<T>(std::move(t)))
+    {
+    }
+
+    /** Constructor.
+
+        Shares the value, unless it is lent, in which case
+        the copy gets a value of its own.
+    */
+    cow(cow const& other)
+        : p_(other.lent_ ?
+            std::make_shared<T>(*other.p_) : other.p_)
+    {
+    }
+
+    /// Assignment, sharing as the copy constructor does
+    cow&
+    operator=(cow const& other)
+    {
+        p_ = other.lent_ ?
+            std::make_shared<T>(*other.p_) : other.p_;
+        return *this;
+    }
+
+    cow(cow&&) = default;
+    cow& operator=(cow&&) = default;
+
+    /// Return the value for reading
+    T const&
+    get() const noexcept
+    {
+        return *p_;
+    }
+
+    T const&
+    operator*() const noexcept
+    {
+        return *p_;
+    }
+
+    T const*
+    operator->() const noexcept
+    {
+        return p_.get();
+    }
+
+    /** Return the value for writing.
+
+        If other copies share the value, it is copied first.
+    */
+    T&
+    write()
+    {
+        if(p_.use_count() != 1)
+            p_ = std::make_shared<T>(*p_);
+        return *p_;
+    }
+
+    /** Return the value for writing, for a caller which
+        keeps the reference for a while.
+
+        Like @ref write, but the value is not shared again
+        until a matching call to @ref unlend, so writes
+        through the reference reach this copy only.
+    */
+    T&
+    lend()
+    {
+        auto& v = write();
+        ++lent_;
+        return v;
+    }
+
+    /// End a @ref lend, so that copies share the value again
+    void
+    unlend() noexcept
+    {
+        --lent_;
+    }
+
+    /// Return true if other copies share the value
+    bool
+    shared() const noexcept
+    {
+        return p_.use_count() != 1;
+    }
+
+private:
+    std::shared_ptr<T> p_;
+    std::size_t lent_ = 0;
+};
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
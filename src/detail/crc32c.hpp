@@ -0,0 +1,208 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_CRC32C_HPP
+#define BOOST_BURL_SRC_DETAIL_CRC32C_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+# if defined(_MSC_VER) && !defined(__clang__)
+#  include <intrin.h>
+#  include <nmmintrin.h>
+#  define BOOST_BURL_CRC32C_SSE42_MSVC
+# elif defined(__GNUC__) || defined(__clang__)
+#  include <nmmintrin.h>
+#  define BOOST_BURL_CRC32C_SSE42_GNU
+# endif
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+# include <arm_acle.h>
+# define BOOST_BURL_CRC32C_ARM
+#endif
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/*  CRC-32C (Castagnoli), as used by iSCSI, ext4 and cloud
+    object stores.
+
+    x86-64 has an instruction for it in SSE 4.2, which is
+    checked for at run time since the library is not built
+    for a particular CPU; ARMv8 has one when the compiler
+    targets the CRC extension. Otherwise a table-driven
+    version handles eight bytes per step.
+*/
+
+struct crc32c_tables
+{
+    std::uint32_t t[8][256];
+
+    constexpr
+    crc32c_tables() noexcept
+        : t{}
+    {
+        for(std::uint32_t i = 0; i < 256; ++i)
+        {
+            std::uint32_t c = i;
+            for(int k = 0; k < 8; ++k)
+                c = (c >> 1) ^ (0x82f63b78u & (0u - (c & 1)));
+            t[0][i] = c;
+        }
+        for(std::uint32_t i = 0; i < 256; ++i)
+            for(int k = 1; k < 8; ++k)
+                t[k][i] = (t[k - 1][i] >> 8) ^ t[0][t[k - 1][i] & 0xff];
+    }
+};
+
+inline constexpr crc32c_tables crc32c_table{};
+
+inline
+std::uint32_t
+crc32c_sw(
+    std::uint32_t c,
+    unsigned char const* p,
+    std::size_t n) noexcept
+{
+    auto const& t = crc32c_table.t;
+    for(; n >= 8; n -= 8, p += 8)
+    {
+        // The tables assume little-endian words; assembling
+        // them bytewise keeps this right everywhere
+        std::uint32_t const lo = c ^ (
+            std::uint32_t(p[0]) |
+            (std::uint32_t(p[1]) << 8) |
+            (std::uint32_t(p[2]) << 16) |
+            (std::uint32_t(p[3]) << 24));
+        c = t[7][lo & 0xff] ^ t[6][(lo >> 8) & 0xff] ^
+            t[5][(lo >> 16) & 0xff] ^ t[4][lo >> 24] ^
+            t[3][p[4]] ^ t[2][p[5]] ^ t[1][p[6]] ^ t[0][p[7]];
+    }
+    for(; n > 0; --n, ++p)
+        c = (c >> 8) ^ t[0][(c ^ *p) & 0xff];
+    return c;
+}
+
+#if defined(BOOST_BURL_CRC32C_SSE42_GNU) || defined(BOOST_BURL_CRC32C_SSE42_MSVC)
+
+#ifdef BOOST_BURL_CRC32C_SSE42_GNU
+__attribute__((target("sse4.2")))
+#endif
+inline
+std::uint32_t
+crc32c_hw(
+    std::uint32_t c,
+    unsigned char const* p,
+    std::size_t n) noexcept
+{
+    std::uint64_t c64 = c;
+    for(; n >= 8; n -= 8, p += 8)
+    {
+        std::uint64_t w;
+        std::memcpy(&w, p, 8);
+        c64 = _mm_crc32_u64(c64, w);
+    }
+    c = static_cast<std::uint32_t>(c64);
+    for(; n > 0; --n, ++p)
+        c = _mm_crc32_u8(c, *p);
+    return c;
+}
+
+inline
+bool
+crc32c_hw_supported() noexcept
+{
+#ifdef BOOST_BURL_CRC32C_SSE42_GNU
+    static bool const b = __builtin_cpu_supports("sse4.2");
+#else
+    static bool const b = []
+    {
+        int r[4];
+        __cpuid(r, 1);
+        return (r[2] & (1 << 20)) != 0;
+    }();
+#endif
+    return b;
+}
+
+#elif defined(BOOST_BURL_CRC32C_ARM)
+
+inline
+std::uint32_t
+crc32c_hw(
+    std::uint32_t c,
+    unsigned char const* p,
+    std::size_t n) noexcept
+{
+    for(; n >= 8; n -= 8, p += 8)
+    {
+        std::uint64_t w;
+        std::memcpy(&w, p, 8);
+        c = __crc32cd(c, w);
+    }
+    for(; n > 0; --n, ++p)
+        c = __crc32cb(c, *p);
+    return c;
+}
+
+inline
+bool
+crc32c_hw_supported() noexcept
+{
+    return true;
+}
+
+#else
+
+inline
+std::uint32_t
+crc32c_hw(
+    std::uint32_t c,
+    unsigned char const* p,
+    std::size_t n) noexcept
+{
+    return crc32c_sw(c, p, n);
+}
+
+inline
+bool
+crc32c_hw_supported() noexcept
+{
+    return false;
+}
+
+#endif
+
+/** Extend a CRC-32C over more bytes.
+
+    @param crc The CRC of the bytes before, or 0 to start
+*/
+inline
+std::uint32_t
+crc32c(
+    std::uint32_t crc,
+    void const* data,
+    std::size_t n) noexcept
+{
+    auto const* p = static_cast<unsigned char const*>(data);
+    crc = ~crc;
+    crc = crc32c_hw_supported() ?
+        crc32c_hw(crc, p, n) :
+        crc32c_sw(crc, p, n);
+    return ~crc;
+}
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
@@ -0,0 +1,101 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_CURL_DATE_HPP
+#define BOOST_BURL_SRC_DETAIL_CURL_DATE_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/*  Expiry times in curl's cache files
+
+    curl's HSTS and Alt-Svc files write times in UTC as
+    "YYYYMMDD HH:MM:SS", or "unlimited" for no expiry, which
+    is read as time_point::max().
+*/
+
+/** Parse a time from a curl cache file.
+
+    @return false if `s` is not a valid time
+*/
+inline
+bool
+parse_curl_date(
+    std::string_view s,
+    std::chrono::system_clock::time_point& t)
+{
+    using namespace std::chrono;
+    if(s == "unlimited")
+    {
+        t = system_clock::time_point::max();
+        return true;
+    }
+    if(s.size() != 17 || s[8] != ' ' || s[11] != ':' || s[14] != ':')
+        return false;
+    auto num = [&](std::size_t pos, std::size_t len, int& out)
+    {
+        out = 0;
+        for(std::size_t i = pos; i < pos + len; ++i)
+        {
+            if(s[i] < '0' || s[i] > '9')
+                return false;
+            out = out * 10 + (s[i] - '0');
+        }
+        return true;
+    };
+    int y, mo, d, h, mi, se;
+    if( !num(0, 4, y) || !num(4, 2, mo) || !num(6, 2, d) ||
+        !num(9, 2, h) || !num(12, 2, mi) || !num(15, 2, se))
+        return false;
+    year_month_day const ymd{
+        year(y), month(static_cast<unsigned>(mo)),
+        day(static_cast<unsigned>(d))};
+    if(!ymd.ok() || h > 23 || mi > 59 || se > 60)
+        return false;
+    t = system_clock::time_point(sys_days(ymd)) +
+        hours(h) + minutes(mi) + seconds(se);
+    return true;
+}
+
+/** Format a time for a curl cache file.
+*/
+inline
+std::string
+format_curl_date(std::chrono::system_clock::time_point t)
+{
+    using namespace std::chrono;
+    if(t == system_clock::time_point::max())
+        return "unlimited";
+    auto const dp = floor<days>(t);
+    year_month_day const ymd(dp);
+    hh_mm_ss<seconds> const hms(floor<seconds>(t - dp));
+    char buf[32];
+    std::snprintf(buf, sizeof(buf),
+        "%04d%02u%02u %02d:%02d:%02d",
+        static_cast<int>(ymd.year()),
+        static_cast<unsigned>(ymd.month()),
+        static_cast<unsigned>(ymd.day()),
+        static_cast<int>(hms.hours().count()),
+        static_cast<int>(hms.minutes().count()),
+        static_cast<int>(hms.seconds().count()));
+    return buf;
+}
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
@@ -0,0 +1,302 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_ENDPOINT_SET_HPP
+#define BOOST_BURL_SRC_DETAIL_ENDPOINT_SET_HPP
+
+#include <boost/burl/options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <vector>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/** The resolved addresses of one host, with load statistics.
+
+    Each address is tracked as an endpoint: the requests in
+    flight to it, a moving average of its latency, and its
+    recent failures. @ref acquire chooses an endpoint for a
+    new request according to the @ref load_balancing policy,
+    skipping endpoints which are currently ejected.
+
+    @tparam Endpoint The address type, compared with `==`
+*/
+template<class Endpoint>
+class endpoint_set
+{
+public:
+    using clock_type = std::chrono::steady_clock;
+    using time_point = clock_type::time_point;
+    using duration = std::chrono::nanoseconds;
+
+    explicit
+    endpoint_set(
+        load_balancing const& cfg,
+        std::uint32_t seed = std::minstd_rand::default_seed)
+        : cfg_(cfg)
+        , rng_(seed)
+    {
+    }
+
+    /** Replace the addresses, as after a new resolution.
+
+        Statistics are kept for addresses which remain.
+        Completions for removed addresses are ignored.
+    */
+    void
+    assign(std::vector<Endpoint> const& eps)
+    {
+        std::vector<stats> next;
+        next.reserve(eps.size());
+        for(auto const& ep : eps)
+        {
+            auto it = find(ep);
+            if(it != eps_.end())
+                next.push_back(*it);
+            else
+                next.push_back(stats{ep});
+        }
+        eps_ = std::move(next);
+    }
+
+    /// Return the number of addresses
+    std::size_t
+    size() const noexcept
+    {
+        return eps_.size();
+    }
+
+    /** Choose an endpoint for a new request.
+
+        The chosen endpoint's count of requests in flight is
+        incremented; the caller must call @ref release when
+        the request completes.
+
+        @return The endpoint, or `std::nullopt` if there are none
+    */
+    std::optional<Endpoint>
+    acquire(time_point now)
+    {
+        if(eps_.empty())
+            return std::nullopt;
+        candidates_.clear();
+        for(std::size_t i = 0; i < eps_.size(); ++i)
+            if(!eps_[i].is_ejected(now))
+                candidates_.push_back(i);
+
+        // Everything ejected: better any endpoint than none
+        if(candidates_.empty())
+            for(std::size_t i = 0; i < eps_.size(); ++i)
+                candidates_.push_back(i);
+
+        auto& s = eps_[choose()];
+        ++s.outstanding;
+        return s.ep;
+    }
+
+    /** Record the completion of a request.
+
+        @param ep The endpoint returned by @ref acquire
+        @param rtt The time the request took
+        @param failed Whether it failed
+        @param now The current time
+    */
+    void
+    release(
+        Endpoint const& ep,
+        duration rtt,
+        bool failed,
+        time_point now)
+    {
+        auto it = find(ep);
+        if(it == eps_.end())
+            return;
+        auto& s = *it;
+        if(s.outstanding > 0)
+            --s.outstanding;
+        if(failed)
+        {
+            if( cfg_.consecutive_failures != 0 &&
+                ++s.consecutive >= cfg_.consecutive_failures)
+                eject(s, now);
+            return;
+        }
+        s.consecutive = 0;
+        auto const r = static_cast<double>(rtt.count());
+        s.rtt = s.completed == 0 ? r :
+            s.rtt * (1 - rtt_alpha) + r * rtt_alpha;
+        ++s.completed;
+
+        // A clean run after the last ejection forgives it
+        if( s.ejections > 0 &&
+            now >= s.ejected_until + cfg_.max_ejection_time)
+            s.ejections = 0;
+
+        if(is_slow(s))
+            eject(s, now);
+    }
+
+    /// Return true if an endpoint is ejected
+    bool
+    ejected(Endpoint const& ep, time_point now) const
+    {
+        auto it = find(ep);
+        return it != eps_.end() && it->is_ejected(now);
+    }
+
+    /// Return the number of requests in flight to an endpoint
+    std::size_t
+    outstanding(Endpoint const& ep) const
+    {
+        auto it = find(ep);
+        return it == eps_.end() ? 0 : it->outstanding;
+    }
+
+private:
+    // Weight of a new sample in the latency average
+    static constexpr double rtt_alpha = 0.2;
+
+    struct stats
+    {
+        Endpoint ep;
+        std::size_t outstanding = 0;
+        std::size_t consecutive = 0;    // failures in a row
+        std::size_t completed = 0;      // since the last ejection
+        double rtt = 0;                 // nanoseconds
+        time_point ejected_until{};
+        unsigned ejections = 0;
+
+        bool
+        is_ejected(time_point now) const noexcept
+        {
+            return now < ejected_until;
+        }
+    };
+
+    using iterator = typename std::vector<stats>::iterator;
+    using const_iterator = typename std::vector<stats>::const_iterator;
+
+    iterator
+    find(Endpoint const& ep)
+    {
+        return std::find_if(eps_.begin(), eps_.end(),
+            [&](stats const& s) { return s.ep == ep; });
+    }
+
+    const_iterator
+    find(Endpoint const& ep) const
+    {
+        return std::find_if(eps_.begin(), eps_.end(),
+            [&](stats const& s) { return s.ep == ep; });
+    }
+
+    // True if `a` is the better choice
+    static
+    bool
+    better(stats const& a, stats const& b) noexcept
+    {
+        if(a.outstanding != b.outstanding)
+            return a.outstanding < b.outstanding;
+        return a.rtt < b.rtt;
+    }
+
+    std::size_t
+    choose()
+    {
+        auto const n = candidates_.size();
+        if(n == 1)
+            return candidates_[0];
+        if(cfg_.algo == load_balancing::policy::power_of_two)
+        {
+            std::uniform_int_distribution<std::size_t> d(0, n - 1);
+            auto const i = d(rng_);
+            auto j = d(rng_);
+            if(j == i)
+                j = (i + 1) % n;
+            auto const a = candidates_[i];
+            auto const b = candidates_[j];
+            return better(eps_[b], eps_[a]) ? b : a;
+        }
+
+        // Start the scan at a rotating offset so that ties
+        // are spread across endpoints
+        auto const start = next_++ % n;
+        auto best = candidates_[start];
+        for(std::size_t k = 1; k < n; ++k)
+        {
+            auto const c = candidates_[(start + k) % n];
+            if(better(eps_[c], eps_[best]))
+                best = c;
+        }
+        return best;
+    }
+
+    // True if an endpoint's latency is far above its peers'
+    bool
+    is_slow(stats const& s)
+    {
+        if( cfg_.latency_ratio <= 0 ||
+            s.completed < cfg_.minimum_requests)
+            return false;
+        samples_.clear();
+        for(auto const& e : eps_)
+            if(e.completed >= cfg_.minimum_requests)
+                samples_.push_back(e.rtt);
+
+        // A median of fewer than three says little
+        if(samples_.size() < 3)
+            return false;
+        auto mid = samples_.begin() + samples_.size() / 2;
+        std::nth_element(samples_.begin(), mid, samples_.end());
+        return s.rtt > cfg_.latency_ratio * *mid;
+    }
+
+    void
+    eject(stats& s, time_point now)
+    {
+        std::size_t ejected = 0;
+        for(auto const& e : eps_)
+            if(e.is_ejected(now))
+                ++ejected;
+        if((ejected + 1) * 100 >
+                cfg_.max_ejection_percent * eps_.size())
+            return;
+
+        ++s.ejections;
+        auto const t = (std::min)(
+            cfg_.base_ejection_time * s.ejections,
+            cfg_.max_ejection_time);
+        s.ejected_until = now + t;
+
+        // Judge it afresh when it returns
+        s.consecutive = 0;
+        s.completed = 0;
+        s.rtt = 0;
+    }
+
+    load_balancing cfg_;
+    std::minstd_rand rng_;
+    std::vector<stats> eps_;
+    std::vector<std::size_t> candidates_;
+    std::vector<double> samples_;
+    std::size_t next_ = 0;
+};
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
@@ -0,0 +1,170 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_EXCHANGE_STATE_HPP
+#define BOOST_BURL_SRC_DETAIL_EXCHANGE_STATE_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/** Tracks how far a connection is through an exchange.
+
+    When a request is cancelled, this decides whether its
+    connection can go back to the pool. That is only safe
+    when the stream is at a message boundary: nothing of the
+    request has been written, or the whole response has been
+    read. Anywhere in between, the peer and the parser would
+    disagree about where the next message starts, so the
+    connection must be closed.
+*/
+class exchange_state
+{
+public:
+    enum class phase
+    {
+        /// Resolving, connecting or in the TLS handshake
+        connecting,
+
+        /// Connected, with no exchange under way
+        idle,
+
+        /// Part of the request has been written
+        sending,
+
+        /// The request is written; no response bytes yet
+        awaiting,
+
+        /// Part of the response has been read
+        receiving,
+
+        /// The response has been read in full
+        complete
+    };
+
+    /// Return the current phase
+    phase
+    current() const noexcept
+    {
+        return phase_;
+    }
+
+    /// Called when the connection is established
+    void
+    on_connected() noexcept
+    {
+        phase_ = phase::idle;
+        sent_ = 0;
+        received_ = 0;
+        truncated_ = false;
+    }
+
+    /// Called when `n` bytes of the request are written
+    void
+    on_send(std::size_t n) noexcept
+    {
+        if(n == 0)
+            return;
+        if(reusable())
+        {
+            // A new exchange on this connection
+            sent_ = 0;
+            received_ = 0;
+        }
+        sent_ += n;
+        phase_ = phase::sending;
+    }
+
+    /// Called when the request is written in full
+    void
+    on_sent() noexcept
+    {
+        phase_ = phase::awaiting;
+    }
+
+    /// Called when `n` bytes of the response are read
+    void
+    on_receive(std::size_t n) noexcept
+    {
+        if(n == 0)
+            return;
+        received_ += n;
+        phase_ = phase::receiving;
+    }
+
+    /** Called when the rest of the request will not be sent.
+
+        This happens when the server answers a request sent
+        with `Expect: 100-continue` before its body. The peer
+        is then waiting for bytes which never come, so the
+        connection is not reusable even once the response is
+        read.
+    */
+    void
+    on_truncated() noexcept
+    {
+        truncated_ = true;
+    }
+
+    /** Called when the response is read in full.
+
+        The next call to @ref on_send starts a new exchange.
+    */
+    void
+    on_complete() noexcept
+    {
+        phase_ = phase::complete;
+    }
+
+    /** Return true if the connection may be reused.
+
+        A connection which is still connecting has no usable
+        stream yet, and one stopped mid-message is out of step
+        with its peer, as is one whose request body was
+        never sent.
+    */
+    bool
+    reusable() const noexcept
+    {
+        if(truncated_)
+            return false;
+        return
+            phase_ == phase::idle ||
+            phase_ == phase::complete;
+    }
+
+    /// Return the request bytes written in this exchange
+    std::uint64_t
+    sent() const noexcept
+    {
+        return sent_;
+    }
+
+    /// Return the response bytes read in this exchange
+    std::uint64_t
+    received() const noexcept
+    {
+        return received_;
+    }
+
+private:
+    phase phase_ = phase::connecting;
+    std::uint64_t sent_ = 0;
+    std::uint64_t received_ = 0;
+    bool truncated_ = false;
+};
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
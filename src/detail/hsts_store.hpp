@@ -0,0 +1,378 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_HSTS_STORE_HPP
+#define BOOST_BURL_SRC_DETAIL_HSTS_STORE_HPP
+
+#include "src/detail/curl_date.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/** Hosts which must only be reached over HTTPS (RFC 6797).
+
+    Entries are kept in one vector sorted by the host name
+    spelled backwards, so "www.example.com" is stored as
+    "moc.elpmaxe.www". A domain's entry is then a prefix of
+    the key of every host below it, and looking a host up
+    takes one binary search per label.
+
+    The text form is curl's HSTS file: one host per line and
+    its expiry in UTC as "YYYYMMDD HH:MM:SS", with a leading
+    dot on the host when the policy covers subdomains.
+*/
+class hsts_store
+{
+public:
+    using clock_type = std::chrono::system_clock;
+    using time_point = clock_type::time_point;
+
+    /// The policy for a host
+    struct entry
+    {
+        time_point expires;
+        bool include_subdomains = false;
+    };
+
+    /// Return the number of entries, expired ones included
+    std::size_t
+    size() const noexcept
+    {
+        return entries_.size();
+    }
+
+    /** Record a Strict-Transport-Security header.
+
+        Only call this for responses received over a secure
+        connection. Headers naming an IP address, and invalid
+        headers, are ignored. A max-age of zero removes the
+        host's entry.
+
+        @return true if the header was valid
+    */
+    bool
+    update(
+        std::string_view host,
+        std::string_view value,
+        time_point now)
+    {
+        auto const key = make_key(host);
+        if(key.empty() || is_ip_literal(host))
+            return false;
+        std::uint64_t max_age = 0;
+        bool have_max_age = false;
+        bool subdomains = false;
+        if(!parse_header(value, max_age, have_max_age, subdomains) ||
+            !have_max_age)
+            return false;
+        if(max_age == 0)
+        {
+            erase_key(key);
+            return true;
+        }
+        auto const limit = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::seconds>(
+                time_point::max() - now).count());
+        auto const age = std::chrono::seconds(
+            static_cast<std::int64_t>((std::min)(max_age, limit)));
+        put_key(key, entry{now + age, subdomains});
+        return true;
+    }
+
+    /** Add or replace the policy for a host.
+    */
+    void
+    set(std::string_view host, entry e)
+    {
+        auto const key = make_key(host);
+        if(!key.empty())
+            put_key(key, e);
+    }
+
+    /** Return true if a host must be reached over HTTPS.
+
+        This holds if the host has an unexpired entry, or a
+        parent domain has one which covers subdomains.
+    */
+    bool
+    secure(std::string_view host, time_point now) const
+    {
+        auto const key = make_key(host);
+        if(key.empty() || is_ip_literal(host))
+            return false;
+
+        // Try the whole name, then each parent domain
+        for(std::size_t n = key.size(); n > 0;)
+        {
+            auto const it = find(std::string_view(key).substr(0, n));
+            if(it != entries_.end() && it->second.expires > now &&
+                (n == key.size() || it->second.include_subdomains))
+                return true;
+            auto const dot = key.rfind('.', n - 1);
+            if(dot == std::string::npos)
+                break;
+            n = dot;
+        }
+        return false;
+    }
+
+    /** Merge entries from curl's HSTS file format.
+
+        Comments, malformed lines and expired entries are
+        skipped. An expiry of "unlimited" never expires.
+
+        @return The number of entries added or replaced
+    */
+    std::size_t
+    load(std::string_view text, time_point now)
+    {
+        std::size_t count = 0;
+        while(!text.empty())
+        {
+            auto const eol = text.find('\n');
+            auto line = text.substr(0, eol);
+            text = eol == std::string_view::npos ?
+                std::string_view() : text.substr(eol + 1);
+            line = trim(line);
+            if(line.empty() || line.front() == '#')
+                continue;
+            auto const sp = line.find_first_of(" \t");
+            if(sp == std::string_view::npos)
+                continue;
+            auto host = line.substr(0, sp);
+            auto date = trim(line.substr(sp + 1));
+            if( date.size() < 2 ||
+                date.front() != '"' || date.back() != '"')
+                continue;
+            date = date.substr(1, date.size() - 2);
+            entry e;
+            if(!parse_curl_date(date, e.expires) || e.expires <= now)
+                continue;
+            if(!host.empty() && host.front() == '.')
+            {
+                e.include_subdomains = true;
+                host.remove_prefix(1);
+            }
+            auto const key = make_key(host);
+            if(key.empty())
+                continue;
+            put_key(key, e);
+            ++count;
+        }
+        return count;
+    }
+
+    /** Return the unexpired entries in curl's HSTS file format.
+    */
+    std::string
+    save(time_point now) const
+    {
+        std::string out =
+            "# Your HSTS cache. https://curl.se/docs/hsts.html\n"
+            "# This file was generated by burl! Edit at your own risk.\n";
+        for(auto const& [key, e] : entries_)
+        {
+            if(e.expires <= now)
+                continue;
+            if(e.include_subdomains)
+                out.push_back('.');
+            out.append(key.rbegin(), key.rend());
+            out.append(" \"");
+            out.append(format_curl_date(e.expires));
+            out.append("\"\n");
+        }
+        return out;
+    }
+
+    /// Remove every expired entry
+    void
+    prune(time_point now)
+    {
+        std::erase_if(entries_,
+            [now](auto const& p)
+            {
+                return p.second.expires <= now;
+            });
+    }
+
+private:
+    using value_type = std::pair<std::string, entry>;
+
+    static
+    std::string_view
+    trim(std::string_view s) noexcept
+    {
+        while(!s.empty() && (s.front() == ' ' || s.front() == '\t' ||
+            s.front() == '\r'))
+            s.remove_prefix(1);
+        while(!s.empty() && (s.back() == ' ' || s.back() == '\t' ||
+            s.back() == '\r'))
+            s.remove_suffix(1);
+        return s;
+    }
+
+    static
+    char
+    to_lower(char c) noexcept
+    {
+        if(c >= 'A' && c <= 'Z')
+            return static_cast<char>(c - 'A' + 'a');
+        return c;
+    }
+
+    static
+    bool
+    iequals(std::string_view a, std::string_view b) noexcept
+    {
+        if(a.size() != b.size())
+            return false;
+        for(std::size_t i = 0; i < a.size(); ++i)
+            if(to_lower(a[i]) != to_lower(b[i]))
+                return false;
+        return true;
+    }
+
+    // The lowercase host, reversed, without a trailing dot
+    static
+    std::string
+    make_key(std::string_view host)
+    {
+        if(!host.empty() && host.back() == '.')
+            host.remove_suffix(1);
+        std::string key;
+        key.reserve(host.size());
+        for(auto it = host.rbegin(); it != host.rend(); ++it)
+            key.push_back(to_lower(*it));
+        return key;
+    }
+
+    static
+    bool
+    is_ip_literal(std::string_view host) noexcept
+    {
+        if(host.find(':') != std::string_view::npos)
+            return true;
+        return std::all_of(host.begin(), host.end(),
+            [](char c)
+            {
+                return c == '.' || (c >= '0' && c <= '9');
+            });
+    }
+
+    // Parse the directives of a Strict-Transport-Security
+    // header (RFC 6797 section 6.1)
+    static
+    bool
+    parse_header(
+        std::string_view v,
+        std::uint64_t& max_age,
+        bool& have_max_age,
+        bool& subdomains)
+    {
+        while(!v.empty())
+        {
+            auto const semi = v.find(';');
+            auto d = trim(v.substr(0, semi));
+            v = semi == std::string_view::npos ?
+                std::string_view() : v.substr(semi + 1);
+            if(d.empty())
+                continue;
+            auto const eq = d.find('=');
+            auto const name = trim(d.substr(0, eq));
+            auto value = eq == std::string_view::npos ?
+                std::string_view() : trim(d.substr(eq + 1));
+            if(iequals(name, "max-age"))
+            {
+                if(have_max_age)
+                    return false;
+                if( value.size() >= 2 &&
+                    value.front() == '"' && value.back() == '"')
+                    value = value.substr(1, value.size() - 2);
+                if(value.empty())
+                    return false;
+                std::uint64_t n = 0;
+                for(char c : value)
+                {
+                    if(c < '0' || c > '9')
+                        return false;
+                    if(n < 0xffffffffffffULL)
+                        n = n * 10 + static_cast<unsigned>(c - '0');
+                }
+                max_age = n;
+                have_max_age = true;
+            }
+            else if(iequals(name, "includeSubDomains"))
+            {
+                if(subdomains || eq != std::string_view::npos)
+                    return false;
+                subdomains = true;
+            }
+
+            // Unknown directives are ignored
+        }
+        return true;
+    }
+
+    static
+    bool
+    less(value_type const& a, std::string_view b) noexcept
+    {
+        return a.first < b;
+    }
+
+    std::vector<value_type>::const_iterator
+    find(std::string_view key) const
+    {
+        auto it = std::lower_bound(
+            entries_.begin(), entries_.end(), key, &less);
+        if(it != entries_.end() && it->first == key)
+            return it;
+        return entries_.end();
+    }
+
+    void
+    put_key(std::string const& key, entry e)
+    {
+        auto it = std::lower_bound(
+            entries_.begin(), entries_.end(),
+            std::string_view(key), &less);
+        if(it != entries_.end() && it->first == key)
+            it->second = e;
+        else
+            entries_.insert(it, value_type(key, e));
+    }
+
+    void
+    erase_key(std::string const& key)
+    {
+        auto it = std::lower_bound(
+            entries_.begin(), entries_.end(),
+            std::string_view(key), &less);
+        if(it != entries_.end() && it->first == key)
+            entries_.erase(it);
+    }
+
+    std::vector<value_type> entries_;
+};
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
@@ -0,0 +1,406 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_JSON_INDEX_HPP
+#define BOOST_BURL_SRC_DETAIL_JSON_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+# include <emmintrin.h>
+# define BOOST_BURL_JSON_INDEX_SSE2
+#endif
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/** The token starts of a JSON document, found without parsing.
+
+    The document is scanned 64 bytes at a time. Each block is
+    reduced to bitmasks of quotes, backslashes, structural
+    characters and whitespace; on x86-64 with SSE2, which
+    every such CPU has, sixteen bytes are compared at once.
+    Escaped quotes are then removed, the quote mask's prefix
+    XOR gives the bytes inside strings, and what remains
+    outside them marks where each token starts: a bracket,
+    brace, colon or comma, the opening quote of a string, or
+    the first byte of a number or literal.
+
+    Brackets are paired while the tokens are listed, so a
+    reader can step over any array or object in one move.
+    That is what lets a lookup touch only the values on its
+    path. Nothing else is validated here; the reader checks
+    the grammar of what it visits.
+*/
+class json_index
+{
+public:
+    /** Index a document.
+
+        @return false if a string is not terminated or the
+            brackets do not balance
+    */
+    bool
+    build(std::string_view s)
+    {
+        pos_.clear();
+        match_.clear();
+        if(s.size() >= 0xffffffffu)
+            return false;
+        pos_.reserve(s.size() / 6 + 16);
+
+        std::uint64_t prev_escaped = 0;
+        std::uint64_t prev_in_string = 0;
+        std::uint64_t prev_atom = 0;
+        std::size_t i = 0;
+        for(; i + 64 <= s.size(); i += 64)
+            scan_block(s.data() + i, i,
+                prev_escaped, prev_in_string, prev_atom);
+        if(i < s.size())
+        {
+            // Whitespace padding ends any literal at the edge
+            char buf[64];
+            std::memset(buf, ' ', sizeof(buf));
+            std::memcpy(buf, s.data() + i, s.size() - i);
+            scan_block(buf, i,
+                prev_escaped, prev_in_string, prev_atom);
+        }
+        if(prev_in_string)
+            return false;
+        return pair_brackets(s);
+    }
+
+    /// Return the number of tokens
+    std::size_t
+    size() const noexcept
+    {
+        return pos_.size();
+    }
+
+    /// Return the offset of a token's first byte
+    std::uint32_t
+    pos(std::size_t i) const noexcept
+    {
+        return pos_[i];
+    }
+
+    /** Return the token closing a bracket or brace.
+
+        @par Preconditions
+        Token `i` is '[' or '{'.
+    */
+    std::uint32_t
+    match(std::size_t i) const noexcept
+    {
+        return match_[i];
+    }
+
+private:
+    struct masks
+    {
+        std::uint64_t quote = 0;
+        std::uint64_t backslash = 0;
+        std::uint64_t structural = 0;
+        std::uint64_t space = 0;
+    };
+
+    static
+    masks
+    classify(char const* p) noexcept
+    {
+        masks m;
+#ifdef BOOST_BURL_JSON_INDEX_SSE2
+        for(int k = 0; k < 4; ++k)
+        {
+            __m128i const v = _mm_loadu_si128(
+                reinterpret_cast<__m128i const*>(p + 16 * k));
+            auto eq = [&](char c)
+            {
+                return _mm_cmpeq_epi8(v, _mm_set1_epi8(c));
+            };
+            auto bits = [](__m128i x)
+            {
+                return static_cast<std::uint64_t>(
+                    static_cast<std::uint16_t>(_mm_movemask_epi8(x)));
+            };
+            int const shift = 16 * k;
+            m.quote |= bits(eq('"')) << shift;
+            m.backslash |= bits(eq('\\')) << shift;
+            m.structural |= bits(_mm_or_si128(
+                _mm_or_si128(
+                    _mm_or_si128(eq('{'), eq('}')),
+                    _mm_or_si128(eq('['), eq(']'))),
+                _mm_or_si128(eq(':'), eq(',')))) << shift;
+            m.space |= bits(_mm_or_si128(
+                _mm_or_si128(eq(' '), eq('\t')),
+                _mm_or_si128(eq('\n'), eq('\r')))) << shift;
+        }
+#else
+        for(int k = 0; k < 64; ++k)
+        {
+            std::uint64_t const bit = std::uint64_t(1) << k;
+            switch(p[k])
+            {
+            case '"': m.quote |= bit; break;
+            case '\\': m.backslash |= bit; break;
+            case '{': case '}': case '[': case ']':
+            case ':': case ',':
+                m.structural |= bit; break;
+            case ' ': case '\t': case '\n': case '\r':
+                m.space |= bit; break;
+            default: break;
+            }
+        }
+#endif
+        return m;
+    }
+
+    // Bytes preceded by an odd run of backslashes. Runs are
+    // rare outside of strings full of escapes, so walking the
+    // backslashes one at a time costs little
+    static
+    std::uint64_t
+    find_escaped(
+        std::uint64_t backslash,
+        std::uint64_t& prev_escaped) noexcept
+    {
+        std::uint64_t escaped = prev_escaped;
+        backslash &= ~prev_escaped;
+        prev_escaped = 0;
+        while(backslash)
+        {
+            std::uint64_t const b = backslash & (0 - backslash);
+            backslash ^= b;
+            if(b == std::uint64_t(1) << 63)
+            {
+                prev_escaped = 1;
+                break;
+            }
+            escaped |= b << 1;
+            backslash &= ~(b << 1);
+        }
+        return escaped;
+    }
+
+    static
+    std::uint64_t
+    prefix_xor(std::uint64_t x) noexcept
+    {
+        x ^= x << 1;
+        x ^= x << 2;
+        x ^= x << 4;
+        x ^= x << 8;
+        x ^= x << 16;
+        x ^= x << 32;
+        return x;
+    }
+
+    void
+    scan_block(
+        char const* p,
+        std::size_t offset,
+        std::uint64_t& prev_escaped,
+        std::uint64_t& prev_in_string,
+        std::uint64_t& prev_atom)
+    {
+        auto const m = classify(p);
+        auto const quotes =
+            m.quote & ~find_escaped(m.backslash, prev_escaped);
+
+        // Set from each opening quote up to, but not including,
+        // its closing quote
+        auto const in_string = prefix_xor(quotes) ^ (0 - prev_in_string);
+        prev_in_string = in_string >> 63;
+
+        auto const outside = ~in_string & ~quotes;
+        auto const atom = outside & ~m.space & ~m.structural;
+        auto const atom_start = atom & ~((atom << 1) | prev_atom);
+        prev_atom = atom >> 63;
+
+        auto tokens =
+            (m.structural & outside) |
+            (quotes & in_string) |
+            atom_start;
+        while(tokens)
+        {
+            pos_.push_back(static_cast<std::uint32_t>(
+                offset + countr_zero(tokens)));
+            tokens &= tokens - 1;
+        }
+    }
+
+    static
+    int
+    countr_zero(std::uint64_t x) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(x);
+#else
+        int n = 0;
+        while(!(x & 1))
+        {
+            x >>= 1;
+            ++n;
+        }
+        return n;
+#endif
+    }
+
+    bool
+    pair_brackets(std::string_view s)
+    {
+        match_.assign(pos_.size(), 0);
+        std::vector<std::uint32_t> open;
+        for(std::size_t i = 0; i < pos_.size(); ++i)
+        {
+            char const c = s[pos_[i]];
+            if(c == '{' || c == '[')
+            {
+                open.push_back(static_cast<std::uint32_t>(i));
+            }
+            else if(c == '}' || c == ']')
+            {
+                if(open.empty())
+                    return false;
+                auto const o = open.back();
+                open.pop_back();
+                if(s[pos_[o]] != (c == '}' ? '{' : '['))
+                    return false;
+                match_[o] = static_cast<std::uint32_t>(i);
+            }
+        }
+        return open.empty();
+    }
+
+    std::vector<std::uint32_t> pos_;
+    std::vector<std::uint32_t> match_;
+};
+
+//----------------------------------------------------------
+
+/** Decode the inside of a JSON string, appending to out.
+
+    @param s The bytes between the quotes
+
+    @return false on a bad escape, an unpaired surrogate or
+        an unescaped control character
+*/
+inline
+bool
+json_unescape(std::string_view s, std::string& out)
+{
+    auto hex4 = [&](std::size_t i, unsigned& v)
+    {
+        if(i + 4 > s.size())
+            return false;
+        v = 0;
+        for(std::size_t k = i; k < i + 4; ++k)
+        {
+            char const c = s[k];
+            v <<= 4;
+            if(c >= '0' && c <= '9')
+                v |= static_cast<unsigned>(c - '0');
+            else if(c >= 'a' && c <= 'f')
+                v |= static_cast<unsigned>(c - 'a' + 10);
+            else if(c >= 'A' && c <= 'F')
+                v |= static_cast<unsigned>(c - 'A' + 10);
+            else
+                return false;
+        }
+        return true;
+    };
+    auto utf8 = [&](unsigned cp)
+    {
+        if(cp < 0x80)
+        {
+            out.push_back(static_cast<char>(cp));
+        }
+        else if(cp < 0x800)
+        {
+            out.push_back(static_cast<char>(0xc0 | (cp >> 6)));
+            out.push_back(static_cast<char>(0x80 | (cp & 0x3f)));
+        }
+        else if(cp < 0x10000)
+        {
+            out.push_back(static_cast<char>(0xe0 | (cp >> 12)));
+            out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3f)));
+            out.push_back(static_cast<char>(0x80 | (cp & 0x3f)));
+        }
+        else
+        {
+            out.push_back(static_cast<char>(0xf0 | (cp >> 18)));
+            out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3f)));
+            out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3f)));
+            out.push_back(static_cast<char>(0x80 | (cp & 0x3f)));
+        }
+    };
+
+    out.reserve(out.size() + s.size());
+    for(std::size_t i = 0; i < s.size(); ++i)
+    {
+        char const c = s[i];
+        if(static_cast<unsigned char>(c) < 0x20)
+            return false;
+        if(c != '\\')
+        {
+            out.push_back(c);
+            continue;
+        }
+        if(++i >= s.size())
+            return false;
+        switch(s[i])
+        {
+        case '"': out.push_back('"'); break;
+        case '\\': out.push_back('\\'); break;
+        case '/': out.push_back('/'); break;
+        case 'b': out.push_back('\b'); break;
+        case 'f': out.push_back('\f'); break;
+        case 'n': out.push_back('\n'); break;
+        case 'r': out.push_back('\r'); break;
+        case 't': out.push_back('\t'); break;
+        case 'u':
+        {
+            unsigned cp;
+            if(!hex4(i + 1, cp))
+                return false;
+            i += 4;
+            if(cp >= 0xdc00 && cp <= 0xdfff)
+                return false;
+            if(cp >= 0xd800 && cp <= 0xdbff)
+            {
+                unsigned lo;
+                if( i + 2 >= s.size() ||
+                    s[i + 1] != '\\' || s[i + 2] != 'u' ||
+                    !hex4(i + 3, lo) ||
+                    lo < 0xdc00 || lo > 0xdfff)
+                    return false;
+                i += 6;
+                cp = 0x10000 + ((cp - 0xd800) << 10) + (lo - 0xdc00);
+            }
+            utf8(cp);
+            break;
+        }
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
@@ -0,0 +1,219 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_LINK_HEADER_HPP
+#define BOOST_BURL_SRC_DETAIL_LINK_HEADER_HPP
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/** One link of a Link header (RFC 8288).
+*/
+struct link_value
+{
+    // The URI reference between the angle brackets, as sent
+    std::string target;
+
+    // Parameters in order, names lowercased and quoted
+    // values unescaped
+    std::vector<std::pair<std::string, std::string>> params;
+
+    /** Return the first value of a parameter, if present.
+    */
+    std::optional<std::string_view>
+    param(std::string_view name) const noexcept
+    {
+        for(auto const& [k, v] : params)
+            if(k == name)
+                return std::string_view(v);
+        return std::nullopt;
+    }
+
+    /** Return true if `rel` lists the relation type.
+
+        `rel` may hold several types separated by spaces,
+        and registered types compare case-insensitively.
+    */
+    bool
+    has_rel(std::string_view type) const noexcept
+    {
+        auto const rel = param("rel");
+        if(!rel)
+            return false;
+        std::string_view s = *rel;
+        while(!s.empty())
+        {
+            auto const i = s.find(' ');
+            auto const t = s.substr(0, i);
+            if(iequals(t, type))
+                return true;
+            if(i == std::string_view::npos)
+                break;
+            s.remove_prefix(i + 1);
+        }
+        return false;
+    }
+
+    static
+    bool
+    iequals(std::string_view a, std::string_view b) noexcept
+    {
+        if(a.size() != b.size())
+            return false;
+        for(std::size_t i = 0; i < a.size(); ++i)
+            if(to_lower(a[i]) != to_lower(b[i]))
+                return false;
+        return true;
+    }
+
+    static
+    char
+    to_lower(char c) noexcept
+    {
+        return c >= 'A' && c <= 'Z' ? static_cast<char>(c + 32) : c;
+    }
+};
+
+/** Parse the value of a Link header.
+
+    Commas inside the angle brackets or a quoted string do
+    not split links. Parsing stops at the first malformed
+    link, keeping those before it, so one bad entry in a
+    server's header does not hide a good "next" link that
+    came earlier.
+*/
+inline
+std::vector<link_value>
+parse_link_header(std::string_view s)
+{
+    std::vector<link_value> out;
+    std::size_t i = 0;
+    auto skip_ows = [&]
+    {
+        while(i < s.size() && (s[i] == ' ' || s[i] == '\t'))
+            ++i;
+    };
+    auto is_tchar = [](char c)
+    {
+        return
+            (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+            (c >= '0' && c <= '9') ||
+            std::string_view("!#$%&'*+-.^_`|~").find(c) !=
+                std::string_view::npos;
+    };
+    auto token = [&]
+    {
+        auto const start = i;
+        while(i < s.size() && is_tchar(s[i]))
+            ++i;
+        return s.substr(start, i - start);
+    };
+
+    for(;;)
+    {
+        while(i < s.size() && (s[i] == ' ' || s[i] == '\t' || s[i] == ','))
+            ++i;
+        if(i >= s.size() || s[i] != '<')
+            break;
+        auto const close = s.find('>', i);
+        if(close == std::string_view::npos)
+            break;
+        link_value link;
+        link.target = s.substr(i + 1, close - i - 1);
+        i = close + 1;
+
+        bool ok = true;
+        for(;;)
+        {
+            skip_ows();
+            if(i >= s.size() || s[i] == ',')
+                break;
+            if(s[i] != ';')
+            {
+                ok = false;
+                break;
+            }
+            ++i;
+            skip_ows();
+            auto const name = token();
+            if(name.empty())
+            {
+                ok = false;
+                break;
+            }
+            std::string key;
+            for(char c : name)
+                key.push_back(link_value::to_lower(c));
+            std::string value;
+            skip_ows();
+            if(i < s.size() && s[i] == '=')
+            {
+                ++i;
+                skip_ows();
+                if(i < s.size() && s[i] == '"')
+                {
+                    ++i;
+                    bool closed = false;
+                    while(i < s.size())
+                    {
+                        char c = s[i++];
+                        if(c == '"')
+                        {
+                            closed = true;
+                            break;
+                        }
+                        if(c == '\\' && i < s.size())
+                            c = s[i++];
+                        value.push_back(c);
+                    }
+                    if(!closed)
+                    {
+                        ok = false;
+                        break;
+                    }
+                }
+                else
+                {
+                    value = token();
+                }
+            }
+            link.params.emplace_back(std::move(key), std::move(value));
+        }
+        if(!ok)
+            break;
+        out.push_back(std::move(link));
+    }
+    return out;
+}
+
+/** Return the target of the first link with a relation type.
+*/
+inline
+std::optional<std::string>
+find_link(std::string_view header, std::string_view rel)
+{
+    for(auto& link : parse_link_header(header))
+        if(link.has_rel(rel))
+            return std::move(link.target);
+    return std::nullopt;
+}
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
@@ -0,0 +1,507 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_ORIGIN_SCHEDULER_HPP
+#define BOOST_BURL_SRC_DETAIL_ORIGIN_SCHEDULER_HPP
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/** Fair admission of requests across origins.
+
+    Tracks the number of requests in flight per origin and in
+    total, and enforces a limit on each. Requests which cannot
+    start are queued per origin. When capacity frees up:
+
+    @li Priority classes are served strictly in order; class 0
+        is the most urgent.
+
+    @li Within a class, origins with pending work are served
+        with deficit round robin: each receives `weight`
+        dispatches per round, so a large backlog for one origin
+        cannot starve the others.
+
+    @li Within an origin and class, the request with the
+        earliest deadline goes first (EDF), then arrival order.
+
+    The scheduler does not resume anything itself. Waiters
+    which become runnable, or whose deadline can no longer be
+    met, are handed back to the caller.
+
+    @tparam Key The origin key, ordered by `operator<`
+    @tparam Waiter The type used to resume a waiter
+*/
+template<class Key, class Waiter>
+class origin_scheduler
+{
+public:
+    using clock_type = std::chrono::steady_clock;
+    using time_point = clock_type::time_point;
+
+    /// The number of priority classes
+    static constexpr std::size_t classes = 3;
+
+    /// A deadline which never expires
+    static constexpr time_point no_deadline = (time_point::max)();
+
+    static constexpr std::size_t unlimited =
+        (std::numeric_limits<std::size_t>::max)();
+
+    /** Set the limit on requests in flight across all origins.
+    */
+    void
+    set_max_in_flight(std::size_t n) noexcept
+    {
+        max_in_flight_ = n ? n : unlimited;
+    }
+
+    /** Set the default limit on requests in flight per origin.
+    */
+    void
+    set_max_in_flight_per_origin(std::size_t n) noexcept
+    {
+        max_per_origin_ = n ? n : unlimited;
+
+        // Origins parked at the old limit may run again
+        for(auto it = origins_.begin(); it != origins_.end(); ++it)
+            activate(it);
+    }
+
+    /** Set the limit on requests in flight for one origin.
+
+        This overrides the default per-origin limit; it is
+        capped by it. A limit of zero restores the default.
+        Raising a limit does not dispatch; call @ref dispatch.
+    */
+    void
+    set_limit(Key const& key, std::size_t n)
+    {
+        if(n)
+            limits_[key] = n;
+        else
+            limits_.erase(key);
+        auto it = origins_.find(key);
+        if(it == origins_.end())
+            return;
+        it->second.limit = n;
+        activate(it);
+    }
+
+    /** Set the share of dispatches given to an origin per round.
+    */
+    void
+    set_weight(Key const& key, unsigned weight)
+    {
+        weights_[key] = weight ? weight : 1;
+        auto it = origins_.find(key);
+        if(it != origins_.end())
+            it->second.weight = weights_[key];
+    }
+
+    /** Try to start a request.
+
+        If the request can start now, a slot is taken and the
+        function returns true. Otherwise the waiter is queued
+        and will be returned by a later call to @ref release,
+        @ref dispatch or @ref expire.
+
+        @param key The origin
+        @param w The waiter to queue if the request cannot start
+        @param cls The priority class, 0 being the most urgent
+        @param deadline The time by which the request must start
+    */
+    bool
+    acquire(
+        Key const& key,
+        Waiter w,
+        std::size_t cls = 1,
+        time_point deadline = no_deadline)
+    {
+        if(cls >= classes)
+            cls = classes - 1;
+        auto it = find_or_create(key);
+        auto& o = it->second;
+        if( o.pending_count() == 0 &&
+            o.in_flight < limit_of(o) &&
+            in_flight_ < max_in_flight_)
+        {
+            ++o.in_flight;
+            ++in_flight_;
+            return true;
+        }
+        o.queues[cls].pending.insert(
+            entry{deadline, seq_++, std::move(w)});
+        ++pending_;
+        activate(it);
+        return false;
+    }
+
+    /** Finish a request and dispatch waiters.
+
+        Releases the slot held for `key` and appends to `out`
+        every waiter which now holds a slot.
+    */
+    void
+    release(Key const& key, std::vector<Waiter>& out)
+    {
+        auto it = origins_.find(key);
+        if(it == origins_.end())
+            return;
+        auto& o = it->second;
+        if(o.in_flight > 0)
+        {
+            --o.in_flight;
+            --in_flight_;
+        }
+        activate(it);
+        dispatch(out);
+        erase_if_idle(it);
+    }
+
+    /** Dispatch waiters after a limit was raised.
+    */
+    void
+    dispatch(std::vector<Waiter>& out)
+    {
+        for(std::size_t c = 0; c < classes; ++c)
+        {
+            auto& ring = rings_[c];
+            while(in_flight_ < max_in_flight_ && !ring.empty())
+            {
+                auto it = ring.front();
+                ring.pop_front();
+                auto& o = it->second;
+                auto& q = o.queues[c];
+
+                // A new turn; an interrupted turn keeps its credit
+                if(q.deficit <= 0)
+                    q.deficit += o.weight;
+                while(
+                    q.deficit > 0 &&
+                    !q.pending.empty() &&
+                    o.in_flight < limit_of(o) &&
+                    in_flight_ < max_in_flight_)
+                {
+                    out.push_back(take(q, q.pending.begin()));
+                    --q.deficit;
+                    ++o.in_flight;
+                    ++in_flight_;
+                }
+                if(q.pending.empty())
+                {
+                    // No backlog, no credit carried over
+                    q.active = false;
+                    q.deficit = 0;
+                }
+                else if(o.in_flight >= limit_of(o))
+                {
+                    // Parked until one of its requests finishes
+                    park(o);
+                }
+                else if(q.deficit > 0)
+                {
+                    // Out of global capacity mid-turn, resume it next
+                    ring.push_front(it);
+                }
+                else
+                {
+                    ring.push_back(it);
+                }
+            }
+            if(in_flight_ >= max_in_flight_)
+                return;
+        }
+    }
+
+    /** Remove one queued waiter.
+
+        @return true if the waiter was queued; it then holds
+            no slot and will not be returned by any call
+    */
+    bool
+    cancel(Key const& key, Waiter const& w)
+    {
+        auto it = origins_.find(key);
+        if(it == origins_.end())
+            return false;
+        for(auto& q : it->second.queues)
+        {
+            for(auto e = q.pending.begin(); e != q.pending.end(); ++e)
+            {
+                if(!(e->w == w))
+                    continue;
+                take(q, e);
+                erase_if_idle(it);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /** Remove waiters whose deadline can no longer be met.
+
+        A waiter is expired when it could not start before its
+        deadline even if it were dispatched right now, that is
+        when `deadline < now + lead`.
+
+        @param now The current time
+        @param lead The minimum time needed to serve a request
+        @param out Receives the expired waiters
+    */
+    void
+    expire(
+        time_point now,
+        clock_type::duration lead,
+        std::vector<Waiter>& out)
+    {
+        auto const cutoff = now + lead;
+        for(auto it = origins_.begin(); it != origins_.end();)
+        {
+            auto next = std::next(it);
+            for(auto& q : it->second.queues)
+            {
+                // Sorted by deadline, expired entries lead
+                while(
+                    !q.pending.empty() &&
+                    q.pending.begin()->deadline < cutoff)
+                {
+                    out.push_back(take(q, q.pending.begin()));
+                }
+            }
+            erase_if_idle(it);
+            it = next;
+        }
+    }
+
+    /** Return the earliest deadline of any queued waiter.
+    */
+    time_point
+    earliest_deadline() const noexcept
+    {
+        auto t = no_deadline;
+        for(auto const& [key, o] : origins_)
+            for(auto const& q : o.queues)
+                if( !q.pending.empty() &&
+                    q.pending.begin()->deadline < t)
+                    t = q.pending.begin()->deadline;
+        return t;
+    }
+
+    /** Remove every queued waiter.
+    */
+    void
+    clear_pending(std::vector<Waiter>& out)
+    {
+        for(auto& [key, o] : origins_)
+        {
+            for(auto& q : o.queues)
+            {
+                while(!q.pending.empty())
+                    out.push_back(take(q, q.pending.begin()));
+                q.active = false;
+                q.deficit = 0;
+            }
+        }
+        for(auto& ring : rings_)
+            ring.clear();
+    }
+
+    /// Return the number of requests in flight
+    std::size_t
+    in_flight() const noexcept
+    {
+        return in_flight_;
+    }
+
+    /// Return the number of requests in flight for an origin
+    std::size_t
+    in_flight(Key const& key) const
+    {
+        auto it = origins_.find(key);
+        if(it == origins_.end())
+            return 0;
+        return it->second.in_flight;
+    }
+
+    /// Return the number of queued requests
+    std::size_t
+    pending() const noexcept
+    {
+        return pending_;
+    }
+
+    /// Return the number of queued requests for an origin
+    std::size_t
+    pending(Key const& key) const
+    {
+        auto it = origins_.find(key);
+        if(it == origins_.end())
+            return 0;
+        return it->second.pending_count();
+    }
+
+private:
+    struct entry
+    {
+        time_point deadline;
+        std::uint64_t seq;
+        mutable Waiter w;
+
+        friend
+        bool
+        operator<(entry const& a, entry const& b) noexcept
+        {
+            if(a.deadline != b.deadline)
+                return a.deadline < b.deadline;
+            return a.seq < b.seq;
+        }
+    };
+
+    struct class_queue
+    {
+        std::set<entry> pending;
+        long deficit = 0;
+        bool active = false;
+    };
+
+    struct origin
+    {
+        std::array<class_queue, classes> queues;
+        std::size_t in_flight = 0;
+        std::size_t limit = 0;  // 0 = use the default
+        unsigned weight = 1;
+
+        std::size_t
+        pending_count() const noexcept
+        {
+            std::size_t n = 0;
+            for(auto const& q : queues)
+                n += q.pending.size();
+            return n;
+        }
+    };
+
+    using map_type = std::map<Key, origin>;
+    using iterator = typename map_type::iterator;
+
+    Waiter
+    take(
+        class_queue& q,
+        typename std::set<entry>::iterator e)
+    {
+        Waiter w = std::move(e->w);
+        q.pending.erase(e);
+        --pending_;
+        return w;
+    }
+
+    std::size_t
+    limit_of(origin const& o) const noexcept
+    {
+        if(o.limit == 0)
+            return max_per_origin_;
+        return (std::min)(o.limit, max_per_origin_);
+    }
+
+    iterator
+    find_or_create(Key const& key)
+    {
+        auto it = origins_.find(key);
+        if(it != origins_.end())
+            return it;
+        it = origins_.emplace(key, origin{}).first;
+        auto w = weights_.find(key);
+        if(w != weights_.end())
+            it->second.weight = w->second;
+        auto l = limits_.find(key);
+        if(l != limits_.end())
+            it->second.limit = l->second;
+        return it;
+    }
+
+    // Put each class with pending work on its ring
+    void
+    activate(iterator it)
+    {
+        auto& o = it->second;
+        if(o.in_flight >= limit_of(o))
+            return;
+        for(std::size_t c = 0; c < classes; ++c)
+        {
+            auto& q = o.queues[c];
+            if(q.active || q.pending.empty())
+                continue;
+            q.active = true;
+            rings_[c].push_back(it);
+        }
+    }
+
+    // Take an origin at its limit off every ring
+    void
+    park(origin& o)
+    {
+        for(std::size_t c = 0; c < classes; ++c)
+        {
+            auto& q = o.queues[c];
+            if(!q.active)
+                continue;
+            q.active = false;
+            auto& ring = rings_[c];
+            for(auto r = ring.begin(); r != ring.end(); ++r)
+            {
+                if(&(*r)->second == &o)
+                {
+                    ring.erase(r);
+                    break;
+                }
+            }
+        }
+    }
+
+    void
+    erase_if_idle(iterator it)
+    {
+        auto& o = it->second;
+        if(o.in_flight != 0 || o.pending_count() != 0)
+            return;
+        for(auto const& q : o.queues)
+            if(q.active)
+                return;
+        origins_.erase(it);
+    }
+
+    map_type origins_;
+    std::map<Key, unsigned> weights_;
+    std::map<Key, std::size_t> limits_;
+    std::array<std::deque<iterator>, classes> rings_;
+    std::size_t max_in_flight_ = unlimited;
+    std::size_t max_per_origin_ = unlimited;
+    std::size_t in_flight_ = 0;
+    std::size_t pending_ = 0;
+    std::uint64_t seq_ = 0;
+};
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
@@ -0,0 +1,83 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_PAGINATOR_IMPL_HPP
+#define BOOST_BURL_SRC_DETAIL_PAGINATOR_IMPL_HPP
+
+#include <boost/burl/options.hpp>
+#include <boost/burl/paginate.hpp>
+#include <boost/burl/response.hpp>
+#include <boost/burl/session.hpp>
+#include <boost/url/url.hpp>
+
+#include "src/detail/prefetch_queue.hpp"
+
+#include <coroutine>
+#include <cstddef>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace boost {
+namespace burl {
+
+/*  State shared by a paginator and its prefetch.
+
+    The prefetch coroutine runs on the session's executor and
+    holds its own reference, so destroying the paginator
+    while a fetch is in flight only stops it. `s` shares the
+    state of the session which made the paginator, so that
+    session may be moved or destroyed meanwhile.
+*/
+struct paginator::impl
+{
+    // A page as it will be yielded
+    struct page
+    {
+        std::error_code ec;
+        response<std::string> r;
+    };
+
+    impl(
+        session s_,
+        urls::url_view url,
+        request_options opts_,
+        paginate_options popts_)
+        : s(std::move(s_))
+        , next_url(url)
+        , opts(std::move(opts_))
+        , popts(std::move(popts_))
+        , queue(popts.lookahead)
+    {
+    }
+
+    session s;
+
+    // The page the next fetch requests; empty once the last
+    // page was fetched
+    std::optional<urls::url> next_url;
+
+    request_options opts;
+    paginate_options popts;
+    detail::prefetch_queue<page> queue;
+    std::size_t yielded = 0;
+
+    // The consumer suspended in next(), if any
+    std::coroutine_handle<> waiter;
+
+    // Stops the fetch in flight
+    std::stop_source stop;
+};
+
+} // namespace burl
+} // namespace boost
+
+#endif
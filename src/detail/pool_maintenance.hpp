@@ -0,0 +1,167 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_POOL_MAINTENANCE_HPP
+#define BOOST_BURL_SRC_DETAIL_POOL_MAINTENANCE_HPP
+
+#include <boost/burl/options.hpp>
+
+#include "src/detail/token_bucket.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/** Decisions of the background pool maintenance task.
+
+    The task itself does the I/O; this decides which idle
+    connections to close, how many to open, and when to run
+    next. Lifetimes and run times are jittered so that
+    connections opened in one burst are not all retired, and
+    then reopened, in another.
+*/
+class pool_maintenance
+{
+public:
+    using clock_type = std::chrono::steady_clock;
+    using time_point = clock_type::time_point;
+
+    /** Constructor.
+
+        @param opts The pool options
+        @param seed Seeds the jitter
+    */
+    explicit
+    pool_maintenance(
+        pool_options const& opts = {},
+        std::uint32_t seed = 1) noexcept
+        : opts_(opts)
+        , connects_(
+            opts.connect_rate,
+            std::chrono::seconds(1),
+            0,
+            std::chrono::milliseconds(1))
+        , rng_(seed)
+    {
+        opts_.jitter = std::clamp(opts_.jitter, 0.0, 1.0);
+    }
+
+    /// Return the options
+    pool_options const&
+    options() const noexcept
+    {
+        return opts_;
+    }
+
+    /** Return when a new connection must be retired.
+
+        The maximum age is shortened by up to `jitter` of
+        itself, chosen at random for each connection.
+
+        @return The time, or `time_point::max()` if
+            connections do not age out
+    */
+    time_point
+    retire_at(time_point created) noexcept
+    {
+        if(opts_.max_age.count() <= 0)
+            return (time_point::max)();
+        auto const age = std::chrono::duration<double>(
+            opts_.max_age) * (1.0 - opts_.jitter * uniform());
+        return created +
+            std::chrono::duration_cast<clock_type::duration>(age);
+    }
+
+    /** Return true if an idle connection should be closed.
+
+        @param idle_since When the connection was last released
+        @param retire The result of @ref retire_at
+        @param now The current time
+    */
+    bool
+    reap(
+        time_point idle_since,
+        time_point retire,
+        time_point now) const noexcept
+    {
+        return
+            now >= retire ||
+            now - idle_since >= opts_.idle_timeout;
+    }
+
+    /** Return how many connections to open for an origin.
+
+        Tops the origin up to its minimum of idle connections,
+        counting those already being opened, within what the
+        connect rate allows now. The connections returned are
+        charged to the rate.
+
+        @param idle Idle connections in the origin's pools
+        @param opening Connections being opened for it
+        @param min_idle The origin's minimum
+        @param now The current time
+    */
+    std::size_t
+    replenish(
+        std::size_t idle,
+        std::size_t opening,
+        std::size_t min_idle,
+        time_point now) noexcept
+    {
+        if(idle + opening >= min_idle)
+            return 0;
+        auto const want = min_idle - idle - opening;
+        std::size_t n = 0;
+        while(n < want && connects_.peek(1, now) <= now)
+        {
+            connects_.reserve(1, now);
+            ++n;
+        }
+        return n;
+    }
+
+    /** Return when the task should run next.
+
+        The interval is varied by up to `jitter` either way.
+    */
+    time_point
+    next_run(time_point now) noexcept
+    {
+        auto const d = std::chrono::duration<double>(opts_.interval) *
+            (1.0 + opts_.jitter * (2.0 * uniform() - 1.0));
+        auto const t = std::chrono::duration_cast<
+            clock_type::duration>(d);
+        return now + (std::max)(t, clock_type::duration(
+            std::chrono::milliseconds(1)));
+    }
+
+private:
+    // Uniform in [0, 1)
+    double
+    uniform() noexcept
+    {
+        return std::uniform_real_distribution<double>(0.0, 1.0)(rng_);
+    }
+
+    pool_options opts_;
+    token_bucket connects_;
+    std::minstd_rand rng_;
+};
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
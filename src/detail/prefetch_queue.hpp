@@ -0,0 +1,145 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_PREFETCH_QUEUE_HPP
+#define BOOST_BURL_SRC_DETAIL_PREFETCH_QUEUE_HPP
+
+#include <cstddef>
+#include <deque>
+#include <utility>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/** Pages fetched ahead of the consumer, in order.
+
+    Each page names the next, so at most one fetch is in
+    flight; lookahead bounds how many finished pages may wait
+    for the consumer. With a lookahead of one, page N+1 is
+    requested as soon as page N is handed over, and arrives
+    while the consumer works on N. With zero, a page is only
+    requested once the consumer asks for it.
+
+    The queue only keeps the books; the caller starts fetches
+    whenever should_fetch() says so.
+*/
+template<class T>
+class prefetch_queue
+{
+public:
+    explicit
+    prefetch_queue(std::size_t lookahead) noexcept
+        : lookahead_(lookahead)
+    {
+    }
+
+    /** Return true if another page should be requested now.
+    */
+    bool
+    should_fetch() const noexcept
+    {
+        if(end_ || in_flight_)
+            return false;
+        if(ready_.size() < lookahead_)
+            return true;
+        return waiting_ && ready_.empty();
+    }
+
+    /// Note that a fetch was started
+    void
+    start_fetch() noexcept
+    {
+        in_flight_ = true;
+    }
+
+    /** Queue a fetched page.
+
+        @param last true if there are no pages after it,
+            including when the fetch failed
+    */
+    void
+    on_fetched(T v, bool last)
+    {
+        ready_.push_back(std::move(v));
+        in_flight_ = false;
+        end_ = end_ || last;
+        ++fetched_;
+    }
+
+    /// Return true if a page is waiting for the consumer
+    bool
+    ready() const noexcept
+    {
+        return !ready_.empty();
+    }
+
+    /// Note that the consumer asked for a page and none was ready
+    void
+    wait() noexcept
+    {
+        waiting_ = true;
+    }
+
+    /// Return true if the consumer is waiting
+    bool
+    waiting() const noexcept
+    {
+        return waiting_;
+    }
+
+    /** Hand the oldest page to the consumer.
+
+        @par Preconditions
+        `ready()`
+    */
+    T
+    pop()
+    {
+        T v = std::move(ready_.front());
+        ready_.pop_front();
+        waiting_ = false;
+        return v;
+    }
+
+    /// Start no more fetches; pages already queued remain
+    void
+    stop() noexcept
+    {
+        end_ = true;
+    }
+
+    /// Return true once every page was handed over
+    bool
+    done() const noexcept
+    {
+        return end_ && !in_flight_ && ready_.empty();
+    }
+
+    /// Return the number of pages fetched so far
+    std::size_t
+    fetched() const noexcept
+    {
+        return fetched_;
+    }
+
+private:
+    std::deque<T> ready_;
+    std::size_t lookahead_;
+    std::size_t fetched_ = 0;
+    bool in_flight_ = false;
+    bool waiting_ = false;
+    bool end_ = false;
+};
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
@@ -0,0 +1,115 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_REQUEST_GATE_HPP
+#define BOOST_BURL_SRC_DETAIL_REQUEST_GATE_HPP
+
+#include <cstddef>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/** Admits requests until the session shuts down.
+
+    Counts the requests in flight so that a shutdown can wait
+    for them to drain. Once closing, no new request enters,
+    and the last one out reports that the session is idle.
+*/
+class request_gate
+{
+public:
+    enum class state
+    {
+        /// Accepting requests
+        open,
+
+        /// Refusing new requests, waiting for the rest
+        draining,
+
+        /// Refusing new requests, none in flight
+        closed
+    };
+
+    /// Return the current state
+    state
+    current() const noexcept
+    {
+        return state_;
+    }
+
+    /// Return the number of requests in flight
+    std::size_t
+    in_flight() const noexcept
+    {
+        return in_flight_;
+    }
+
+    /** Let a request in.
+
+        @return false if the session is shutting down, in
+            which case the request must not start
+    */
+    bool
+    enter() noexcept
+    {
+        if(state_ != state::open)
+            return false;
+        ++in_flight_;
+        return true;
+    }
+
+    /** Note that a request has finished.
+
+        @return true if this was the last request of a
+            draining session, which is now closed
+    */
+    bool
+    leave() noexcept
+    {
+        if(in_flight_ > 0)
+            --in_flight_;
+        if(state_ != state::draining || in_flight_ != 0)
+            return false;
+        state_ = state::closed;
+        return true;
+    }
+
+    /** Stop admitting requests.
+
+        @return true if nothing is in flight, so the session
+            is closed at once
+    */
+    bool
+    close() noexcept
+    {
+        if(state_ == state::open)
+            state_ = state::draining;
+        if(in_flight_ == 0)
+            state_ = state::closed;
+        return state_ == state::closed;
+    }
+
+    /// Return true once close() has been called
+    bool
+    closing() const noexcept
+    {
+        return state_ != state::open;
+    }
+
+private:
+    state state_ = state::open;
+    std::size_t in_flight_ = 0;
+};
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
@@ -0,0 +1,142 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_RESOLVE_TABLE_HPP
+#define BOOST_BURL_SRC_DETAIL_RESOLVE_TABLE_HPP
+
+#include <boost/burl/resolve.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/** Resolver overrides consulted before DNS.
+
+    Host names are compared without regard to case. An
+    address override for a specific host takes precedence
+    over one for "*". Connect overrides are tried in the
+    order they were added; the first match wins.
+*/
+class resolve_table
+{
+public:
+    /// Where to connect for a host and port
+    struct target
+    {
+        std::string host;
+        std::uint16_t port;
+    };
+
+    /** Add or remove an address override.
+    */
+    void
+    add(resolve_override r)
+    {
+        key k{lower(r.host), r.port};
+        if(r.addresses.empty())
+            addresses_.erase(k);
+        else
+            addresses_[std::move(k)] = std::move(r.addresses);
+    }
+
+    /** Add a connect override.
+    */
+    void
+    add(connect_override c)
+    {
+        c.host = lower(c.host);
+        connects_.push_back(std::move(c));
+    }
+
+    /// Remove every override
+    void
+    clear() noexcept
+    {
+        addresses_.clear();
+        connects_.clear();
+    }
+
+    /// Return true if there are no overrides
+    bool
+    empty() const noexcept
+    {
+        return addresses_.empty() && connects_.empty();
+    }
+
+    /** Return where to connect for a request.
+
+        Applies the first matching connect override, or
+        returns the host and port unchanged.
+    */
+    target
+    route(std::string_view host, std::uint16_t port) const
+    {
+        auto const h = lower(host);
+        for(auto const& c : connects_)
+        {
+            if(!c.host.empty() && c.host != h)
+                continue;
+            if(c.port != 0 && c.port != port)
+                continue;
+            return target{
+                c.to_host.empty() ? std::string(host) : c.to_host,
+                c.to_port ? c.to_port : port};
+        }
+        return target{std::string(host), port};
+    }
+
+    /** Return the fixed addresses for a host and port.
+
+        @return The addresses, or null to use DNS
+    */
+    std::vector<std::string> const*
+    lookup(std::string_view host, std::uint16_t port) const
+    {
+        auto it = addresses_.find(key{lower(host), port});
+        if(it == addresses_.end())
+            it = addresses_.find(key{"*", port});
+        if(it == addresses_.end())
+            return nullptr;
+        return &it->second;
+    }
+
+private:
+    using key = std::pair<std::string, std::uint16_t>;
+
+    static
+    std::string
+    lower(std::string_view s)
+    {
+        std::string r(s);
+        std::transform(r.begin(), r.end(), r.begin(),
+            [](unsigned char c)
+            {
+                return static_cast<char>(std::tolower(c));
+            });
+        return r;
+    }
+
+    std::map<key, std::vector<std::string>> addresses_;
+    std::vector<connect_override> connects_;
+};
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
@@ -0,0 +1,165 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_SHARED_STATE_HPP
+#define BOOST_BURL_SRC_DETAIL_SHARED_STATE_HPP
+
+#include <boost/corosio/io_context.hpp>
+#include <boost/corosio/socket.hpp>
+#include <boost/corosio/tls/openssl_stream.hpp>
+
+#include "src/detail/alt_svc_cache.hpp"
+#include "src/detail/exchange_state.hpp"
+#include "src/detail/hsts_store.hpp"
+#include "src/detail/timer_wheel.hpp"
+#include "src/detail/ttl_cache.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+// Things learned about an origin, kept across connections
+enum origin_capability : std::uint32_t
+{
+    // The origin negotiated HTTP/2 with ALPN
+    origin_h2 = 1,
+
+    // The origin resumed a TLS session
+    origin_tls_resumption = 2
+};
+
+// Key for connection pool lookup
+struct pool_key
+{
+    std::string host;
+    std::uint16_t port;
+    bool https;
+
+    // connection_settings() the connection was opened with,
+    // so that sessions of a share which verify, route or
+    // configure sockets differently never reuse each other's
+    // connections or TLS sessions. Empty in the per-origin
+    // keys used for limits and scheduling
+    std::string settings;
+
+    // Local address the connection is bound to. Empty in
+    // the per-origin keys; last, so the pools of one origin
+    // and settings sort together
+    std::string source;
+
+    auto operator<=>(pool_key const&) const = default;
+};
+
+// A pooled connection
+struct connection
+{
+    std::unique_ptr<corosio::socket> socket;
+    std::unique_ptr<corosio::openssl_stream> tls;
+
+    // The resolved address it is connected to
+    std::string address;
+
+    // The pool it belongs to, settings and source included
+    pool_key key;
+
+    // The request or idle timeout pending for it, if any
+    timer_wheel<connection*>::handle timer;
+
+    // How far the current exchange has got
+    exchange_state state;
+
+    // Set when a request timeout cancelled its I/O
+    bool timed_out = false;
+
+    // Set when the request's stop token cancelled its I/O
+    bool cancelled = false;
+
+    // When it was last returned to its pool
+    std::chrono::steady_clock::time_point idle_since;
+
+    // When it reaches its maximum age
+    std::chrono::steady_clock::time_point retire_at =
+        (std::chrono::steady_clock::time_point::max)();
+
+    // Returns the appropriate stream for I/O
+    corosio::io_stream&
+    stream()
+    {
+        // TODO: Return TLS stream if present, else socket
+        return *socket;
+    }
+};
+
+/** State which sessions may share.
+
+    Every session has one. Sessions constructed from a
+    @ref share hold the same one, so they draw on the same
+    connections, DNS answers, TLS sessions, HSTS hosts and
+    alternative services; everything else stays with each
+    session.
+
+    All users run on the one io_context, so no locking is
+    needed.
+*/
+struct shared_state
+{
+    // Most DNS answers and TLS sessions kept
+    static constexpr std::size_t cache_capacity = 1024;
+
+    shared_state(
+        corosio::io_context& ioc_,
+        corosio::tls::context& tls_ctx_)
+        : ioc(ioc_)
+        , tls_ctx(tls_ctx_)
+        , dns(cache_capacity)
+        , tls_sessions(cache_capacity)
+    {
+    }
+
+    corosio::io_context& ioc;
+    corosio::tls::context& tls_ctx;
+
+    // Connection pools keyed by (host, port, https, settings, source)
+    std::map<pool_key, std::vector<std::unique_ptr<connection>>> pools;
+
+    // Request and idle timeouts of every connection. Each
+    // session's timer advances it, so a pooled connection
+    // still times out after the session which pooled it is
+    // gone.
+    timer_wheel<connection*> timers;
+
+    // Resolved addresses by host name, until their TTL
+    ttl_cache<std::string, std::vector<std::string>> dns;
+
+    // Serialized TLS sessions for resumption, by origin and
+    // settings; the source is always empty
+    ttl_cache<pool_key, std::string> tls_sessions;
+
+    // origin_capability flags, by origin
+    std::map<pool_key, std::uint32_t> capabilities;
+
+    // Hosts known to require HTTPS
+    hsts_store hsts;
+
+    // Alternative services advertised by origins
+    alt_svc_cache alt_svc;
+};
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
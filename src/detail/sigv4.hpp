@@ -0,0 +1,535 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_SIGV4_HPP
+#define BOOST_BURL_SRC_DETAIL_SIGV4_HPP
+
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/*  AWS Signature Version 4.
+
+    The request is reduced to a canonical form, hashed, and
+    signed with a key derived from the secret and the day,
+    region and service. Everything is built by appending to
+    caller-owned strings, which a signer keeps and reuses,
+    so signing a request allocates only when a buffer grows.
+*/
+
+using sigv4_key = std::array<unsigned char, 32>;
+
+// Hex SHA-256 of nothing, the payload hash of an empty body
+constexpr std::string_view sigv4_empty_hash =
+    "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
+
+constexpr std::string_view sigv4_unsigned_payload = "UNSIGNED-PAYLOAD";
+
+constexpr std::string_view sigv4_streaming_payload =
+    "STREAMING-AWS4-HMAC-SHA256-PAYLOAD";
+
+/** Format a time as SigV4 wants it, "YYYYMMDDTHHMMSSZ" in UTC.
+
+    The first eight characters are the date of the scope.
+*/
+inline
+std::string
+format_amz_date(std::chrono::system_clock::time_point t)
+{
+    using namespace std::chrono;
+    auto const dp = floor<days>(t);
+    year_month_day const ymd(dp);
+    hh_mm_ss<seconds> const hms(floor<seconds>(t - dp));
+    char buf[32];
+    std::snprintf(buf, sizeof(buf),
+        "%04d%02u%02uT%02d%02d%02dZ",
+        static_cast<int>(ymd.year()),
+        static_cast<unsigned>(ymd.month()),
+        static_cast<unsigned>(ymd.day()),
+        static_cast<int>(hms.hours().count()),
+        static_cast<int>(hms.minutes().count()),
+        static_cast<int>(hms.seconds().count()));
+    return buf;
+}
+
+/// Append bytes as lowercase hex
+inline
+void
+append_hex(std::string& out, unsigned char const* p, std::size_t n)
+{
+    static constexpr char digits[] = "0123456789abcdef";
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        out.push_back(digits[p[i] >> 4]);
+        out.push_back(digits[p[i] & 15]);
+    }
+}
+
+/// Append the hex SHA-256 of data
+inline
+void
+append_sha256_hex(std::string& out, std::string_view data)
+{
+    unsigned char md[EVP_MAX_MD_SIZE];
+    unsigned int len = 0;
+    EVP_Digest(data.data(), data.size(), md, &len, EVP_sha256(), nullptr);
+    append_hex(out, md, len);
+}
+
+inline
+sigv4_key
+hmac_sha256(
+    void const* key,
+    std::size_t key_len,
+    std::string_view data)
+{
+    sigv4_key out;
+    unsigned int len = 0;
+    HMAC(EVP_sha256(), key, static_cast<int>(key_len),
+        reinterpret_cast<unsigned char const*>(data.data()),
+        data.size(), out.data(), &len);
+    return out;
+}
+
+/** Derive the signing key for a day, region and service.
+
+    This is four HMACs deep, and the result is the same for
+    every request that day, so callers cache it.
+*/
+inline
+sigv4_key
+sigv4_signing_key(
+    std::string_view secret,
+    std::string_view date,
+    std::string_view region,
+    std::string_view service)
+{
+    std::string k;
+    k.reserve(4 + secret.size());
+    k.append("AWS4").append(secret);
+    auto key = hmac_sha256(k.data(), k.size(), date);
+    key = hmac_sha256(key.data(), key.size(), region);
+    key = hmac_sha256(key.data(), key.size(), service);
+    return hmac_sha256(key.data(), key.size(), "aws4_request");
+}
+
+/** Signing keys by day, region and service.
+
+    One credential rarely signs for more than a few regions
+    and services at once, and keys roll over daily, so a few
+    entries with the oldest replaced first are enough.
+*/
+class sigv4_key_cache
+{
+public:
+    static constexpr std::size_t capacity = 8;
+
+    sigv4_key
+    get(
+        std::string_view secret,
+        std::string_view date,
+        std::string_view region,
+        std::string_view service)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for(auto const& e : entries_)
+            if( e.date == date &&
+                e.region == region &&
+                e.service == service)
+                return e.key;
+        entry e{
+            std::string(date),
+            std::string(region),
+            std::string(service),
+            sigv4_signing_key(secret, date, region, service)};
+        if(entries_.size() < capacity)
+        {
+            entries_.push_back(std::move(e));
+            return entries_.back().key;
+        }
+        auto& slot = entries_[next_];
+        next_ = (next_ + 1) % capacity;
+        slot = std::move(e);
+        return slot.key;
+    }
+
+    std::size_t
+    size() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return entries_.size();
+    }
+
+private:
+    struct entry
+    {
+        std::string date;
+        std::string region;
+        std::string service;
+        sigv4_key key;
+    };
+
+    mutable std::mutex mutex_;
+    std::vector<entry> entries_;
+    std::size_t next_ = 0;
+};
+
+//----------------------------------------------------------
+
+/** Append s percent-encoded as SigV4 requires.
+
+    Everything but unreserved characters is encoded, in
+    uppercase hex; '/' is kept when encoding a path.
+*/
+inline
+void
+sigv4_encode(std::string& out, std::string_view s, bool keep_slash)
+{
+    static constexpr char digits[] = "0123456789ABCDEF";
+    for(char c : s)
+    {
+        bool const unreserved =
+            (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') ||
+            (c >= '0' && c <= '9') ||
+            c == '-' || c == '_' || c == '.' || c == '~' ||
+            (keep_slash && c == '/');
+        if(unreserved)
+        {
+            out.push_back(c);
+            continue;
+        }
+        auto const u = static_cast<unsigned char>(c);
+        out.push_back('%');
+        out.push_back(digits[u >> 4]);
+        out.push_back(digits[u & 15]);
+    }
+}
+
+/** Append s with percent-escapes decoded, and '+' as is.
+*/
+inline
+void
+sigv4_decode(std::string& out, std::string_view s)
+{
+    auto nibble = [](char c) -> int
+    {
+        if(c >= '0' && c <= '9')
+            return c - '0';
+        if(c >= 'a' && c <= 'f')
+            return c - 'a' + 10;
+        if(c >= 'A' && c <= 'F')
+            return c - 'A' + 10;
+        return -1;
+    };
+    for(std::size_t i = 0; i < s.size(); ++i)
+    {
+        if(s[i] == '%' && i + 2 < s.size() &&
+            nibble(s[i + 1]) >= 0 && nibble(s[i + 2]) >= 0)
+        {
+            out.push_back(static_cast<char>(
+                (nibble(s[i + 1]) << 4) | nibble(s[i + 2])));
+            i += 2;
+            continue;
+        }
+        out.push_back(s[i]);
+    }
+}
+
+/** Builds canonical requests and signatures.
+
+    The buffers are reused from one request to the next.
+*/
+class sigv4_builder
+{
+public:
+    /// A request header, as sent
+    using header = std::pair<std::string_view, std::string_view>;
+
+    /** Append the canonical request to out.
+
+        @param path The request path, percent-encoded as sent;
+            S3 paths are used as they are, other services
+            encode them a second time
+        @param query The query without the '?', as sent
+        @param headers Every header to sign
+        @param signed_headers Set to the ';'-separated names
+    */
+    void
+    canonical_request(
+        std::string& out,
+        std::string_view method,
+        std::string_view path,
+        std::string_view query,
+        std::vector<header> const& headers,
+        std::string_view payload_hash,
+        bool double_encode,
+        std::string& signed_headers)
+    {
+        out.append(method).push_back('\n');
+
+        if(path.empty())
+            path = "/";
+        if(double_encode)
+        {
+            sigv4_encode(out, path, true);
+        }
+        else
+        {
+            scratch_.clear();
+            sigv4_decode(scratch_, path);
+            sigv4_encode(out, scratch_, true);
+        }
+        out.push_back('\n');
+
+        append_query(out, query);
+        out.push_back('\n');
+
+        append_headers(out, headers, signed_headers);
+        out.push_back('\n');
+        out.append(signed_headers).push_back('\n');
+        out.append(payload_hash);
+    }
+
+    /** Append the string to sign.
+
+        @param scope "date/region/service/aws4_request"
+    */
+    static
+    void
+    string_to_sign(
+        std::string& out,
+        std::string_view amz_date,
+        std::string_view scope,
+        std::string_view canonical)
+    {
+        out.append("AWS4-HMAC-SHA256\n");
+        out.append(amz_date).push_back('\n');
+        out.append(scope).push_back('\n');
+        append_sha256_hex(out, canonical);
+    }
+
+    /** Append the string to sign for one chunk of a streamed
+        payload; it chains from the previous signature.
+    */
+    static
+    void
+    chunk_string_to_sign(
+        std::string& out,
+        std::string_view amz_date,
+        std::string_view scope,
+        std::string_view previous,
+        std::string_view chunk)
+    {
+        out.append("AWS4-HMAC-SHA256-PAYLOAD\n");
+        out.append(amz_date).push_back('\n');
+        out.append(scope).push_back('\n');
+        out.append(previous).push_back('\n');
+        out.append(sigv4_empty_hash).push_back('\n');
+        append_sha256_hex(out, chunk);
+    }
+
+    /// Append the hex signature of a string to sign
+    static
+    void
+    sign(std::string& out, sigv4_key const& key, std::string_view sts)
+    {
+        auto const mac = hmac_sha256(key.data(), key.size(), sts);
+        append_hex(out, mac.data(), mac.size());
+    }
+
+private:
+    struct slice
+    {
+        std::size_t pos;
+        std::size_t len;
+    };
+
+    std::string_view
+    view(slice s) const noexcept
+    {
+        return std::string_view(scratch_).substr(s.pos, s.len);
+    }
+
+    // Parameters sorted by encoded name, then value
+    void
+    append_query(std::string& out, std::string_view query)
+    {
+        scratch_.clear();
+        params_.clear();
+        while(!query.empty())
+        {
+            auto const amp = query.find('&');
+            auto item = query.substr(0, amp);
+            query = amp == std::string_view::npos ?
+                std::string_view() : query.substr(amp + 1);
+            if(item.empty())
+                continue;
+            auto const eq = item.find('=');
+            auto const name = item.substr(0, eq);
+            auto const value = eq == std::string_view::npos ?
+                std::string_view() : item.substr(eq + 1);
+
+            slice n{scratch_.size(), 0};
+            decoded_.clear();
+            sigv4_decode(decoded_, name);
+            sigv4_encode(scratch_, decoded_, false);
+            n.len = scratch_.size() - n.pos;
+
+            slice v{scratch_.size(), 0};
+            decoded_.clear();
+            sigv4_decode(decoded_, value);
+            sigv4_encode(scratch_, decoded_, false);
+            v.len = scratch_.size() - v.pos;
+            params_.push_back({n, v});
+        }
+        std::sort(params_.begin(), params_.end(),
+            [this](auto const& a, auto const& b)
+            {
+                auto const an = view(a.first), bn = view(b.first);
+                if(an != bn)
+                    return an < bn;
+                return view(a.second) < view(b.second);
+            });
+        bool first = true;
+        for(auto const& [n, v] : params_)
+        {
+            if(!first)
+                out.push_back('&');
+            first = false;
+            out.append(view(n)).push_back('=');
+            out.append(view(v));
+        }
+    }
+
+    // Lowercase names in order, values trimmed with inner
+    // runs of spaces collapsed, repeats joined by commas
+    void
+    append_headers(
+        std::string& out,
+        std::vector<header> const& headers,
+        std::string& signed_headers)
+    {
+        scratch_.clear();
+        names_.clear();
+        for(std::size_t i = 0; i < headers.size(); ++i)
+        {
+            slice n{scratch_.size(), headers[i].first.size()};
+            for(char c : headers[i].first)
+                scratch_.push_back(
+                    c >= 'A' && c <= 'Z' ? static_cast<char>(c + 32) : c);
+            names_.push_back({n, i});
+        }
+        std::stable_sort(names_.begin(), names_.end(),
+            [this](auto const& a, auto const& b)
+            {
+                return view(a.first) < view(b.first);
+            });
+
+        signed_headers.clear();
+        for(std::size_t i = 0; i < names_.size(); ++i)
+        {
+            auto const name = view(names_[i].first);
+            bool const repeat =
+                i > 0 && view(names_[i - 1].first) == name;
+            if(repeat)
+            {
+                out.back() = ',';
+            }
+            else
+            {
+                if(!signed_headers.empty())
+                    signed_headers.push_back(';');
+                signed_headers.append(name);
+                out.append(name).push_back(':');
+            }
+            append_value(out, headers[names_[i].second].second);
+            out.push_back('\n');
+        }
+    }
+
+    static
+    void
+    append_value(std::string& out, std::string_view v)
+    {
+        auto const ws = [](char c) { return c == ' ' || c == '\t'; };
+        while(!v.empty() && ws(v.front()))
+            v.remove_prefix(1);
+        while(!v.empty() && ws(v.back()))
+            v.remove_suffix(1);
+        bool space = false;
+        for(char c : v)
+        {
+            if(ws(c))
+            {
+                space = true;
+                continue;
+            }
+            if(space)
+                out.push_back(' ');
+            space = false;
+            out.push_back(c);
+        }
+    }
+
+    std::string scratch_;
+    std::string decoded_;
+    std::vector<std::pair<slice, slice>> params_;
+    std::vector<std::pair<slice, std::size_t>> names_;
+};
+
+/** Return the size of a payload sent with aws-chunked encoding.
+
+    Each chunk is framed as
+    "<hex size>;chunk-signature=<64 hex>\r\n<data>\r\n", and
+    an empty chunk ends the payload. Content-Length must be
+    this, with the real size in x-amz-decoded-content-length.
+*/
+inline
+std::uint64_t
+aws_chunked_length(std::uint64_t decoded, std::uint64_t chunk_size)
+{
+    auto frame = [](std::uint64_t n)
+    {
+        std::uint64_t digits = 1;
+        for(auto v = n; v >= 16; v /= 16)
+            ++digits;
+        return digits + 17 + 64 + 2 + n + 2;
+    };
+    std::uint64_t total = 0;
+    if(chunk_size == 0)
+        chunk_size = decoded;
+    if(decoded > 0)
+    {
+        total += (decoded / chunk_size) * frame(chunk_size);
+        if(decoded % chunk_size)
+            total += frame(decoded % chunk_size);
+    }
+    return total + frame(0);
+}
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
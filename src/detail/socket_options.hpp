@@ -0,0 +1,173 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_SOCKET_OPTIONS_HPP
+#define BOOST_BURL_SRC_DETAIL_SOCKET_OPTIONS_HPP
+
+#include <boost/burl/options.hpp>
+
+#include <climits>
+#include <system_error>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#include <mstcpip.h>
+#else
+#include <cerrno>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#endif
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+#ifdef _WIN32
+using native_socket = SOCKET;
+#else
+using native_socket = int;
+#endif
+
+inline
+std::error_code
+last_socket_error() noexcept
+{
+#ifdef _WIN32
+    return std::error_code(
+        ::WSAGetLastError(), std::system_category());
+#else
+    return std::error_code(errno, std::system_category());
+#endif
+}
+
+// Set an integer socket option
+inline
+std::error_code
+set_int_option(
+    native_socket s,
+    int level,
+    int name,
+    int value) noexcept
+{
+#ifdef _WIN32
+    auto const p = reinterpret_cast<char const*>(&value);
+#else
+    auto const p = &value;
+#endif
+    if(::setsockopt(s, level, name, p, sizeof(value)) != 0)
+        return last_socket_error();
+    return {};
+}
+
+inline
+int
+clamp_int(long long v) noexcept
+{
+    return v > INT_MAX ? INT_MAX : static_cast<int>(v);
+}
+
+/** Apply socket options to a TCP socket before it connects.
+
+    Buffer sizes must be set before the handshake for the
+    window scale to account for them, and Fast Open and
+    deferred port binding only take effect on a socket which
+    has not yet connected.
+
+    @return The first error from a required option. Failures
+        of the hints, Fast Open and deferred port binding, are
+        ignored.
+*/
+inline
+std::error_code
+apply_socket_options(
+    native_socket s,
+    socket_options const& opts) noexcept
+{
+    std::error_code ec;
+
+    if(opts.tcp_nodelay)
+    {
+        ec = set_int_option(s, IPPROTO_TCP, TCP_NODELAY, 1);
+        if(ec)
+            return ec;
+    }
+
+    if(opts.keepalive)
+    {
+        ec = set_int_option(s, SOL_SOCKET, SO_KEEPALIVE, 1);
+        if(ec)
+            return ec;
+        auto const idle = clamp_int(opts.keepalive_idle.count());
+        auto const intvl = clamp_int(opts.keepalive_interval.count());
+#if defined(TCP_KEEPIDLE)
+        ec = set_int_option(s, IPPROTO_TCP, TCP_KEEPIDLE, idle);
+#elif defined(TCP_KEEPALIVE)
+        // macOS spells it differently
+        ec = set_int_option(s, IPPROTO_TCP, TCP_KEEPALIVE, idle);
+#endif
+        if(ec)
+            return ec;
+#if defined(TCP_KEEPINTVL)
+        ec = set_int_option(s, IPPROTO_TCP, TCP_KEEPINTVL, intvl);
+        if(ec)
+            return ec;
+#endif
+#if defined(TCP_KEEPCNT)
+        if(opts.keepalive_count != 0)
+        {
+            ec = set_int_option(s, IPPROTO_TCP, TCP_KEEPCNT,
+                clamp_int(opts.keepalive_count));
+            if(ec)
+                return ec;
+        }
+#endif
+        (void)idle;
+        (void)intvl;
+    }
+
+    if(opts.receive_buffer != 0)
+    {
+        ec = set_int_option(s, SOL_SOCKET, SO_RCVBUF,
+            clamp_int(static_cast<long long>(opts.receive_buffer)));
+        if(ec)
+            return ec;
+    }
+
+    if(opts.send_buffer != 0)
+    {
+        ec = set_int_option(s, SOL_SOCKET, SO_SNDBUF,
+            clamp_int(static_cast<long long>(opts.send_buffer)));
+        if(ec)
+            return ec;
+    }
+
+#if defined(TCP_FASTOPEN_CONNECT)
+    // Linux: connect() returns at once and the first write
+    // goes out with the SYN
+    if(opts.tcp_fastopen)
+        (void)set_int_option(s, IPPROTO_TCP, TCP_FASTOPEN_CONNECT, 1);
+#endif
+
+#if defined(IP_BIND_ADDRESS_NO_PORT)
+    // Lets a bind() to a source address share ephemeral ports
+    // across destinations; harmless when nothing is bound
+    if(opts.bind_address_no_port)
+        (void)set_int_option(s, IPPROTO_IP, IP_BIND_ADDRESS_NO_PORT, 1);
+#endif
+
+    return {};
+}
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
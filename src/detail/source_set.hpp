@@ -0,0 +1,230 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_SOURCE_SET_HPP
+#define BOOST_BURL_SRC_DETAIL_SOURCE_SET_HPP
+
+#include <boost/burl/options.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <ifaddrs.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#endif
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/** Return true if `s` is a numeric IPv4 or IPv6 address.
+*/
+inline
+bool
+is_numeric_address(std::string_view s)
+{
+    std::string const z(s);
+    unsigned char buf[sizeof(in6_addr)];
+    return
+        ::inet_pton(AF_INET, z.c_str(), buf) == 1 ||
+        ::inet_pton(AF_INET6, z.c_str(), buf) == 1;
+}
+
+/** Return the address family of a numeric address.
+
+    @return AF_INET, AF_INET6, or AF_UNSPEC if `s` is not
+        a numeric address
+*/
+inline
+int
+address_family(std::string_view s)
+{
+    std::string const z(s);
+    unsigned char buf[sizeof(in6_addr)];
+    if(::inet_pton(AF_INET, z.c_str(), buf) == 1)
+        return AF_INET;
+    if(::inet_pton(AF_INET6, z.c_str(), buf) == 1)
+        return AF_INET6;
+    return AF_UNSPEC;
+}
+
+/** Return the addresses assigned to a network interface.
+
+    Link-local IPv6 addresses are left out, since they need
+    a scope to be usable. On platforms without `getifaddrs`
+    the result is empty.
+*/
+inline
+std::vector<std::string>
+interface_addresses(std::string_view name)
+{
+    std::vector<std::string> v;
+#ifndef _WIN32
+    ifaddrs* list = nullptr;
+    if(::getifaddrs(&list) != 0)
+        return v;
+    for(auto p = list; p; p = p->ifa_next)
+    {
+        if(!p->ifa_addr || name != p->ifa_name)
+            continue;
+        char buf[INET6_ADDRSTRLEN];
+        if(p->ifa_addr->sa_family == AF_INET)
+        {
+            auto sin = reinterpret_cast<sockaddr_in*>(p->ifa_addr);
+            if(::inet_ntop(AF_INET, &sin->sin_addr, buf, sizeof(buf)))
+                v.emplace_back(buf);
+        }
+        else if(p->ifa_addr->sa_family == AF_INET6)
+        {
+            auto sin6 = reinterpret_cast<sockaddr_in6*>(p->ifa_addr);
+            if(IN6_IS_ADDR_LINKLOCAL(&sin6->sin6_addr))
+                continue;
+            if(::inet_ntop(AF_INET6, &sin6->sin6_addr, buf, sizeof(buf)))
+                v.emplace_back(buf);
+        }
+    }
+    ::freeifaddrs(list);
+#else
+    (void)name;
+#endif
+    return v;
+}
+
+/** The local addresses new connections bind to, in turn.
+
+    A socket can only bind to an address of its own family,
+    so each family takes its turn separately: connecting to
+    an IPv6 endpoint picks the next IPv6 source.
+*/
+class source_set
+{
+public:
+    /** Set the addresses and port range.
+
+        Interface names are replaced by the addresses of the
+        interface. Names which match no interface are kept
+        as given, so that binding reports the error.
+    */
+    void
+    assign(source_binding const& b)
+    {
+        addresses_.clear();
+        families_.clear();
+        next4_ = 0;
+        next6_ = 0;
+        for(auto const& a : b.addresses)
+        {
+            if(is_numeric_address(a))
+            {
+                add(a);
+                continue;
+            }
+            auto v = interface_addresses(a);
+            if(v.empty())
+                add(a);
+            else
+                for(auto const& x : v)
+                    add(x);
+        }
+        first_port_ = b.first_port;
+        last_port_ = b.last_port < b.first_port ?
+            b.first_port : b.last_port;
+    }
+
+    /// Return true if connections need not be bound
+    bool
+    empty() const noexcept
+    {
+        return addresses_.empty() && first_port_ == 0;
+    }
+
+    /// Return the addresses
+    std::vector<std::string> const&
+    addresses() const noexcept
+    {
+        return addresses_;
+    }
+
+    /** Return the address for the next connection.
+
+        Names which are not addresses, kept so that binding
+        reports them, are offered for either family.
+
+        @param family The endpoint's family, AF_INET or AF_INET6
+
+        @return The address, an empty string for any, or
+            nullptr if addresses are set but none is of the
+            endpoint's family, which then cannot be used
+    */
+    std::string const*
+    next(int family)
+    {
+        static std::string const any;
+        if(addresses_.empty())
+            return &any;
+        auto& cursor = family == AF_INET6 ? next6_ : next4_;
+        auto const n = addresses_.size();
+        for(std::size_t k = 0; k < n; ++k)
+        {
+            auto const i = (cursor + k) % n;
+            if( families_[i] == family ||
+                families_[i] == AF_UNSPEC)
+            {
+                cursor = (i + 1) % n;
+                return &addresses_[i];
+            }
+        }
+        return nullptr;
+    }
+
+    /// Return the first local port to try (0 = any)
+    std::uint16_t
+    first_port() const noexcept
+    {
+        return first_port_;
+    }
+
+    /// Return the last local port to try
+    std::uint16_t
+    last_port() const noexcept
+    {
+        return last_port_;
+    }
+
+private:
+    void
+    add(std::string const& a)
+    {
+        addresses_.push_back(a);
+        families_.push_back(address_family(a));
+    }
+
+    std::vector<std::string> addresses_;
+    std::vector<int> families_;
+    std::size_t next4_ = 0;
+    std::size_t next6_ = 0;
+    std::uint16_t first_port_ = 0;
+    std::uint16_t last_port_ = 0;
+};
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
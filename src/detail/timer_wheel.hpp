@@ -0,0 +1,418 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_TIMER_WHEEL_HPP
+#define BOOST_BURL_SRC_DETAIL_TIMER_WHEEL_HPP
+
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/** A hierarchical timer wheel.
+
+    Holds any number of timers behind a single clock: the
+    owner arms one real timer for @ref next_expiry and calls
+    @ref advance when it fires. Adding and cancelling a timer
+    are O(1), independent of how many are pending.
+
+    There are four levels of 64 slots. Level 0 holds timers
+    due within 64 ticks, each slot one tick; each higher level
+    covers 64 times the span of the one below, and its timers
+    are moved down a level when their slot comes up. Timers
+    beyond the top level wait in its last slot and are placed
+    again when it is reached.
+
+    Timers fire at the first tick boundary at or after their
+    expiry, so up to one tick late and never early.
+
+    @tparam T The value returned when a timer fires
+*/
+template<class T>
+class timer_wheel
+{
+public:
+    using clock_type = std::chrono::steady_clock;
+    using time_point = clock_type::time_point;
+    using duration = clock_type::duration;
+
+    /** Identifies a pending timer.
+
+        A handle outlives its timer safely: once the timer has
+        fired or been cancelled, cancelling again does nothing.
+    */
+    struct handle
+    {
+        std::uint32_t index = npos;
+        std::uint32_t generation = 0;
+    };
+
+    /** Constructor.
+
+        @param tick The resolution of the wheel
+        @param start The time of tick zero
+    */
+    explicit
+    timer_wheel(
+        duration tick = std::chrono::milliseconds(1),
+        time_point start = clock_type::now()) noexcept
+        : tick_(tick.count() > 0 ? tick : duration(1))
+        , start_(start)
+    {
+        for(auto& level : heads_)
+            level.fill(npos);
+    }
+
+    /// Return the number of pending timers
+    std::size_t
+    size() const noexcept
+    {
+        return size_;
+    }
+
+    /// Return true if no timers are pending
+    bool
+    empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    /** Add a timer.
+
+        A timer whose expiry has already passed fires on the
+        next call to @ref advance.
+    */
+    handle
+    add(time_point expiry, T value)
+    {
+        std::uint32_t i;
+        if(free_ != npos)
+        {
+            i = free_;
+            free_ = nodes_[i].next;
+        }
+        else
+        {
+            i = static_cast<std::uint32_t>(nodes_.size());
+            nodes_.emplace_back();
+        }
+        auto& n = nodes_[i];
+        n.value = std::move(value);
+        n.expiry = to_tick(expiry);
+        n.active = true;
+        ++size_;
+        place(i);
+        return handle{i, n.generation};
+    }
+
+    /** Cancel a timer.
+
+        @return true if the timer was pending
+    */
+    bool
+    cancel(handle h) noexcept
+    {
+        if(h.index >= nodes_.size())
+            return false;
+        auto& n = nodes_[h.index];
+        if(!n.active || n.generation != h.generation)
+            return false;
+        unlink(h.index);
+        release(h.index);
+        return true;
+    }
+
+    /** Fire every timer due at `now`.
+
+        The values of fired timers are appended to `out` in
+        expiry order; timers with the same tick come out in
+        no particular order.
+    */
+    void
+    advance(time_point now, std::vector<T>& out)
+    {
+        auto const target = to_tick_floor(now);
+        drain(overdue_, out);
+        while(now_ < target && size_ != 0)
+        {
+            auto const t = next_tick();
+            if(t > target)
+                break;
+            now_ = t;
+
+            // Move timers down from every level whose slot
+            // begins at this tick, the highest first
+            for(std::size_t l = levels - 1; l > 0; --l)
+            {
+                if((now_ & mask(l)) != 0)
+                    continue;
+                cascade(l, digit(now_, l));
+            }
+            fire_slot(out);
+            drain(overdue_, out);
+        }
+        if(now_ < target)
+            now_ = target;
+    }
+
+    /** Return when @ref advance should next be called.
+
+        This is exact for timers due within 64 ticks. For
+        later timers it may be earlier than their expiry, when
+        they must move down a level.
+
+        @return The time, or `std::nullopt` if none are pending
+    */
+    std::optional<time_point>
+    next_expiry() const noexcept
+    {
+        if(size_ == 0)
+            return std::nullopt;
+        if(overdue_ != npos)
+            return to_time(now_);
+        return to_time(next_tick());
+    }
+
+private:
+    static constexpr std::uint32_t npos = 0xffffffff;
+    static constexpr std::size_t levels = 4;
+    static constexpr unsigned bits = 6;
+    static constexpr std::size_t slots = std::size_t(1) << bits;
+
+    struct node
+    {
+        T value{};
+        std::uint64_t expiry = 0;
+        std::uint32_t prev = npos;
+        std::uint32_t next = npos;
+        std::uint32_t generation = 0;
+        std::uint8_t level = 0;
+        std::uint8_t slot = 0;
+        bool active = false;
+        bool overdue = false;
+    };
+
+    // Ticks covered by one slot at level l, minus one
+    static constexpr std::uint64_t
+    mask(std::size_t l) noexcept
+    {
+        return (std::uint64_t(1) << (bits * l)) - 1;
+    }
+
+    static constexpr std::size_t
+    digit(std::uint64_t t, std::size_t l) noexcept
+    {
+        return static_cast<std::size_t>(
+            (t >> (bits * l)) & (slots - 1));
+    }
+
+    // Round up, so timers never fire early
+    std::uint64_t
+    to_tick(time_point t) const noexcept
+    {
+        if(t <= start_)
+            return 0;
+        auto const d = t - start_;
+        return static_cast<std::uint64_t>(
+            (d + tick_ - duration(1)) / tick_);
+    }
+
+    std::uint64_t
+    to_tick_floor(time_point t) const noexcept
+    {
+        if(t <= start_)
+            return 0;
+        return static_cast<std::uint64_t>((t - start_) / tick_);
+    }
+
+    time_point
+    to_time(std::uint64_t t) const noexcept
+    {
+        return start_ + tick_ * static_cast<duration::rep>(t);
+    }
+
+    // Put a node in the slot for its expiry
+    void
+    place(std::uint32_t i) noexcept
+    {
+        auto& n = nodes_[i];
+        if(n.expiry <= now_)
+        {
+            n.overdue = true;
+            push(overdue_, i);
+            return;
+        }
+        n.overdue = false;
+        std::size_t l = 0;
+        while(l < levels &&
+            (n.expiry >> (bits * (l + 1))) !=
+                (now_ >> (bits * (l + 1))))
+            ++l;
+        std::size_t s;
+        if(l < levels)
+        {
+            s = digit(n.expiry, l);
+        }
+        else if(n.expiry - now_ < (std::uint64_t(1) << (bits * levels)))
+        {
+            // Within one turn of the top level: its slot wraps
+            // into the next turn, which comes before the expiry
+            l = levels - 1;
+            s = digit(n.expiry, l);
+        }
+        else
+        {
+            // Beyond the wheel: the top slot reached last
+            l = levels - 1;
+            s = (digit(now_, l) + slots - 1) & (slots - 1);
+        }
+        n.level = static_cast<std::uint8_t>(l);
+        n.slot = static_cast<std::uint8_t>(s);
+        push(heads_[l][s], i);
+        occupied_[l] |= std::uint64_t(1) << s;
+    }
+
+    void
+    push(std::uint32_t& head, std::uint32_t i) noexcept
+    {
+        auto& n = nodes_[i];
+        n.prev = npos;
+        n.next = head;
+        if(head != npos)
+            nodes_[head].prev = i;
+        head = i;
+    }
+
+    void
+    unlink(std::uint32_t i) noexcept
+    {
+        auto& n = nodes_[i];
+        auto& head = n.overdue ?
+            overdue_ : heads_[n.level][n.slot];
+        if(n.prev != npos)
+            nodes_[n.prev].next = n.next;
+        else
+            head = n.next;
+        if(n.next != npos)
+            nodes_[n.next].prev = n.prev;
+        if(!n.overdue && head == npos)
+            occupied_[n.level] &= ~(std::uint64_t(1) << n.slot);
+    }
+
+    void
+    release(std::uint32_t i) noexcept
+    {
+        auto& n = nodes_[i];
+        n.active = false;
+        ++n.generation;
+        n.value = T{};
+        n.next = free_;
+        free_ = i;
+        --size_;
+    }
+
+    // Fire every node in a list
+    void
+    drain(std::uint32_t& head, std::vector<T>& out)
+    {
+        while(head != npos)
+        {
+            auto const i = head;
+            head = nodes_[i].next;
+            out.push_back(std::move(nodes_[i].value));
+            release(i);
+        }
+    }
+
+    // Fire the level 0 slot for the current tick
+    void
+    fire_slot(std::vector<T>& out)
+    {
+        auto const s = digit(now_, 0);
+        occupied_[0] &= ~(std::uint64_t(1) << s);
+        drain(heads_[0][s], out);
+    }
+
+    // Move the nodes in a slot down to lower levels
+    void
+    cascade(std::size_t l, std::size_t s) noexcept
+    {
+        auto head = heads_[l][s];
+        heads_[l][s] = npos;
+        occupied_[l] &= ~(std::uint64_t(1) << s);
+        while(head != npos)
+        {
+            auto const i = head;
+            head = nodes_[i].next;
+            place(i);
+        }
+    }
+
+    // Return the first tick after now_ at which a slot fires
+    // or cascades
+    std::uint64_t
+    next_tick() const noexcept
+    {
+        auto best = (std::numeric_limits<std::uint64_t>::max)();
+        for(std::size_t l = 0; l < levels; ++l)
+        {
+            auto const occ = occupied_[l];
+            if(occ == 0)
+                continue;
+            auto const d = digit(now_, l);
+            auto const span = bits * (l + 1);
+            auto const base = (now_ >> span) << span;
+
+            // Slots after the current one, in this window
+            auto const ahead = d + 1 < slots ?
+                occ & (~std::uint64_t(0) << (d + 1)) : 0;
+            std::uint64_t t;
+            if(ahead != 0)
+            {
+                t = base + (std::uint64_t(std::countr_zero(ahead))
+                    << (bits * l));
+            }
+            else
+            {
+                // Only the top level wraps into the next window
+                t = base + (std::uint64_t(1) << span) +
+                    (std::uint64_t(std::countr_zero(occ))
+                        << (bits * l));
+            }
+            if(t < best)
+                best = t;
+        }
+        return best;
+    }
+
+    duration tick_;
+    time_point start_;
+    std::uint64_t now_ = 0;
+    std::vector<node> nodes_;
+    std::array<std::array<std::uint32_t, slots>, levels> heads_;
+    std::array<std::uint64_t, levels> occupied_{};
+    std::uint32_t overdue_ = npos;
+    std::uint32_t free_ = npos;
+    std::size_t size_ = 0;
+};
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
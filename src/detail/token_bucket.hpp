@@ -0,0 +1,178 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_TOKEN_BUCKET_HPP
+#define BOOST_BURL_SRC_DETAIL_TOKEN_BUCKET_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/** A token bucket rate limiter.
+
+    The bucket is stored in its "virtual scheduling" form
+    (GCRA): instead of a token count refilled on every call,
+    it keeps the theoretical arrival time of the next token.
+    A reservation pushes that time forward and returns the
+    point at which the caller may proceed, so the bucket
+    never needs a timer of its own and waiters never poll.
+
+    Reservations may go into debt. A caller that transfers a
+    large chunk waits once for the whole chunk, and the next
+    caller waits for the remainder of the debt. Waits shorter
+    than the granularity are returned as "now" so that small
+    transfers do not arm a timer each; the debt they incur is
+    still charged and is paid by a later, longer wait.
+
+    A default-constructed bucket is unlimited.
+*/
+class token_bucket
+{
+public:
+    using clock_type = std::chrono::steady_clock;
+    using time_point = clock_type::time_point;
+    using duration = std::chrono::nanoseconds;
+
+    /// Waits shorter than this are not worth a timer wakeup
+    static constexpr duration default_granularity =
+        std::chrono::milliseconds(10);
+
+    /** Constructor.
+
+        Constructs an unlimited bucket.
+    */
+    token_bucket() = default;
+
+    /** Constructor.
+
+        @param count Tokens added per interval (0 = unlimited)
+        @param interval The refill interval
+        @param burst Maximum tokens which may accumulate while
+            idle (0 = one interval's worth)
+        @param granularity Waits shorter than this are rounded
+            down to zero
+    */
+    token_bucket(
+        std::uint64_t count,
+        duration interval,
+        std::uint64_t burst = 0,
+        duration granularity = default_granularity) noexcept
+        : granularity_(granularity)
+    {
+        if(count == 0 || interval <= duration::zero())
+            return;
+        cost_ = static_cast<double>(interval.count()) /
+            static_cast<double>(count);
+        if(burst == 0)
+            burst = count;
+        tolerance_ = duration(static_cast<duration::rep>(
+            cost_ * static_cast<double>(burst)));
+    }
+
+    /** Return true if the bucket does not limit anything.
+    */
+    bool
+    unlimited() const noexcept
+    {
+        return cost_ == 0;
+    }
+
+    /** Reserve tokens.
+
+        Charges `n` tokens against the bucket and returns the
+        time at which the caller may proceed. The returned time
+        is never earlier than `now`.
+
+        @param n The number of tokens to take
+        @param now The current time
+    */
+    time_point
+    reserve(std::uint64_t n, time_point now) noexcept
+    {
+        if(unlimited())
+            return now;
+        tat_ = (std::max)(tat_, now) + duration(
+            static_cast<duration::rep>(
+                cost_ * static_cast<double>(n)));
+        auto const ready = tat_ - tolerance_;
+        if(ready <= now + granularity_)
+            return now;
+        return ready;
+    }
+
+    /** Return the time at which `n` tokens would be available.
+
+        Unlike @ref reserve, this does not charge the bucket.
+    */
+    time_point
+    peek(std::uint64_t n, time_point now) const noexcept
+    {
+        if(unlimited())
+            return now;
+        auto const ready = (std::max)(tat_, now) + duration(
+            static_cast<duration::rep>(
+                cost_ * static_cast<double>(n))) - tolerance_;
+        return (std::max)(ready, now);
+    }
+
+    /** Return the number of tokens to move per wakeup.
+
+        Sizing each transfer to one granularity's worth of
+        tokens keeps the number of timer wakeups bounded by
+        the granularity rather than by the transfer size.
+
+        @param limit The largest useful quantum, typically
+            the size of the I/O buffer
+    */
+    std::uint64_t
+    quantum(std::uint64_t limit) const noexcept
+    {
+        if(unlimited())
+            return limit;
+        auto const q = static_cast<std::uint64_t>(
+            static_cast<double>(granularity_.count()) / cost_);
+        return std::clamp<std::uint64_t>(q, 1, limit);
+    }
+
+private:
+    double cost_ = 0;               // nanoseconds per token
+    duration tolerance_{};          // burst allowance
+    duration granularity_ = default_granularity;
+    time_point tat_{};              // theoretical arrival time
+};
+
+/** Return when a transfer may proceed under two buckets.
+
+    Both buckets are charged. Either pointer may be null.
+*/
+inline
+token_bucket::time_point
+reserve_both(
+    token_bucket* a,
+    token_bucket* b,
+    std::uint64_t n,
+    token_bucket::time_point now) noexcept
+{
+    auto t = now;
+    if(a)
+        t = (std::max)(t, a->reserve(n, now));
+    if(b)
+        t = (std::max)(t, b->reserve(n, now));
+    return t;
+}
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
@@ -0,0 +1,191 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_TTL_CACHE_HPP
+#define BOOST_BURL_SRC_DETAIL_TTL_CACHE_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <list>
+#include <map>
+#include <utility>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/** A bounded cache of values which expire.
+
+    Each entry carries its own expiry. Lookups never return
+    an expired entry, and when the cache is full the least
+    recently used entry makes room for a new one.
+
+    @tparam Key The lookup key, ordered by `operator<`
+    @tparam Value The cached value
+*/
+template<class Key, class Value>
+class ttl_cache
+{
+public:
+    using clock_type = std::chrono::steady_clock;
+    using time_point = clock_type::time_point;
+
+    /** Constructor.
+
+        @param capacity The most entries kept (0 = unbounded)
+    */
+    explicit
+    ttl_cache(std::size_t capacity = 0) noexcept
+        : capacity_(capacity)
+    {
+    }
+
+    /// Return the number of entries, expired ones included
+    std::size_t
+    size() const noexcept
+    {
+        return index_.size();
+    }
+
+    /** Add or replace an entry.
+
+        @param key The key
+        @param value The value
+        @param expires When the entry stops being returned
+    */
+    void
+    put(Key const& key, Value value, time_point expires)
+    {
+        auto it = index_.find(key);
+        if(it != index_.end())
+        {
+            it->second->value = std::move(value);
+            it->second->expires = expires;
+            touch(it->second);
+            return;
+        }
+        if(capacity_ != 0 && index_.size() >= capacity_)
+        {
+            index_.erase(lru_.back().key);
+            lru_.pop_back();
+        }
+        lru_.push_front(entry{key, std::move(value), expires});
+        index_.emplace(key, lru_.begin());
+    }
+
+    /** Return the value for a key.
+
+        An expired entry is removed.
+
+        @return A pointer to the value, or `nullptr` if there
+            is no unexpired entry
+    */
+    Value const*
+    find(Key const& key, time_point now)
+    {
+        auto it = index_.find(key);
+        if(it == index_.end())
+            return nullptr;
+        if(it->second->expires <= now)
+        {
+            lru_.erase(it->second);
+            index_.erase(it);
+            return nullptr;
+        }
+        touch(it->second);
+        return &it->second->value;
+    }
+
+    /** Remove an entry.
+
+        @return true if there was one
+    */
+    bool
+    erase(Key const& key)
+    {
+        auto it = index_.find(key);
+        if(it == index_.end())
+            return false;
+        lru_.erase(it->second);
+        index_.erase(it);
+        return true;
+    }
+
+    /** Call a function for each unexpired entry.
+
+        Entries are visited from least to most recently used,
+        so putting them into an empty cache in that order
+        keeps their order.
+
+        @param now The current time
+        @param f Called as `f(key, value, expires)`
+    */
+    template<class F>
+    void
+    for_each(time_point now, F&& f) const
+    {
+        for(auto it = lru_.rbegin(); it != lru_.rend(); ++it)
+            if(it->expires > now)
+                f(it->key, it->value, it->expires);
+    }
+
+    /** Remove every expired entry.
+    */
+    void
+    prune(time_point now)
+    {
+        for(auto it = lru_.begin(); it != lru_.end();)
+        {
+            if(it->expires <= now)
+            {
+                index_.erase(it->key);
+                it = lru_.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    /// Remove every entry
+    void
+    clear() noexcept
+    {
+        index_.clear();
+        lru_.clear();
+    }
+
+private:
+    struct entry
+    {
+        Key key;
+        Value value;
+        time_point expires;
+    };
+
+    using list_type = std::list<entry>;
+
+    // Move an entry to the front, as most recently used
+    void
+    touch(typename list_type::iterator e) noexcept
+    {
+        lru_.splice(lru_.begin(), lru_, e);
+    }
+
+    std::size_t capacity_;
+    list_type lru_;
+    std::map<Key, typename list_type::iterator> index_;
+};
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
@@ -0,0 +1,149 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_WAIT_QUEUE_HPP
+#define BOOST_BURL_SRC_DETAIL_WAIT_QUEUE_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <set>
+#include <vector>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/** Waiters sleeping until a point in time.
+
+    Holds suspended operations ordered by wake time so that
+    a single timer, armed for @ref earliest, can serve every
+    waiter. Waiters with equal wake times are released in
+    the order they were added.
+
+    @tparam Waiter The type used to resume a waiter
+*/
+template<class Waiter>
+class wait_queue
+{
+public:
+    using clock_type = std::chrono::steady_clock;
+    using time_point = clock_type::time_point;
+
+    /** Add a waiter.
+
+        @return true if the waiter is now the earliest, in
+            which case the shared timer must be re-armed
+    */
+    bool
+    push(time_point when, Waiter w)
+    {
+        bool const first = q_.empty() || when < q_.begin()->when;
+        q_.insert(entry{when, seq_++, std::move(w)});
+        return first;
+    }
+
+    /** Remove a waiter before its wake time.
+
+        The shared timer may stay armed for the removed
+        waiter's time; it then finds nothing due and is armed
+        again for @ref earliest.
+
+        @return true if the waiter was queued; it is then not
+            returned by any later call
+    */
+    bool
+    cancel(Waiter const& w)
+    {
+        for(auto it = q_.begin(); it != q_.end(); ++it)
+        {
+            if(!(it->w == w))
+                continue;
+            q_.erase(it);
+            return true;
+        }
+        return false;
+    }
+
+    /** Return the earliest wake time, if any.
+    */
+    std::optional<time_point>
+    earliest() const
+    {
+        if(q_.empty())
+            return std::nullopt;
+        return q_.begin()->when;
+    }
+
+    /** Move every waiter due at `now` into `out`.
+    */
+    void
+    pop_due(time_point now, std::vector<Waiter>& out)
+    {
+        while(!q_.empty() && q_.begin()->when <= now)
+            out.push_back(take(q_.begin()));
+    }
+
+    /** Move every waiter into `out`, regardless of wake time.
+    */
+    void
+    pop_all(std::vector<Waiter>& out)
+    {
+        while(!q_.empty())
+            out.push_back(take(q_.begin()));
+    }
+
+    bool
+    empty() const noexcept
+    {
+        return q_.empty();
+    }
+
+    std::size_t
+    size() const noexcept
+    {
+        return q_.size();
+    }
+
+private:
+    struct entry
+    {
+        time_point when;
+        std::uint64_t seq;
+        Waiter w;
+
+        friend
+        bool
+        operator<(entry const& a, entry const& b) noexcept
+        {
+            if(a.when != b.when)
+                return a.when < b.when;
+            return a.seq < b.seq;
+        }
+    };
+
+    // Remove an entry, returning its waiter
+    Waiter
+    take(typename std::set<entry>::iterator it)
+    {
+        auto node = q_.extract(it);
+        return std::move(node.value().w);
+    }
+
+    // Ordered by wake time, then by arrival; a set rather
+    // than a heap so that cancel can remove from the middle
+    std::set<entry> q_;
+    std::uint64_t seq_ = 0;
+};
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
@@ -0,0 +1,415 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_WARM_STATE_HPP
+#define BOOST_BURL_SRC_DETAIL_WARM_STATE_HPP
+
+#include <boost/burl/cookies.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/** What a session has learned, saved across restarts.
+
+    Times are wall clock times, since steady clock values
+    mean nothing to another process.
+*/
+struct warm_state
+{
+    using clock_type = std::chrono::system_clock;
+    using time_point = clock_type::time_point;
+
+    // Resolved addresses of a host
+    struct dns_entry
+    {
+        std::string host;
+        std::vector<std::string> addresses;
+        time_point expires;
+    };
+
+    // A TLS session for resumption, in DER form
+    struct tls_entry
+    {
+        std::string host;
+        std::uint16_t port = 0;
+
+        // The connection settings it was negotiated under
+        std::string settings;
+
+        time_point expires;
+        std::string session;
+    };
+
+    // Capability flags learned for an origin
+    struct origin_entry
+    {
+        std::string host;
+        std::uint16_t port = 0;
+        bool https = false;
+        std::uint32_t flags = 0;
+    };
+
+    std::vector<dns_entry> dns;
+    std::vector<tls_entry> tls_sessions;
+    std::vector<cookie> cookies;
+    std::vector<origin_entry> origins;
+};
+
+//----------------------------------------------------------
+
+/*  Format
+
+    The file starts with an 8 byte magic, the last byte of
+    which is the version. Sections follow, each a tag byte and
+    a byte length, so that a reader can skip sections it does
+    not know. Integers are LEB128, strings a length and bytes,
+    and times seconds since the Unix epoch.
+*/
+namespace warm_format {
+
+constexpr std::string_view magic("BURLWS\0\x02", 8);
+
+enum tag : unsigned char
+{
+    tag_dns = 1,
+    tag_tls = 2,
+    tag_cookies = 3,
+    tag_origins = 4
+};
+
+// Cookie flag bits
+constexpr unsigned cookie_expires = 1;
+constexpr unsigned cookie_secure = 2;
+constexpr unsigned cookie_http_only = 4;
+constexpr unsigned cookie_same_site_shift = 3;
+
+inline
+void
+put_uint(std::string& out, std::uint64_t v)
+{
+    while(v >= 0x80)
+    {
+        out.push_back(static_cast<char>((v & 0x7f) | 0x80));
+        v >>= 7;
+    }
+    out.push_back(static_cast<char>(v));
+}
+
+inline
+void
+put_string(std::string& out, std::string_view s)
+{
+    put_uint(out, s.size());
+    out.append(s);
+}
+
+inline
+void
+put_time(std::string& out, warm_state::time_point t)
+{
+    auto const s = std::chrono::duration_cast<
+        std::chrono::seconds>(t.time_since_epoch()).count();
+    put_uint(out, s > 0 ? static_cast<std::uint64_t>(s) : 0);
+}
+
+// Reads from a buffer; any overrun sets `failed`
+class reader
+{
+public:
+    explicit
+    reader(std::string_view s) noexcept
+        : s_(s)
+    {
+    }
+
+    bool
+    failed() const noexcept
+    {
+        return failed_;
+    }
+
+    bool
+    done() const noexcept
+    {
+        return s_.empty();
+    }
+
+    std::uint64_t
+    get_uint() noexcept
+    {
+        std::uint64_t v = 0;
+        for(unsigned shift = 0; shift < 64; shift += 7)
+        {
+            if(s_.empty())
+                break;
+            auto const b = static_cast<unsigned char>(s_.front());
+            s_.remove_prefix(1);
+            v |= std::uint64_t(b & 0x7f) << shift;
+            if((b & 0x80) == 0)
+                return v;
+        }
+        failed_ = true;
+        return 0;
+    }
+
+    std::string_view
+    get_bytes(std::uint64_t n) noexcept
+    {
+        if(n > s_.size())
+        {
+            failed_ = true;
+            s_ = {};
+            return {};
+        }
+        auto const r = s_.substr(0, static_cast<std::size_t>(n));
+        s_.remove_prefix(static_cast<std::size_t>(n));
+        return r;
+    }
+
+    std::string
+    get_string()
+    {
+        return std::string(get_bytes(get_uint()));
+    }
+
+    // Times the clock cannot hold, which only a damaged or
+    // crafted file has, set `failed`
+    warm_state::time_point
+    get_time() noexcept
+    {
+        using duration = warm_state::clock_type::duration;
+        auto const max = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::seconds>(
+                (duration::max)()).count());
+        auto const v = get_uint();
+        if(v > max)
+        {
+            failed_ = true;
+            return {};
+        }
+        return warm_state::time_point(std::chrono::duration_cast<
+            duration>(std::chrono::seconds(
+                static_cast<std::int64_t>(v))));
+    }
+
+    // Count of entries to follow, bounded by the bytes left
+    // so a corrupt count cannot exhaust memory
+    std::size_t
+    get_count() noexcept
+    {
+        auto const n = get_uint();
+        if(n > s_.size())
+        {
+            failed_ = true;
+            return 0;
+        }
+        return static_cast<std::size_t>(n);
+    }
+
+private:
+    std::string_view s_;
+    bool failed_ = false;
+};
+
+} // namespace warm_format
+
+//----------------------------------------------------------
+
+/** Serialize warm state.
+*/
+inline
+std::string
+encode_warm_state(warm_state const& ws)
+{
+    namespace f = warm_format;
+    std::string out(f::magic);
+    std::string body;
+
+    auto section = [&](f::tag t)
+    {
+        out.push_back(static_cast<char>(t));
+        f::put_uint(out, body.size());
+        out.append(body);
+        body.clear();
+    };
+
+    f::put_uint(body, ws.dns.size());
+    for(auto const& e : ws.dns)
+    {
+        f::put_string(body, e.host);
+        f::put_time(body, e.expires);
+        f::put_uint(body, e.addresses.size());
+        for(auto const& a : e.addresses)
+            f::put_string(body, a);
+    }
+    section(f::tag_dns);
+
+    f::put_uint(body, ws.tls_sessions.size());
+    for(auto const& e : ws.tls_sessions)
+    {
+        f::put_string(body, e.host);
+        f::put_uint(body, e.port);
+        f::put_string(body, e.settings);
+        f::put_time(body, e.expires);
+        f::put_string(body, e.session);
+    }
+    section(f::tag_tls);
+
+    f::put_uint(body, ws.cookies.size());
+    for(auto const& c : ws.cookies)
+    {
+        unsigned flags =
+            static_cast<unsigned>(c.same_site) <<
+                f::cookie_same_site_shift;
+        if(c.expires)
+            flags |= f::cookie_expires;
+        if(c.secure)
+            flags |= f::cookie_secure;
+        if(c.http_only)
+            flags |= f::cookie_http_only;
+        f::put_string(body, c.name);
+        f::put_string(body, c.value);
+        f::put_string(body, c.domain);
+        f::put_string(body, c.path);
+        f::put_uint(body, flags);
+        if(c.expires)
+            f::put_time(body, *c.expires);
+    }
+    section(f::tag_cookies);
+
+    f::put_uint(body, ws.origins.size());
+    for(auto const& e : ws.origins)
+    {
+        f::put_string(body, e.host);
+        f::put_uint(body, e.port);
+        f::put_uint(body, e.https ? 1 : 0);
+        f::put_uint(body, e.flags);
+    }
+    section(f::tag_origins);
+
+    return out;
+}
+
+/** Parse warm state.
+
+    Sections with unknown tags are skipped. On error, `ws`
+    is left unspecified.
+
+    @return `std::errc::bad_message` if the data is not warm
+        state of this version or is damaged
+*/
+inline
+std::error_code
+decode_warm_state(std::string_view s, warm_state& ws)
+{
+    namespace f = warm_format;
+    auto const bad = std::make_error_code(std::errc::bad_message);
+    if(s.substr(0, f::magic.size()) != f::magic)
+        return bad;
+    f::reader in(s.substr(f::magic.size()));
+    ws = {};
+    while(!in.done())
+    {
+        auto const t = in.get_uint();
+        f::reader r(in.get_bytes(in.get_uint()));
+        if(in.failed())
+            return bad;
+        switch(t)
+        {
+        case f::tag_dns:
+        {
+            auto n = r.get_count();
+            while(n-- && !r.failed())
+            {
+                warm_state::dns_entry e;
+                e.host = r.get_string();
+                e.expires = r.get_time();
+                auto m = r.get_count();
+                while(m-- && !r.failed())
+                    e.addresses.push_back(r.get_string());
+                ws.dns.push_back(std::move(e));
+            }
+            break;
+        }
+        case f::tag_tls:
+        {
+            auto n = r.get_count();
+            while(n-- && !r.failed())
+            {
+                warm_state::tls_entry e;
+                e.host = r.get_string();
+                e.port = static_cast<std::uint16_t>(r.get_uint());
+                e.settings = r.get_string();
+                e.expires = r.get_time();
+                e.session = r.get_string();
+                ws.tls_sessions.push_back(std::move(e));
+            }
+            break;
+        }
+        case f::tag_cookies:
+        {
+            auto n = r.get_count();
+            while(n-- && !r.failed())
+            {
+                cookie c;
+                c.name = r.get_string();
+                c.value = r.get_string();
+                c.domain = r.get_string();
+                c.path = r.get_string();
+                auto const flags = r.get_uint();
+                if(flags & f::cookie_expires)
+                    c.expires = r.get_time();
+                c.secure = (flags & f::cookie_secure) != 0;
+                c.http_only = (flags & f::cookie_http_only) != 0;
+                auto const ss = (flags >> f::cookie_same_site_shift) & 3;
+                if(ss > 2)
+                    return bad;
+                c.same_site = static_cast<cookie::same_site_t>(ss);
+                ws.cookies.push_back(std::move(c));
+            }
+            break;
+        }
+        case f::tag_origins:
+        {
+            auto n = r.get_count();
+            while(n-- && !r.failed())
+            {
+                warm_state::origin_entry e;
+                e.host = r.get_string();
+                e.port = static_cast<std::uint16_t>(r.get_uint());
+                e.https = r.get_uint() != 0;
+                e.flags = static_cast<std::uint32_t>(r.get_uint());
+                ws.origins.push_back(std::move(e));
+            }
+            break;
+        }
+        default:
+            // Written by a later version
+            continue;
+        }
+        if(r.failed() || !r.done())
+            return bad;
+    }
+    return {};
+}
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
@@ -0,0 +1,185 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_WEBSOCKET_DEFLATE_HPP
+#define BOOST_BURL_SRC_DETAIL_WEBSOCKET_DEFLATE_HPP
+
+#ifdef BOOST_BURL_HAS_ZLIB
+
+#include "src/detail/websocket_handshake.hpp"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/** Message compression for permessage-deflate (RFC 7692).
+
+    Each message is raw deflate data ending in a sync flush,
+    with the final empty stored block's 00 00 FF FF left off.
+    Unless a side asked for no context takeover, its window
+    carries over from one message to the next, which is what
+    makes small similar messages compress well.
+*/
+class permessage_deflate
+{
+public:
+    /** Constructor.
+
+        Check @ref valid before use; zlib may fail to start,
+        for instance when memory is short.
+    */
+    explicit
+    permessage_deflate(deflate_params const& p)
+        : params_(p)
+    {
+        def_ok_ = deflateInit2(&def_, Z_DEFAULT_COMPRESSION,
+            Z_DEFLATED, -p.client_max_window_bits, 8,
+            Z_DEFAULT_STRATEGY) == Z_OK;
+
+        // A larger window than the server's is always safe
+        inf_ok_ = inflateInit2(&inf_, -15) == Z_OK;
+    }
+
+    permessage_deflate(permessage_deflate const&) = delete;
+    permessage_deflate& operator=(permessage_deflate const&) = delete;
+
+    ~permessage_deflate()
+    {
+        if(def_ok_)
+            deflateEnd(&def_);
+        if(inf_ok_)
+            inflateEnd(&inf_);
+    }
+
+    /// Return true if both directions started
+    bool
+    valid() const noexcept
+    {
+        return def_ok_ && inf_ok_;
+    }
+
+    /** Compress a message, appending to `out`.
+
+        @return false on a zlib error
+    */
+    bool
+    compress(std::string_view in, std::string& out)
+    {
+        if(!def_ok_)
+            return false;
+        auto const start = out.size();
+        def_.next_in = reinterpret_cast<Bytef*>(
+            const_cast<char*>(in.data()));
+        def_.avail_in = static_cast<uInt>(in.size());
+        for(;;)
+        {
+            auto const pos = out.size();
+            out.resize(pos + (std::max<std::size_t>)(
+                deflateBound(&def_, def_.avail_in) + 16, 256));
+            def_.next_out = reinterpret_cast<Bytef*>(&out[pos]);
+            def_.avail_out = static_cast<uInt>(out.size() - pos);
+            int const rc = deflate(&def_, Z_SYNC_FLUSH);
+            out.resize(out.size() - def_.avail_out);
+            if(rc != Z_OK && rc != Z_BUF_ERROR)
+                return false;
+            if(def_.avail_in == 0 && def_.avail_out != 0)
+                break;
+        }
+        if( out.size() - start >= 4 &&
+            std::string_view(out).substr(out.size() - 4) ==
+                std::string_view("\x00\x00\xff\xff", 4))
+            out.resize(out.size() - 4);
+        if(params_.client_no_context_takeover)
+            deflateReset(&def_);
+        return true;
+    }
+
+    /** Decompress a message, appending to `out`.
+
+        @param max_size The most bytes `out` may hold after
+            appending
+
+        @return false if the data is damaged or too large
+    */
+    bool
+    decompress(
+        std::string_view in,
+        std::string& out,
+        std::size_t max_size)
+    {
+        static constexpr unsigned char tail[4] = {0, 0, 0xff, 0xff};
+        if(!inf_ok_)
+            return false;
+        bool ok = feed(in, out, max_size) &&
+            feed(std::string_view(
+                reinterpret_cast<char const*>(tail), 4), out, max_size);
+        if(!ok || params_.server_no_context_takeover)
+            inflateReset(&inf_);
+        return ok;
+    }
+
+private:
+    bool
+    feed(std::string_view in, std::string& out, std::size_t max_size)
+    {
+        inf_.next_in = reinterpret_cast<Bytef*>(
+            const_cast<char*>(in.data()));
+        inf_.avail_in = static_cast<uInt>(in.size());
+
+        // Output may be pending even with no input left, for
+        // as long as inflate fills the buffer it is given
+        bool full = false;
+        while(inf_.avail_in > 0 || full)
+        {
+            // One byte past the limit shows the message is too big
+            if(out.size() > max_size)
+                return false;
+            auto const pos = out.size();
+            out.resize((std::min)(max_size + 1,
+                pos + (std::max<std::size_t>)(in.size() * 4, 4096)));
+            inf_.next_out = reinterpret_cast<Bytef*>(&out[pos]);
+            inf_.avail_out = static_cast<uInt>(out.size() - pos);
+            int const rc = inflate(&inf_, Z_SYNC_FLUSH);
+            full = inf_.avail_out == 0;
+            out.resize(out.size() - inf_.avail_out);
+            if(rc == Z_STREAM_END)
+            {
+                // A final block; the next message starts afresh
+                inflateReset(&inf_);
+                continue;
+            }
+            if(rc == Z_BUF_ERROR && inf_.avail_in == 0)
+                break;
+            if(rc != Z_OK)
+                return false;
+        }
+        return out.size() <= max_size;
+    }
+
+    deflate_params params_;
+    z_stream def_{};
+    z_stream inf_{};
+    bool def_ok_ = false;
+    bool inf_ok_ = false;
+};
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
+
+#endif
@@ -0,0 +1,557 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_WEBSOCKET_FRAME_HPP
+#define BOOST_BURL_SRC_DETAIL_WEBSOCKET_FRAME_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/// WebSocket frame opcodes (RFC 6455 section 5.2)
+enum class ws_opcode : std::uint8_t
+{
+    continuation = 0x0,
+    text = 0x1,
+    binary = 0x2,
+    close = 0x8,
+    ping = 0x9,
+    pong = 0xa
+};
+
+/// Return true for close, ping and pong
+inline
+bool
+is_control(ws_opcode op) noexcept
+{
+    return (static_cast<std::uint8_t>(op) & 0x8) != 0;
+}
+
+/// The fields of a frame header
+struct frame_header
+{
+    ws_opcode op = ws_opcode::text;
+    bool fin = true;
+
+    // Set on the first frame of a compressed message
+    bool rsv1 = false;
+
+    bool masked = false;
+    std::uint64_t length = 0;
+    std::array<unsigned char, 4> key{};
+};
+
+/// The largest encoded frame header
+constexpr std::size_t max_frame_header = 14;
+
+/// The largest control frame payload
+constexpr std::size_t max_control_payload = 125;
+
+/** Encode a frame header.
+
+    @param out At least @ref max_frame_header bytes
+
+    @return The number of bytes written
+*/
+inline
+std::size_t
+write_frame_header(
+    frame_header const& h,
+    unsigned char* out) noexcept
+{
+    std::size_t n = 0;
+    out[n++] = static_cast<unsigned char>(
+        (h.fin ? 0x80 : 0) |
+        (h.rsv1 ? 0x40 : 0) |
+        static_cast<std::uint8_t>(h.op));
+    unsigned char const mask = h.masked ? 0x80 : 0;
+    if(h.length < 126)
+    {
+        out[n++] = static_cast<unsigned char>(mask | h.length);
+    }
+    else if(h.length <= 0xffff)
+    {
+        out[n++] = mask | 126;
+        out[n++] = static_cast<unsigned char>(h.length >> 8);
+        out[n++] = static_cast<unsigned char>(h.length);
+    }
+    else
+    {
+        out[n++] = mask | 127;
+        for(int shift = 56; shift >= 0; shift -= 8)
+            out[n++] = static_cast<unsigned char>(h.length >> shift);
+    }
+    if(h.masked)
+    {
+        std::memcpy(out + n, h.key.data(), 4);
+        n += 4;
+    }
+    return n;
+}
+
+enum class header_status
+{
+    /// The header was parsed
+    ok,
+
+    /// More bytes are needed
+    need_more,
+
+    /// The header breaks RFC 6455
+    bad
+};
+
+/** Decode a frame header.
+
+    Checks what can be checked from the header alone:
+    reserved bits and opcodes, control frame rules and
+    minimal length encoding. @ref frame_sequence checks the
+    header against the frames before it.
+
+    @param used Set to the header size on success
+*/
+inline
+header_status
+parse_frame_header(
+    unsigned char const* p,
+    std::size_t n,
+    frame_header& h,
+    std::size_t& used) noexcept
+{
+    if(n < 2)
+        return header_status::need_more;
+    if((p[0] & 0x30) != 0)
+        return header_status::bad;
+    auto const op = p[0] & 0x0f;
+    switch(op)
+    {
+    case 0x0: case 0x1: case 0x2:
+    case 0x8: case 0x9: case 0xa:
+        break;
+    default:
+        return header_status::bad;
+    }
+    h.op = static_cast<ws_opcode>(op);
+    h.fin = (p[0] & 0x80) != 0;
+    h.rsv1 = (p[0] & 0x40) != 0;
+    h.masked = (p[1] & 0x80) != 0;
+
+    std::size_t need = 2;
+    auto const len7 = p[1] & 0x7f;
+    if(len7 == 126)
+        need += 2;
+    else if(len7 == 127)
+        need += 8;
+    if(h.masked)
+        need += 4;
+    if(n < need)
+        return header_status::need_more;
+
+    std::size_t i = 2;
+    if(len7 == 126)
+    {
+        h.length = (std::uint64_t(p[2]) << 8) | p[3];
+        i = 4;
+        if(h.length < 126)
+            return header_status::bad;
+    }
+    else if(len7 == 127)
+    {
+        h.length = 0;
+        for(; i < 10; ++i)
+            h.length = (h.length << 8) | p[i];
+        if(h.length <= 0xffff || (h.length >> 63) != 0)
+            return header_status::bad;
+    }
+    else
+    {
+        h.length = len7;
+    }
+    if(h.masked)
+    {
+        std::memcpy(h.key.data(), p + i, 4);
+        i += 4;
+    }
+
+    if(is_control(h.op) &&
+        (!h.fin || h.rsv1 || h.length > max_control_payload))
+        return header_status::bad;
+    used = i;
+    return header_status::ok;
+}
+
+//----------------------------------------------------------
+
+/** Apply a masking key to payload bytes.
+
+    XOR is its own inverse, so this both masks and unmasks.
+    The payload is processed eight bytes at a time with the
+    key repeated into a 64-bit word; loads and stores go
+    through memcpy, so alignment and byte order do not
+    matter.
+
+    @param offset The position of `p` within the payload,
+        for payloads masked in several pieces
+*/
+inline
+void
+mask_bytes(
+    unsigned char* p,
+    std::size_t n,
+    std::array<unsigned char, 4> const& key,
+    std::size_t offset = 0) noexcept
+{
+    unsigned char k[8];
+    for(std::size_t i = 0; i < 8; ++i)
+        k[i] = key[(offset + i) & 3];
+    std::uint64_t w;
+    std::memcpy(&w, k, 8);
+
+    std::size_t i = 0;
+    for(; i + 8 <= n; i += 8)
+    {
+        std::uint64_t v;
+        std::memcpy(&v, p + i, 8);
+        v ^= w;
+        std::memcpy(p + i, &v, 8);
+    }
+    for(; i < n; ++i)
+        p[i] ^= k[i & 7];
+}
+
+//----------------------------------------------------------
+
+/** Checks each frame header against the frames before it.
+
+    Tracks the message being received so that continuation
+    frames, interleaved control frames and the compression
+    bit are checked as RFC 6455 and RFC 7692 require.
+*/
+class frame_sequence
+{
+public:
+    /** Constructor.
+
+        @param deflate true if permessage-deflate was negotiated
+    */
+    explicit
+    frame_sequence(bool deflate = false) noexcept
+        : deflate_(deflate)
+    {
+    }
+
+    /** Called for each frame received from the server.
+
+        @return false if the frame is a protocol error
+    */
+    bool
+    on_header(frame_header const& h) noexcept
+    {
+        // Servers must not mask
+        if(h.masked)
+            return false;
+        if(is_control(h.op))
+            return true;
+        if(h.op == ws_opcode::continuation)
+        {
+            if(!in_message_ || h.rsv1)
+                return false;
+        }
+        else
+        {
+            if(in_message_)
+                return false;
+            if(h.rsv1 && !deflate_)
+                return false;
+            in_message_ = true;
+            op_ = h.op;
+            compressed_ = h.rsv1;
+        }
+        if(h.fin)
+            in_message_ = false;
+        return true;
+    }
+
+    /// Return the opcode of the current or last message
+    ws_opcode
+    message_op() const noexcept
+    {
+        return op_;
+    }
+
+    /// Return true if the current or last message is compressed
+    bool
+    compressed() const noexcept
+    {
+        return compressed_;
+    }
+
+private:
+    bool deflate_;
+    bool in_message_ = false;
+    bool compressed_ = false;
+    ws_opcode op_ = ws_opcode::text;
+};
+
+/** Splits an outgoing message into frames.
+
+    The first frame carries the message's opcode and, when
+    compressed, the RSV1 bit; the rest are continuation
+    frames. The last one has FIN set.
+*/
+class fragmenter
+{
+public:
+    /** Constructor.
+
+        @param op text or binary
+        @param compressed true if the payload is compressed
+        @param size The payload size
+        @param max_frame Largest frame payload (0 = one frame)
+    */
+    fragmenter(
+        ws_opcode op,
+        bool compressed,
+        std::uint64_t size,
+        std::uint64_t max_frame) noexcept
+        : op_(op)
+        , compressed_(compressed)
+        , remaining_(size)
+        , max_(max_frame == 0 ? size : max_frame)
+    {
+    }
+
+    /// Return true once every frame was produced
+    bool
+    done() const noexcept
+    {
+        return done_;
+    }
+
+    /** Return the header of the next frame.
+
+        @param key The frame's masking key
+    */
+    frame_header
+    next(std::array<unsigned char, 4> const& key) noexcept
+    {
+        frame_header h;
+        h.op = first_ ? op_ : ws_opcode::continuation;
+        h.rsv1 = first_ && compressed_;
+        h.masked = true;
+        h.key = key;
+        h.length = (std::min)(remaining_, max_);
+        remaining_ -= h.length;
+        h.fin = remaining_ == 0;
+        first_ = false;
+        done_ = h.fin;
+        return h;
+    }
+
+private:
+    ws_opcode op_;
+    bool compressed_;
+    std::uint64_t remaining_;
+    std::uint64_t max_;
+    bool first_ = true;
+    bool done_ = false;
+};
+
+//----------------------------------------------------------
+
+/** Incremental UTF-8 validation for text messages.
+
+    Rejects overlong forms, surrogates and code points past
+    U+10FFFF, as RFC 6455 section 8.1 requires. Runs of ASCII
+    are skipped eight bytes at a time.
+*/
+class utf8_validator
+{
+public:
+    /** Validate more bytes of the message.
+
+        @return false if the bytes cannot be UTF-8
+    */
+    bool
+    write(unsigned char const* p, std::size_t n) noexcept
+    {
+        std::size_t i = 0;
+        while(i < n)
+        {
+            if(need_ == 0)
+            {
+                // Skip ASCII a word at a time
+                while(i + 8 <= n)
+                {
+                    std::uint64_t v;
+                    std::memcpy(&v, p + i, 8);
+                    if((v & 0x8080808080808080ULL) != 0)
+                        break;
+                    i += 8;
+                }
+                if(i == n)
+                    break;
+                auto const c = p[i++];
+                if(c < 0x80)
+                    continue;
+                if(!lead(c))
+                    return false;
+            }
+            else
+            {
+                auto const c = p[i++];
+                if(c < lo_ || c > hi_)
+                    return false;
+                lo_ = 0x80;
+                hi_ = 0xbf;
+                --need_;
+            }
+        }
+        return true;
+    }
+
+    /// Return true if the message ended on a whole code point
+    bool
+    finish() const noexcept
+    {
+        return need_ == 0;
+    }
+
+    /// Start a new message
+    void
+    reset() noexcept
+    {
+        need_ = 0;
+        lo_ = 0x80;
+        hi_ = 0xbf;
+    }
+
+private:
+    // Set up the continuation bytes a lead byte needs; the
+    // bounds on the first of them exclude overlong forms,
+    // surrogates and values past U+10FFFF
+    bool
+    lead(unsigned char c) noexcept
+    {
+        lo_ = 0x80;
+        hi_ = 0xbf;
+        if(c >= 0xc2 && c <= 0xdf)
+            need_ = 1;
+        else if(c == 0xe0)
+            need_ = 2, lo_ = 0xa0;
+        else if(c == 0xed)
+            need_ = 2, hi_ = 0x9f;
+        else if(c >= 0xe1 && c <= 0xef)
+            need_ = 2;
+        else if(c == 0xf0)
+            need_ = 3, lo_ = 0x90;
+        else if(c == 0xf4)
+            need_ = 3, hi_ = 0x8f;
+        else if(c >= 0xf1 && c <= 0xf3)
+            need_ = 3;
+        else
+            return false;
+        return true;
+    }
+
+    unsigned need_ = 0;
+    unsigned char lo_ = 0x80;
+    unsigned char hi_ = 0xbf;
+};
+
+//----------------------------------------------------------
+
+/// Close codes (RFC 6455 section 7.4)
+constexpr std::uint16_t close_normal = 1000;
+constexpr std::uint16_t close_protocol_error = 1002;
+constexpr std::uint16_t close_no_status = 1005;
+constexpr std::uint16_t close_invalid_payload = 1007;
+constexpr std::uint16_t close_too_big = 1009;
+
+/** Return true if a close code may appear in a close frame.
+
+    1005, 1006 and 1015 are only reported locally and never
+    sent.
+*/
+inline
+bool
+valid_close_code(std::uint16_t code) noexcept
+{
+    if(code >= 1000 && code <= 1003)
+        return true;
+    if(code >= 1007 && code <= 1014)
+        return true;
+    return code >= 3000 && code <= 4999;
+}
+
+/** Parse the payload of a close frame.
+
+    An empty payload gives @ref close_no_status.
+
+    @return false if the payload is malformed
+*/
+inline
+bool
+parse_close_payload(
+    unsigned char const* p,
+    std::size_t n,
+    std::uint16_t& code,
+    std::string& reason)
+{
+    reason.clear();
+    if(n == 0)
+    {
+        code = close_no_status;
+        return true;
+    }
+    if(n == 1)
+        return false;
+    code = static_cast<std::uint16_t>((p[0] << 8) | p[1]);
+    if(!valid_close_code(code))
+        return false;
+    utf8_validator v;
+    if(!v.write(p + 2, n - 2) || !v.finish())
+        return false;
+    reason.assign(reinterpret_cast<char const*>(p + 2), n - 2);
+    return true;
+}
+
+/** Build the payload of a close frame.
+
+    The reason is cut at a code point boundary so the
+    payload fits a control frame.
+*/
+inline
+std::string
+make_close_payload(std::uint16_t code, std::string_view reason)
+{
+    std::string out;
+    out.push_back(static_cast<char>(code >> 8));
+    out.push_back(static_cast<char>(code & 0xff));
+    auto n = (std::min)(reason.size(), max_control_payload - 2);
+    if(n < reason.size())
+        while(n > 0 && (static_cast<unsigned char>(reason[n]) & 0xc0) == 0x80)
+            --n;
+    out.append(reason.substr(0, n));
+    return out;
+}
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
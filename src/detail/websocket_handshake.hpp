@@ -0,0 +1,179 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_WEBSOCKET_HANDSHAKE_HPP
+#define BOOST_BURL_SRC_DETAIL_WEBSOCKET_HANDSHAKE_HPP
+
+#include "src/detail/base64.hpp"
+
+#include <openssl/evp.h>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace boost {
+namespace burl {
+namespace detail {
+
+/** Return the Sec-WebSocket-Accept value expected for a key.
+
+    This is the base64 of the SHA-1 of the key followed by a
+    fixed GUID (RFC 6455 section 4.2.2).
+*/
+inline
+std::string
+websocket_accept(std::string_view key)
+{
+    std::string s(key);
+    s.append("258EAFA5-E914-47DA-95CA-C5AB0DC85B11");
+    unsigned char md[EVP_MAX_MD_SIZE];
+    unsigned int len = 0;
+    EVP_Digest(s.data(), s.size(), md, &len, EVP_sha1(), nullptr);
+    return base64_encode(md, len);
+}
+
+//----------------------------------------------------------
+
+/** Parameters of a negotiated permessage-deflate (RFC 7692).
+*/
+struct deflate_params
+{
+    // The server resets its compressor after each message
+    bool server_no_context_takeover = false;
+
+    // The client resets its compressor after each message
+    bool client_no_context_takeover = false;
+
+    // LZ77 window of each side, in bits
+    int server_max_window_bits = 15;
+    int client_max_window_bits = 15;
+};
+
+/** The Sec-WebSocket-Extensions value offered by the client.
+
+    Offering client_max_window_bits without a value lets the
+    server limit the client's window.
+*/
+constexpr std::string_view deflate_offer =
+    "permessage-deflate; client_max_window_bits";
+
+/** Parse the server's Sec-WebSocket-Extensions value.
+
+    Only permessage-deflate was offered, so any other
+    extension, an unknown or repeated parameter, or a window
+    outside 8 to 15 bits fails the handshake. A client window
+    of 8 bits is refused too, since zlib's raw deflate cannot
+    produce one.
+
+    @param enabled Set to true if the server accepted
+        permessage-deflate
+
+    @return false if the value is not an acceptable response
+*/
+inline
+bool
+parse_deflate_response(
+    std::string_view value,
+    bool& enabled,
+    deflate_params& p)
+{
+    auto trim = [](std::string_view s)
+    {
+        while(!s.empty() && (s.front() == ' ' || s.front() == '\t'))
+            s.remove_prefix(1);
+        while(!s.empty() && (s.back() == ' ' || s.back() == '\t'))
+            s.remove_suffix(1);
+        return s;
+    };
+    auto next = [](std::string_view& s, char sep)
+    {
+        auto const i = s.find(sep);
+        auto const r = s.substr(0, i);
+        s = i == std::string_view::npos ?
+            std::string_view() : s.substr(i + 1);
+        return r;
+    };
+    auto bits = [](std::string_view v, int& out)
+    {
+        if(v.size() >= 2 && v.front() == '"' && v.back() == '"')
+            v = v.substr(1, v.size() - 2);
+        if(v.empty() || v.size() > 2)
+            return false;
+        int n = 0;
+        for(char c : v)
+        {
+            if(c < '0' || c > '9')
+                return false;
+            n = n * 10 + (c - '0');
+        }
+        if(n < 8 || n > 15)
+            return false;
+        out = n;
+        return true;
+    };
+
+    enabled = false;
+    p = {};
+    while(!value.empty())
+    {
+        auto ext = trim(next(value, ','));
+        if(ext.empty())
+            continue;
+        if(trim(next(ext, ';')) != "permessage-deflate" || enabled)
+            return false;
+        enabled = true;
+        unsigned seen = 0;
+        while(!ext.empty())
+        {
+            auto param = trim(next(ext, ';'));
+            auto const name = trim(next(param, '='));
+            auto const v = trim(param);
+            unsigned bit;
+            bool ok;
+            if(name == "server_no_context_takeover")
+            {
+                bit = 1;
+                ok = v.empty();
+                p.server_no_context_takeover = true;
+            }
+            else if(name == "client_no_context_takeover")
+            {
+                bit = 2;
+                ok = v.empty();
+                p.client_no_context_takeover = true;
+            }
+            else if(name == "server_max_window_bits")
+            {
+                bit = 4;
+                ok = bits(v, p.server_max_window_bits);
+            }
+            else if(name == "client_max_window_bits")
+            {
+                bit = 8;
+                ok = bits(v, p.client_max_window_bits) &&
+                    p.client_max_window_bits > 8;
+            }
+            else
+            {
+                return false;
+            }
+            if(!ok || (seen & bit) != 0)
+                return false;
+            seen |= bit;
+        }
+    }
+    return true;
+}
+
+} // namespace detail
+} // namespace burl
+} // namespace boost
+
+#endif
@@ -0,0 +1,113 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#ifndef BOOST_BURL_SRC_DETAIL_WEBSOCKET_IMPL_HPP
+#define BOOST_BURL_SRC_DETAIL_WEBSOCKET_IMPL_HPP
+
+#include <boost/burl/options.hpp>
+#include <boost/burl/websocket.hpp>
+
+#include "src/detail/shared_state.hpp"
+#include "src/detail/websocket_deflate.hpp"
+#include "src/detail/websocket_frame.hpp"
+#include "src/detail/websocket_handshake.hpp"
+
+#include <openssl/rand.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+namespace boost {
+namespace burl {
+
+/*  State of an upgraded connection.
+
+    session::websocket fills this in after the handshake;
+    websocket_stream owns it from then on. The connection no
+    longer belongs to any pool.
+*/
+struct websocket_stream::impl
+{
+    enum class state
+    {
+        open,
+
+        // A close frame was sent; waiting for the server's
+        closing,
+
+        closed
+    };
+
+    impl(
+        std::unique_ptr<detail::connection> c,
+        websocket_options o)
+        : conn(std::move(c))
+        , opts(std::move(o))
+    {
+    }
+
+    std::unique_ptr<detail::connection> conn;
+    websocket_options opts;
+    state st = state::open;
+
+    // Subprotocol chosen by the server
+    std::string protocol;
+
+    // Set when permessage-deflate was negotiated
+    bool compressed = false;
+#ifdef BOOST_BURL_HAS_ZLIB
+    std::optional<detail::permessage_deflate> deflate;
+#endif
+
+    // Incoming frame checks
+    detail::frame_sequence sequence;
+    detail::utf8_validator utf8;
+
+    // Bytes read but not yet parsed, and the message being
+    // reassembled
+    std::string read_buf;
+    std::string message;
+
+    // What the server's close frame said
+    std::uint16_t close_code = 0;
+    std::string close_reason;
+
+    // Random bytes for masking keys, drawn from OpenSSL's
+    // generator in batches; RFC 6455 section 10.3 requires
+    // keys a proxy cannot predict
+    std::array<unsigned char, 256> key_pool{};
+    std::size_t key_pos = key_pool.size();
+
+    // Return false, and no key, if the generator fails; the
+    // frame must not be sent with a predictable mask
+    bool
+    next_key(std::array<unsigned char, 4>& k) noexcept
+    {
+        if(key_pos + 4 > key_pool.size())
+        {
+            if(RAND_bytes(key_pool.data(),
+                    static_cast<int>(key_pool.size())) != 1)
+                return false;
+            key_pos = 0;
+        }
+        for(auto& b : k)
+            b = key_pool[key_pos++];
+        return true;
+    }
+};
+
+} // namespace burl
+} // namespace boost
+
+#endif
@@ -0,0 +1,424 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/burl/json_view.hpp>
+#include <boost/json/parse.hpp>
+
+#include "src/detail/json_index.hpp"
+
+#include <charconv>
+#include <system_error>
+
+namespace boost {
+namespace burl {
+
+struct json_view::impl
+{
+    std::string data;
+    detail::json_index index;
+    bool valid = false;
+
+    // Sentinel for a malformed value
+    static constexpr std::uint32_t bad = 0xffffffffu;
+
+    explicit
+    impl(std::string s)
+        : data(std::move(s))
+    {
+        valid = index.build(data) &&
+            index.size() > 0 &&
+            next(0) == index.size();
+    }
+
+    char
+    at(std::uint32_t i) const noexcept
+    {
+        return data[index.pos(i)];
+    }
+
+    // Return the token after the value starting at i, or bad
+    // if no value starts there
+    std::uint32_t
+    next(std::uint32_t i) const noexcept
+    {
+        if(i >= index.size())
+            return bad;
+        switch(at(i))
+        {
+        case '{':
+        case '[':
+            return index.match(i) + 1;
+        case '}':
+        case ']':
+        case ':':
+        case ',':
+            return bad;
+        default:
+            return i + 1;
+        }
+    }
+
+    // Return the text of token i up to the next token,
+    // without trailing whitespace
+    std::string_view
+    text(std::uint32_t i) const noexcept
+    {
+        std::size_t const first = index.pos(i);
+        std::size_t last = i + 1 < index.size() ?
+            index.pos(i + 1) : data.size();
+        while(last > first && (
+            data[last - 1] == ' ' || data[last - 1] == '\t' ||
+            data[last - 1] == '\n' || data[last - 1] == '\r'))
+            --last;
+        return std::string_view(data).substr(first, last - first);
+    }
+
+    // Return the bytes between a string token's quotes; the
+    // closing quote is the last byte before the next token
+    std::optional<std::string_view>
+    string_body(std::uint32_t i) const noexcept
+    {
+        auto const t = text(i);
+        if(t.size() < 2 || t.front() != '"' || t.back() != '"')
+            return std::nullopt;
+        return t.substr(1, t.size() - 2);
+    }
+};
+
+namespace {
+
+// The JSON number grammar, which from_chars is looser than
+bool
+is_json_number(std::string_view s) noexcept
+{
+    std::size_t i = 0;
+    auto digits = [&]
+    {
+        auto const start = i;
+        while(i < s.size() && s[i] >= '0' && s[i] <= '9')
+            ++i;
+        return i > start;
+    };
+    if(i < s.size() && s[i] == '-')
+        ++i;
+    if(i < s.size() && s[i] == '0')
+        ++i;
+    else if(!digits())
+        return false;
+    if(i < s.size() && s[i] == '.')
+    {
+        ++i;
+        if(!digits())
+            return false;
+    }
+    if(i < s.size() && (s[i] == 'e' || s[i] == 'E'))
+    {
+        ++i;
+        if(i < s.size() && (s[i] == '+' || s[i] == '-'))
+            ++i;
+        if(!digits())
+            return false;
+    }
+    return i == s.size();
+}
+
+template<class T>
+std::optional<T>
+parse_number(std::string_view s) noexcept
+{
+    if(!is_json_number(s))
+        return std::nullopt;
+    T v{};
+    auto const r = std::from_chars(s.data(), s.data() + s.size(), v);
+    if(r.ec != std::errc() || r.ptr != s.data() + s.size())
+        return std::nullopt;
+    return v;
+}
+
+} // namespace
+
+//----------------------------------------------------------
+
+json_view::value_kind
+json_view::element::kind() const noexcept
+{
+    if(!v_)
+        return value_kind::null;
+    switch(v_->at(tok_))
+    {
+    case '{': return value_kind::object;
+    case '[': return value_kind::array;
+    case '"': return value_kind::string;
+    case 't':
+    case 'f': return value_kind::boolean;
+    case 'n': return value_kind::null;
+    default:  return value_kind::number;
+    }
+}
+
+std::optional<json_view::element>
+json_view::element::find(std::string_view key) const
+{
+    if(kind() != value_kind::object || !v_)
+        return std::nullopt;
+    auto const& v = *v_;
+    std::uint32_t const end = v.index.match(tok_);
+    std::uint32_t i = tok_ + 1;
+    if(i == end)
+        return std::nullopt;
+    std::string unescaped;
+    for(;;)
+    {
+        // "name" : value , or }
+        if(i + 2 >= end || v.at(i) != '"' || v.at(i + 1) != ':')
+            return std::nullopt;
+        auto const name = v.string_body(i);
+        std::uint32_t const value = i + 2;
+        std::uint32_t const after = v.next(value);
+        if(!name || after == impl::bad || after > end)
+            return std::nullopt;
+
+        bool match;
+        if(name->find('\\') == std::string_view::npos)
+        {
+            match = *name == key;
+        }
+        else
+        {
+            unescaped.clear();
+            match = detail::json_unescape(*name, unescaped) &&
+                unescaped == key;
+        }
+        if(match)
+            return element(v_, value);
+        if(after == end || v.at(after) != ',')
+            return std::nullopt;
+        i = after + 1;
+    }
+}
+
+std::optional<json_view::element>
+json_view::element::at(std::size_t n) const
+{
+    if(kind() != value_kind::array || !v_)
+        return std::nullopt;
+    auto const& v = *v_;
+    std::uint32_t const end = v.index.match(tok_);
+    std::uint32_t i = tok_ + 1;
+    if(i == end)
+        return std::nullopt;
+    for(;;)
+    {
+        std::uint32_t const after = v.next(i);
+        if(after == impl::bad || after > end)
+            return std::nullopt;
+        if(n-- == 0)
+            return element(v_, i);
+        if(after == end || v.at(after) != ',')
+            return std::nullopt;
+        i = after + 1;
+    }
+}
+
+std::size_t
+json_view::element::size() const
+{
+    auto const k = kind();
+    if((k != value_kind::array && k != value_kind::object) || !v_)
+        return 0;
+    auto const& v = *v_;
+    std::uint32_t const end = v.index.match(tok_);
+    std::uint32_t i = tok_ + 1;
+    std::size_t n = 0;
+    while(i < end)
+    {
+        // Members start two tokens before their value
+        if(k == value_kind::object)
+            i += 2;
+        std::uint32_t const after = v.next(i);
+        if(after == impl::bad || after > end)
+            break;
+        ++n;
+        i = after + 1;
+    }
+    return n;
+}
+
+std::optional<std::string>
+json_view::element::get_string() const
+{
+    if(kind() != value_kind::string || !v_)
+        return std::nullopt;
+    auto const body = v_->string_body(tok_);
+    if(!body)
+        return std::nullopt;
+    std::string out;
+    if(!detail::json_unescape(*body, out))
+        return std::nullopt;
+    return out;
+}
+
+std::optional<std::int64_t>
+json_view::element::get_int64() const
+{
+    if(kind() != value_kind::number)
+        return std::nullopt;
+    return parse_number<std::int64_t>(raw());
+}
+
+std::optional<std::uint64_t>
+json_view::element::get_uint64() const
+{
+    if(kind() != value_kind::number)
+        return std::nullopt;
+    return parse_number<std::uint64_t>(raw());
+}
+
+std::optional<double>
+json_view::element::get_double() const
+{
+    if(kind() != value_kind::number)
+        return std::nullopt;
+    return parse_number<double>(raw());
+}
+
+std::optional<bool>
+json_view::element::get_bool() const
+{
+    if(kind() != value_kind::boolean)
+        return std::nullopt;
+    auto const t = raw();
+    if(t == "true")
+        return true;
+    if(t == "false")
+        return false;
+    return std::nullopt;
+}
+
+bool
+json_view::element::is_null() const noexcept
+{
+    return v_ && raw() == "null";
+}
+
+std::string_view
+json_view::element::raw() const noexcept
+{
+    if(!v_)
+        return {};
+    auto const& v = *v_;
+    char const c = v.at(tok_);
+    if(c == '{' || c == '[')
+    {
+        std::size_t const first = v.index.pos(tok_);
+        std::size_t const last = v.index.pos(v.index.match(tok_));
+        return std::string_view(v.data).substr(first, last - first + 1);
+    }
+    return v.text(tok_);
+}
+
+std::optional<json::value>
+json_view::element::to_value() const
+{
+    if(!v_)
+        return std::nullopt;
+    std::error_code ec;
+    auto jv = json::parse(raw(), ec);
+    if(ec)
+        return std::nullopt;
+    return jv;
+}
+
+//----------------------------------------------------------
+
+json_view::json_view() noexcept = default;
+
+json_view::json_view(std::string data)
+    : impl_(std::make_shared<impl const>(std::move(data)))
+{
+}
+
+bool
+json_view::valid() const noexcept
+{
+    return impl_ && impl_->valid;
+}
+
+std::string const&
+json_view::data() const noexcept
+{
+    static std::string const empty;
+    return impl_ ? impl_->data : empty;
+}
+
+json_view::element
+json_view::root() const noexcept
+{
+    return element(impl_.get(), 0);
+}
+
+std::optional<json_view::element>
+json_view::at_pointer(std::string_view ptr) const
+{
+    if(!valid())
+        return std::nullopt;
+    element e = root();
+    if(ptr.empty())
+        return e;
+    if(ptr.front() != '/')
+        return std::nullopt;
+    std::string token;
+    while(!ptr.empty())
+    {
+        ptr.remove_prefix(1);
+        auto const slash = ptr.find('/');
+        auto const raw = ptr.substr(0, slash);
+        ptr = slash == std::string_view::npos ?
+            std::string_view() : ptr.substr(slash);
+
+        // ~1 is '/' and ~0 is '~'
+        token.clear();
+        for(std::size_t i = 0; i < raw.size(); ++i)
+        {
+            if(raw[i] != '~')
+            {
+                token.push_back(raw[i]);
+                continue;
+            }
+            if(i + 1 >= raw.size() || (raw[i + 1] != '0' && raw[i + 1] != '1'))
+                return std::nullopt;
+            token.push_back(raw[++i] == '0' ? '~' : '/');
+        }
+
+        std::optional<element> next;
+        if(e.kind() == value_kind::object)
+        {
+            next = e.find(token);
+        }
+        else if(e.kind() == value_kind::array)
+        {
+            // Digits only, without leading zeros
+            if(token.empty() || (token.size() > 1 && token[0] == '0'))
+                return std::nullopt;
+            std::size_t n = 0;
+            auto const r = std::from_chars(
+                token.data(), token.data() + token.size(), n);
+            if(r.ec != std::errc() || r.ptr != token.data() + token.size())
+                return std::nullopt;
+            next = e.at(n);
+        }
+        if(!next)
+            return std::nullopt;
+        e = *next;
+    }
+    return e;
+}
+
+} // namespace burl
+} // namespace boost
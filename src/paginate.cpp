@@ -0,0 +1,99 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/burl/paginate.hpp>
+
+#include "src/detail/link_header.hpp"
+#include "src/detail/paginator_impl.hpp"
+
+namespace boost {
+namespace burl {
+
+paginator::paginator() noexcept = default;
+
+paginator::paginator(std::shared_ptr<impl> p) noexcept
+    : impl_(std::move(p))
+{
+}
+
+paginator::~paginator()
+{
+    if(impl_)
+    {
+        impl_->queue.stop();
+        impl_->stop.request_stop();
+    }
+}
+
+paginator::paginator(paginator&&) noexcept = default;
+
+paginator&
+paginator::operator=(paginator&& other) noexcept
+{
+    if(this != &other)
+    {
+        paginator old(std::move(*this));
+        impl_ = std::move(other.impl_);
+    }
+    return *this;
+}
+
+bool
+paginator::done() const noexcept
+{
+    return !impl_ || impl_->queue.done();
+}
+
+std::size_t
+paginator::pages() const noexcept
+{
+    return impl_ ? impl_->yielded : 0;
+}
+
+capy::io_task<response<std::string>>
+paginator::next()
+{
+    // TODO: Implementation steps:
+    // 1. If done(), fail with std::errc::result_out_of_range
+    // 2. If !queue.ready(), queue.wait(), start a fetch if
+    //    should_fetch(), store the handle in waiter and
+    //    suspend until the fetch completes
+    // 3. page = queue.pop(); ++yielded
+    // 4. If queue.should_fetch(), start the next fetch now so
+    //    it overlaps the caller's work on this page
+    // 5. Return {page.ec, std::move(page.r)}
+    //
+    // A fetch (run_async on the session's executor, holding a
+    // shared_ptr to the state):
+    // a. queue.start_fetch(); co_await s.get(*next_url, opts)
+    //    with opts.stop_token replaced by stop.get_token(), and
+    //    a std::stop_callback on the caller's token requesting
+    //    stop on it
+    // b. Find the next URL:
+    //    - cursor_pointer empty: detail::find_link() on each
+    //      Link header for "next", resolved against r.url,
+    //      the URL after redirects
+    //    - otherwise parse the body as JSON and look up
+    //      cursor_pointer; a missing, null or empty value ends
+    //      the sequence. With cursor_param empty the value is
+    //      a URL, resolved like a link; else copy the current
+    //      URL and set cursor_param to the value
+    //    A next URL equal to the current one ends the
+    //    sequence rather than looping forever
+    // c. last = ec || !r.ok() || !next || max_pages reached;
+    //    queue.on_fetched({ec, std::move(r)}, last)
+    // d. If waiter is set, resume it on the session's executor
+    // e. If queue.should_fetch() and nobody waits, fetch again;
+    //    with lookahead > 1 this keeps the queue topped up
+
+    co_return {make_error_code(error::not_implemented), {}};
+}
+
+} // namespace burl
+} // namespace boost
@@ -9,7 +9,12 @@
 
 #include <boost/burl/parse_args.hpp>
 
+#include <charconv>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
 #include <cstring>
+#include <limits>
 #include <string_view>
 
 namespace boost {
@@ -72,6 +77,243 @@ make_missing_value_error(std::string_view opt)
     return result;
 }
 
+parse_result
+make_invalid_value_error(std::string_view opt, std::string_view value)
+{
+    parse_result result;
+    result.ec = make_args_error(3);
+    result.error_message = "invalid value for ";
+    result.error_message += opt;
+    result.error_message += ": ";
+    result.error_message += value;
+    return result;
+}
+
+// Parse plain decimal digits at the start of s, returning the
+// end or null if there are none or the value exceeds max.
+// strtoull would also take whitespace and a sign, wrapping
+// negative values, and saturate on overflow
+char const*
+parse_digits(char const* s, std::uint64_t max, std::uint64_t& v)
+{
+    auto const r = std::from_chars(s, s + std::strlen(s), v);
+    if(r.ec != std::errc() || v > max)
+        return nullptr;
+    return r.ptr;
+}
+
+// Parse a plain decimal number like "10" or "1.5" at the
+// start of s, returning the end or null if there is none.
+// strtod would also take whitespace, signs, exponents, hex,
+// "inf" and "nan"
+char const*
+parse_decimal(char const* s, double& v)
+{
+    bool digit = false;
+    bool dot = false;
+    char const* p = s;
+    for(; (*p >= '0' && *p <= '9') || *p == '.'; ++p)
+    {
+        if(*p == '.')
+        {
+            if(dot)
+                return nullptr;
+            dot = true;
+        }
+        else
+        {
+            digit = true;
+        }
+    }
+    if(!digit)
+        return nullptr;
+
+    char* end = nullptr;
+    v = std::strtod(s, &end);
+    if(end != p || !std::isfinite(v))
+        return nullptr;
+    return p;
+}
+
+// Parse a transfer speed like "100", "200K", "1.5M" or "1G"
+// Suffixes are powers of 1024, as in curl
+std::optional<std::uint64_t>
+parse_speed(char const* s)
+{
+    double v;
+    char const* end = parse_decimal(s, v);
+    if(!end)
+        return std::nullopt;
+    switch(*end)
+    {
+    case '\0':
+        break;
+    case 'k': case 'K':
+        v *= 1024.0;
+        ++end;
+        break;
+    case 'm': case 'M':
+        v *= 1024.0 * 1024.0;
+        ++end;
+        break;
+    case 'g': case 'G':
+        v *= 1024.0 * 1024.0 * 1024.0;
+        ++end;
+        break;
+    default:
+        return std::nullopt;
+    }
+    if(*end != '\0')
+        return std::nullopt;
+    // Zero means unlimited, so a rate that truncates to it
+    // is refused rather than silently lifting the limit
+    if(v < 1.0 || v >= 18446744073709551616.0)
+        return std::nullopt;
+    return static_cast<std::uint64_t>(v);
+}
+
+// Parse a request rate like "2/s", "14/m" or "3"
+// A missing unit means per hour, as in curl
+bool
+parse_rate(
+    char const* s,
+    std::uint64_t& count,
+    std::chrono::seconds& period)
+{
+    // Zero would mean unlimited, as for --limit-rate
+    std::uint64_t n = 0;
+    char const* end = parse_digits(
+        s, (std::numeric_limits<std::uint64_t>::max)(), n);
+    if(!end || n == 0)
+        return false;
+    period = std::chrono::hours(1);
+    if(*end == '/')
+    {
+        switch(end[1])
+        {
+        case 's': period = std::chrono::seconds(1); break;
+        case 'm': period = std::chrono::minutes(1); break;
+        case 'h': period = std::chrono::hours(1); break;
+        case 'd': period = std::chrono::hours(24); break;
+        default:
+            return false;
+        }
+        end += 2;
+    }
+    if(*end != '\0')
+        return false;
+    count = n;
+    return true;
+}
+
+// Split on ':' outside of [brackets] into at most n fields,
+// the last of which takes the rest of the string
+std::vector<std::string_view>
+split_fields(std::string_view s, std::size_t n)
+{
+    std::vector<std::string_view> fields;
+    std::size_t start = 0;
+    bool bracket = false;
+    for(std::size_t i = 0;
+        i < s.size() && fields.size() + 1 < n; ++i)
+    {
+        if(s[i] == '[')
+            bracket = true;
+        else if(s[i] == ']')
+            bracket = false;
+        else if(s[i] == ':' && !bracket)
+        {
+            fields.push_back(s.substr(start, i - start));
+            start = i + 1;
+        }
+    }
+    fields.push_back(s.substr(start));
+    return fields;
+}
+
+// Remove the brackets around an IPv6 address
+std::string_view
+unbracket(std::string_view s)
+{
+    if(s.size() >= 2 && s.front() == '[' && s.back() == ']')
+        return s.substr(1, s.size() - 2);
+    return s;
+}
+
+// Parse a port number; an empty string gives 0 if allowed
+bool
+parse_port(std::string_view s, std::uint16_t& port, bool allow_empty)
+{
+    if(s.empty())
+    {
+        port = 0;
+        return allow_empty;
+    }
+    unsigned long n = 0;
+    for(char c : s)
+    {
+        if(c < '0' || c > '9')
+            return false;
+        n = n * 10 + static_cast<unsigned long>(c - '0');
+        if(n > 65535)
+            return false;
+    }
+    if(n == 0)
+        return false;
+    port = static_cast<std::uint16_t>(n);
+    return true;
+}
+
+// Parse "[+]host:port:addr[,addr]..." or "-host:port", as in curl
+bool
+parse_resolve(std::string_view s, resolve_override& r)
+{
+    bool remove = false;
+    if(!s.empty() && s.front() == '+')
+        s.remove_prefix(1);
+    else if(!s.empty() && s.front() == '-')
+    {
+        remove = true;
+        s.remove_prefix(1);
+    }
+    auto fields = split_fields(s, remove ? 2 : 3);
+    if(fields.size() != (remove ? 2u : 3u) || fields[0].empty())
+        return false;
+    r.host = std::string(unbracket(fields[0]));
+    if(!parse_port(fields[1], r.port, false))
+        return false;
+    r.addresses.clear();
+    if(remove)
+        return true;
+    auto list = fields[2];
+    while(!list.empty())
+    {
+        auto pos = list.find(',');
+        auto addr = unbracket(list.substr(0, pos));
+        if(addr.empty())
+            return false;
+        r.addresses.emplace_back(addr);
+        if(pos == std::string_view::npos)
+            break;
+        list.remove_prefix(pos + 1);
+    }
+    return !r.addresses.empty();
+}
+
+// Parse "HOST1:PORT1:HOST2:PORT2", any of which may be empty
+bool
+parse_connect_to(std::string_view s, connect_override& c)
+{
+    auto fields = split_fields(s, 4);
+    if(fields.size() != 4)
+        return false;
+    c.host = std::string(unbracket(fields[0]));
+    c.to_host = std::string(unbracket(fields[2]));
+    return
+        parse_port(fields[1], c.port, true) &&
+        parse_port(fields[3], c.to_port, true);
+}
+
 // Get next argument value for options that require one
 // Returns nullptr if no value available
 char const*
@@ -151,6 +393,21 @@ handle_long_option(
         args.remote_name = true;
         return true;
     }
+    if(name == "tcp-nodelay")
+    {
+        args.tcp_nodelay = true;
+        return true;
+    }
+    if(name == "tcp-fastopen")
+    {
+        args.tcp_fastopen = true;
+        return true;
+    }
+    if(name == "no-keepalive")
+    {
+        args.no_keepalive = true;
+        return true;
+    }
     if(name == "compressed")
     {
         args.compressed = true;
@@ -467,6 +724,216 @@ handle_long_option(
         args.connect_timeout = std::atof(v);
         return true;
     }
+    if(name == "expect100-timeout")
+    {
+        auto v = require_value();
+        if(!v)
+        {
+            result = make_missing_value_error("--expect100-timeout");
+            return false;
+        }
+        // At most a day, so the value converts to milliseconds
+        // without overflow; no server takes longer to answer
+        constexpr double max_secs = 86400;
+        double secs;
+        auto end = parse_decimal(v, secs);
+        if(!end || *end != '\0' || secs > max_secs)
+        {
+            result = make_invalid_value_error("--expect100-timeout", v);
+            return false;
+        }
+        args.expect100_timeout = secs;
+        return true;
+    }
+    if(name == "limit-rate")
+    {
+        auto v = require_value();
+        if(!v)
+        {
+            result = make_missing_value_error("--limit-rate");
+            return false;
+        }
+        auto speed = parse_speed(v);
+        if(!speed)
+        {
+            result = make_invalid_value_error("--limit-rate", v);
+            return false;
+        }
+        args.limit_rate = *speed;
+        return true;
+    }
+    if(name == "rate")
+    {
+        auto v = require_value();
+        if(!v)
+        {
+            result = make_missing_value_error("--rate");
+            return false;
+        }
+        std::uint64_t count;
+        if(!parse_rate(v, count, args.rate_period))
+        {
+            result = make_invalid_value_error("--rate", v);
+            return false;
+        }
+        args.rate = count;
+        return true;
+    }
+    if(name == "keepalive-time")
+    {
+        auto v = require_value();
+        if(!v)
+        {
+            result = make_missing_value_error("--keepalive-time");
+            return false;
+        }
+        // The socket option takes an int
+        std::uint64_t n;
+        auto end = parse_digits(v, INT_MAX, n);
+        if(!end || *end != '\0' || n == 0)
+        {
+            result = make_invalid_value_error("--keepalive-time", v);
+            return false;
+        }
+        args.keepalive_time = static_cast<long>(n);
+        return true;
+    }
+    if(name == "keepalive-cnt")
+    {
+        auto v = require_value();
+        if(!v)
+        {
+            result = make_missing_value_error("--keepalive-cnt");
+            return false;
+        }
+        // The socket option takes an int
+        std::uint64_t n;
+        auto end = parse_digits(v, INT_MAX, n);
+        if(!end || *end != '\0' || n == 0)
+        {
+            result = make_invalid_value_error("--keepalive-cnt", v);
+            return false;
+        }
+        args.keepalive_cnt = static_cast<unsigned>(n);
+        return true;
+    }
+    if(name == "interface")
+    {
+        auto v = require_value();
+        if(!v)
+        {
+            result = make_missing_value_error("--interface");
+            return false;
+        }
+        // Several may be given, separated by commas
+        std::string_view list(v);
+        for(;;)
+        {
+            auto pos = list.find(',');
+            auto item = list.substr(0, pos);
+            if(item.empty())
+            {
+                result = make_invalid_value_error("--interface", v);
+                return false;
+            }
+            args.interfaces.emplace_back(item);
+            if(pos == std::string_view::npos)
+                return true;
+            list.remove_prefix(pos + 1);
+        }
+    }
+    if(name == "local-port")
+    {
+        auto v = require_value();
+        if(!v)
+        {
+            result = make_missing_value_error("--local-port");
+            return false;
+        }
+        std::string_view s(v);
+        auto dash = s.find('-');
+        std::uint16_t first = 0;
+        std::uint16_t last = 0;
+        if( !parse_port(s.substr(0, dash), first, false) ||
+            (dash != std::string_view::npos &&
+                (!parse_port(s.substr(dash + 1), last, false) ||
+                    last < first)))
+        {
+            result = make_invalid_value_error("--local-port", v);
+            return false;
+        }
+        args.local_port = first;
+        if(dash != std::string_view::npos)
+            args.local_port_last = last;
+        return true;
+    }
+    if(name == "resolve")
+    {
+        auto v = require_value();
+        if(!v)
+        {
+            result = make_missing_value_error("--resolve");
+            return false;
+        }
+        resolve_override r;
+        if(!parse_resolve(v, r))
+        {
+            result = make_invalid_value_error("--resolve", v);
+            return false;
+        }
+        args.resolve.push_back(std::move(r));
+        return true;
+    }
+    if(name == "connect-to")
+    {
+        auto v = require_value();
+        if(!v)
+        {
+            result = make_missing_value_error("--connect-to");
+            return false;
+        }
+        connect_override c;
+        if(!parse_connect_to(v, c))
+        {
+            result = make_invalid_value_error("--connect-to", v);
+            return false;
+        }
+        args.connect_to.push_back(std::move(c));
+        return true;
+    }
+    if(name == "warm-state")
+    {
+        auto v = require_value();
+        if(!v)
+        {
+            result = make_missing_value_error("--warm-state");
+            return false;
+        }
+        args.warm_state = v;
+        return true;
+    }
+    if(name == "hsts")
+    {
+        auto v = require_value();
+        if(!v)
+        {
+            result = make_missing_value_error("--hsts");
+            return false;
+        }
+        args.hsts = v;
+        return true;
+    }
+    if(name == "alt-svc")
+    {
+        auto v = require_value();
+        if(!v)
+        {
+            result = make_missing_value_error("--alt-svc");
+            return false;
+        }
+        args.alt_svc = v;
+        return true;
+    }
 
     // Unknown option
     result = make_error("unknown option: --" + std::string(name));
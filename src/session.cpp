@@ -16,9 +16,47 @@
 #include <boost/corosio/tls/openssl_stream.hpp>
 #include <boost/json/parse.hpp>
 
+#include "src/detail/adaptive_limit.hpp"
+#include "src/detail/body_digest.hpp"
+#include "src/detail/circuit_breaker.hpp"
+#include "src/detail/connection_settings.hpp"
+#include "src/detail/continue_wait.hpp"
+#include "src/detail/cow.hpp"
+#include "src/detail/endpoint_set.hpp"
+#include "src/detail/exchange_state.hpp"
+#include "src/detail/origin_scheduler.hpp"
+#include "src/detail/paginator_impl.hpp"
+#include "src/detail/pool_maintenance.hpp"
+#include "src/detail/request_gate.hpp"
+#include "src/detail/resolve_table.hpp"
+#include "src/detail/shared_state.hpp"
+#include "src/detail/socket_options.hpp"
+#include "src/detail/source_set.hpp"
+#include "src/detail/timer_wheel.hpp"
+#include "src/detail/token_bucket.hpp"
+#include "src/detail/wait_queue.hpp"
+#include "src/detail/warm_state.hpp"
+#include "src/detail/websocket_impl.hpp"
+
+#include <cerrno>
+#include <coroutine>
+#include <cstdio>
+#include <filesystem>
 #include <map>
+#include <random>
+#include <string_view>
 #include <vector>
 
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <share.h>
+#include <sys/stat.h>
+#else
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
 namespace boost {
 namespace burl {
 
@@ -42,63 +80,499 @@ struct session::impl
     // Configuration
     //------------------------------------------------------
 
-    // Default headers sent with every request
-    http::fields default_headers_;
+    struct config
+    {
+        // Default headers sent with every request
+        http::fields default_headers;
+
+        // Default authentication
+        std::shared_ptr<auth_base> auth;
+
+        // TLS verification settings
+        verify_config verify;
+
+        // Maximum redirects to follow
+        int max_redirects = 30;
+
+        // Default request timeout
+        std::chrono::milliseconds timeout{30000};
+
+        // Which bodies wait for 100 Continue
+        std::optional<expect_continue> expect = expect_continue{};
+    };
+
+    // Settings, shared with derived sessions until changed
+    detail::cow<config> config_;
+
+    // Cookie storage, shared the same way
+    detail::cow<cookie_jar> cookies_;
+
+    //------------------------------------------------------
+    // Bandwidth limiting
+    //------------------------------------------------------
+
+    // Session-wide limits, shared by every request
+    detail::token_bucket upload_limit_;
+    detail::token_bucket download_limit_;
+
+    // Make a bucket for a rate in bytes per second
+    static
+    detail::token_bucket
+    make_bucket(std::uint64_t bytes_per_second)
+    {
+        return detail::token_bucket(
+            bytes_per_second, std::chrono::seconds(1));
+    }
+
+    // Per-request transfer state
+    struct transfer
+    {
+        // Per-request limits (unlimited unless set in options)
+        detail::token_bucket upload_limit;
+        detail::token_bucket download_limit;
+
+        // Holds the body back after Expect: 100-continue
+        detail::continue_wait expect;
+
+        // Set once a 417 answered the expectation
+        bool expect_refused = false;
 
-    // Cookie storage
-    cookie_jar cookies_;
+        // Checks the final response's body, when requested
+        std::optional<detail::digest_check_state> digest;
 
-    // Default authentication
-    std::shared_ptr<auth_base> auth_;
+        transfer() = default;
 
-    // TLS verification settings
-    verify_config verify_;
+        explicit
+        transfer(request_options const& opts)
+        {
+            if(opts.limit_rate)
+            {
+                upload_limit = make_bucket(opts.limit_rate->upload);
+                download_limit = make_bucket(opts.limit_rate->download);
+            }
+            if(opts.digest)
+                reset_digest(*opts.digest);
+        }
 
-    // Maximum redirects to follow
-    int max_redirects_ = 30;
+        // Start the check over, for a new response
+        void
+        reset_digest(digest_check const& d)
+        {
+            digest.emplace(
+                d.algorithm == digest_algorithm::sha256 ?
+                    detail::digest_kind::sha256 :
+                d.algorithm == digest_algorithm::md5 ?
+                    detail::digest_kind::md5 :
+                    detail::digest_kind::crc32c,
+                d.required);
+            if(auto v = detail::parse_hex_digest(d.expected);
+                v && !v->empty())
+                digest->expect(std::move(*v));
+        }
+    };
 
-    // Default request timeout
-    std::chrono::milliseconds timeout_{30000};
+    // Size of the buffer used for body reads and writes
+    static constexpr std::size_t io_buffer_size = 65536;
 
     //------------------------------------------------------
     // Connection pooling
     //------------------------------------------------------
 
-    // Key for connection pool lookup
-    struct pool_key
+    using pool_key = detail::pool_key;
+    using connection = detail::connection;
+
+    // Connections, DNS answers and TLS sessions; shared with
+    // other sessions when constructed from a share
+    std::shared_ptr<detail::shared_state> shared_;
+
+    // True unless the shared state came from a share
+    bool owns_shared_ = true;
+
+    // Whether shared_->hsts upgrades requests to HTTPS
+    bool hsts_ = false;
+
+    // Whether requests go to shared_->alt_svc alternatives
+    bool alt_svc_ = false;
+
+    // Local addresses new connections are bound to, in turn
+    detail::source_set sources_;
+
+    // How long an idle pooled connection is kept
+    std::chrono::milliseconds idle_timeout_{60000};
+
+    // Background pool maintenance, when enabled
+    std::optional<detail::pool_maintenance> maintenance_;
+
+    // Minimum idle connections for origins which differ from
+    // the pool options
+    std::map<pool_key, std::size_t> origin_min_idle_;
+
+    // Return the minimum idle connections for an origin
+    std::size_t
+    min_idle_for(pool_key const& key) const
     {
-        std::string host;
-        std::uint16_t port;
-        bool https;
+        auto it = origin_min_idle_.find(key);
+        if(it != origin_min_idle_.end())
+            return it->second;
+        if(maintenance_)
+            return maintenance_->options().min_idle;
+        return 0;
+    }
+
+    // How requests are spread across a host's addresses
+    load_balancing balancing_;
 
-        auto operator<=>(pool_key const&) const = default;
+    // Resolved addresses of each host, with their load
+    std::map<pool_key, detail::endpoint_set<std::string>> endpoints_;
+
+    // --resolve and --connect-to overrides, consulted before DNS
+    detail::resolve_table resolve_table_;
+
+    // Options for new sockets, and per-origin replacements
+    socket_options socket_opts_;
+    std::map<pool_key, socket_options> origin_socket_opts_;
+
+    // Return the socket options for connections to an origin
+    socket_options const&
+    socket_options_for(pool_key const& key) const
+    {
+        auto it = origin_socket_opts_.find(key);
+        if(it != origin_socket_opts_.end())
+            return it->second;
+        return socket_opts_;
+    }
+
+    // Build the pool key for a URL
+    static
+    pool_key
+    make_pool_key(urls::url_view url)
+    {
+        bool const https = url.scheme_id() == urls::scheme::https;
+        std::uint16_t port = https ? 443 : 80;
+        if(url.has_port())
+            port = url.port_number();
+        return {url.host(), port, https, {}, {}};
+    }
+
+    //------------------------------------------------------
+    // Request rate limiting
+    //------------------------------------------------------
+
+    // A request suspended until admission or a concurrency
+    // slot
+    struct request_waiter
+    {
+        std::coroutine_handle<> h;
+
+        // Set if the request stopped waiting without being
+        // admitted or given a slot
+        std::error_code ec;
     };
 
-    // A pooled connection
-    struct connection
+    // Session-wide admission rate
+    detail::token_bucket request_rate_;
+
+    // Rate given to each origin on first use
+    request_rate origin_rate_;
+
+    // Per-origin admission buckets
+    std::map<pool_key, detail::token_bucket> origin_rates_;
+
+    // Requests suspended until admission. One timer, armed
+    // for the earliest entry, resumes all of them.
+    detail::wait_queue<request_waiter*> admission_waiters_;
+
+    // Make a bucket for a request rate
+    static
+    detail::token_bucket
+    make_bucket(request_rate const& r)
     {
-        std::unique_ptr<corosio::socket> socket;
-        std::unique_ptr<corosio::openssl_stream> tls;
+        return detail::token_bucket(
+            r.count, r.interval, r.burst,
+            std::chrono::milliseconds(1));
+    }
+
+    //------------------------------------------------------
+    // Concurrency limiting
+    //------------------------------------------------------
+
+    // Slots for requests in flight, shared fairly by origins
+    detail::origin_scheduler<pool_key, request_waiter*> scheduler_;
+
+    // Adaptive limits, when enabled
+    std::optional<adaptive_concurrency> adaptive_;
 
-        // Returns the appropriate stream for I/O
-        corosio::io_stream&
-        stream()
+    // Per-origin adaptive limit state
+    std::map<pool_key, detail::adaptive_limit> adaptive_limits_;
+
+    // Return an origin's adaptive limit. The first time the
+    // origin is seen, the scheduler is capped at the initial
+    // limit, so that a cold burst of requests to it is limited
+    // before any of them completes. Requires adaptive_
+    detail::adaptive_limit&
+    adaptive_limit_for(pool_key const& key)
+    {
+        auto it = adaptive_limits_.find(key);
+        if(it == adaptive_limits_.end())
         {
-            // TODO: Return TLS stream if present, else socket
-            return *socket;
+            it = adaptive_limits_.emplace(
+                key, detail::adaptive_limit(*adaptive_)).first;
+            scheduler_.set_limit(key, it->second.limit());
         }
-    };
+        return it->second;
+    }
+
+    // Feed a completed request into its origin's adaptive
+    // limit and apply the new limit, appending any waiters
+    // that may now start to `ready`
+    void
+    on_complete(
+        pool_key const& key,
+        detail::adaptive_limit::duration rtt,
+        std::size_t in_flight,
+        bool failed,
+        std::vector<request_waiter*>& ready)
+    {
+        if(!adaptive_)
+            return;
+        auto& limit = adaptive_limit_for(key);
+        limit.on_sample(rtt, in_flight, failed);
+        scheduler_.set_limit(key, limit.limit());
+        scheduler_.dispatch(ready);
+    }
+
+    // Return true if a request to `key` should be shed
+    bool
+    overloaded(pool_key const& key) const
+    {
+        return adaptive_ &&
+            adaptive_->max_queue != 0 &&
+            scheduler_.pending(key) >= adaptive_->max_queue;
+    }
+
+    //------------------------------------------------------
+    // Circuit breaking
+    //------------------------------------------------------
+
+    // Circuit breaker settings, when enabled
+    std::optional<circuit_breaker_config> breaker_cfg_;
+
+    // Per-origin circuit breakers
+    std::map<pool_key, detail::circuit_breaker> breakers_;
+
+    // Ask the origin's breaker whether a request may start
+    detail::circuit_breaker::permit
+    check_circuit(
+        pool_key const& key,
+        detail::circuit_breaker::time_point now)
+    {
+        if(!breaker_cfg_)
+            return {detail::circuit_breaker::admission::allowed, 0};
+        auto it = breakers_.find(key);
+        if(it == breakers_.end())
+            it = breakers_.emplace(
+                key, detail::circuit_breaker(*breaker_cfg_)).first;
+        return it->second.allow(now);
+    }
+
+    // Report the outcome of a request to the origin's breaker
+    void
+    record_circuit(
+        pool_key const& key,
+        detail::circuit_breaker::permit p,
+        bool failed,
+        detail::circuit_breaker::time_point now)
+    {
+        auto it = breakers_.find(key);
+        if(it != breakers_.end())
+            it->second.on_result(p, failed, now);
+    }
+
+    //------------------------------------------------------
+
+    // Map a request priority to a scheduler class
+    static
+    std::size_t
+    priority_class(request_options const& opts) noexcept
+    {
+        switch(opts.priority.value_or(request_priority::normal))
+        {
+        case request_priority::high: return 0;
+        case request_priority::normal: return 1;
+        case request_priority::low: return 2;
+        }
+        return 1;
+    }
+
+    // Charge the session and origin buckets for one request
+    // and return the time at which it may start
+    detail::token_bucket::time_point
+    admit(pool_key const& key, detail::token_bucket::time_point now)
+    {
+        detail::token_bucket* origin = nullptr;
+        if(origin_rate_.count != 0)
+        {
+            auto it = origin_rates_.find(key);
+            if(it == origin_rates_.end())
+                it = origin_rates_.emplace(
+                    key, make_bucket(origin_rate_)).first;
+            origin = &it->second;
+        }
+        return detail::reserve_both(
+            &request_rate_, origin, 1, now);
+    }
+
+    //------------------------------------------------------
+    // Timers
+    //------------------------------------------------------
+
+    // Request and idle timeouts for every connection live in
+    // shared_->timers. When one fires for a connection in use,
+    // its I/O is cancelled and the request fails with
+    // error::timeout; for an idle connection, it is closed and
+    // leaves its pool.
+
+    // Arm a connection's timer, replacing any pending one
+    void
+    arm(connection& c, detail::timer_wheel<connection*>::time_point expiry)
+    {
+        shared_->timers.cancel(c.timer);
+        c.timer = shared_->timers.add(expiry, &c);
+    }
 
-    // Connection pools keyed by (host, port, https)
-    std::map<pool_key, std::vector<std::unique_ptr<connection>>> pools_;
+    // Cancel a connection's timer
+    void
+    disarm(connection& c) noexcept
+    {
+        shared_->timers.cancel(c.timer);
+        c.timer = {};
+    }
+
+    // Return when the session timer must next fire: the
+    // earliest of the wheel, the admission and throttle waits,
+    // and the deadlines of queued requests
+    std::optional<std::chrono::steady_clock::time_point>
+    next_wakeup() const
+    {
+        auto t = shared_->timers.next_expiry();
+        if(auto a = admission_waiters_.earliest())
+            if(!t || *a < *t)
+                t = a;
+        auto const d = scheduler_.earliest_deadline();
+        if(d != scheduler_.no_deadline && (!t || d < *t))
+            t = d;
+        return t;
+    }
+
+    //------------------------------------------------------
+    // Shutdown
+    //------------------------------------------------------
+
+    // Counts requests in flight; refuses new ones once closing
+    detail::request_gate gate_;
+
+    // shutdown() calls suspended until the last request leaves
+    std::vector<std::coroutine_handle<>> drain_waiters_;
+
+    // Take every idle connection out of the pools. Those of
+    // a share are left to the sessions still using it.
+    std::vector<std::unique_ptr<connection>>
+    take_idle()
+    {
+        std::vector<std::unique_ptr<connection>> v;
+        if(!owns_shared_)
+            return v;
+        for(auto& [key, pool] : shared_->pools)
+        {
+            for(auto& c : pool)
+            {
+                disarm(*c);
+                v.push_back(std::move(c));
+            }
+        }
+        shared_->pools.clear();
+        return v;
+    }
+
+    /** Close a connection cleanly.
+
+        TODO: Implementation steps:
+        1. If conn.tls, send close_notify with async_shutdown,
+           bounded by the shutdown deadline; a peer which does
+           not answer is not waited for
+        2. Shut down and close the socket; errors are ignored
+    */
+    capy::io_task<>
+    close_connection(std::unique_ptr<connection> conn);
+
+    /** Run the pool maintenance task.
+
+        Started by set_pool_options() and stopped by
+        shutdown(). Its work is spread out so that it never
+        competes with requests in bursts.
+
+        TODO: Implementation steps:
+        1. Loop until maintenance_ is reset or the session
+           shuts down:
+           a. Sleep until maintenance_->next_run(now), on the
+              session timer like any other wait
+           b. For each pool, close the idle connections for
+              which maintenance_->reap(idle_since, retire_at,
+              now) is true, with close_connection(); do not
+              wait for the closes to finish
+           c. For each origin with min_idle_for(key) > 0,
+              n = maintenance_->replenish(idle, opening,
+              min_idle_for(key), now), counting connections
+              already being opened. Start n connects as in
+              acquire_connection step 5, with the settings of
+              a request without options, each pooled when done;
+              failures count against the endpoint and circuit
+              breaker like any other
+        2. In-use connections past retire_at are not touched
+           here; release_connection closes them when the
+           request finishes
+    */
+    capy::io_task<>
+    run_maintenance();
+
+    /** Run the session timer.
+
+        A single io_context timer serves every burl timeout and
+        wait, so the cost of a pending timeout does not depend
+        on how many requests are in flight.
+
+        TODO: Implementation steps:
+        1. Loop until the session is destroyed:
+           a. w = next_wakeup(); if none, suspend until a timer
+              or waiter becomes the earliest and wakes this loop
+           b. Wait on the io_context timer until w. Adding an
+              earlier entry cancels the wait, and the loop goes
+              round again
+           c. shared_->timers.advance(now, fired). For each connection:
+              if in use, set timed_out and cancel its socket;
+              otherwise close it and remove it from its pool
+           d. Resume the waiters from admission_waiters_.pop_due();
+              a cancelled waiter is no longer there
+           e. scheduler_.expire(now, lead, expired) and resume
+              those waiters with ec = deadline_exceeded
+    */
+    capy::io_task<>
+    run_timer();
 
     //------------------------------------------------------
     // Constructor
     //------------------------------------------------------
 
     impl(corosio::io_context& ioc, corosio::tls::context& tls_ctx)
-        : ioc_(ioc)
-        , tls_ctx_(tls_ctx)
+        : impl(std::make_shared<detail::shared_state>(ioc, tls_ctx))
+    {
+    }
+
+    explicit
+    impl(std::shared_ptr<detail::shared_state> shared)
+        : ioc_(shared->ioc)
+        , tls_ctx_(shared->tls_ctx)
+        , shared_(std::move(shared))
     {
         // TODO: Set default User-Agent header
     }
@@ -114,12 +588,24 @@ struct session::impl
         TODO: Implementation steps:
         1. Create http::request with method and target from URL
         2. Set Host header from URL
-        3. Merge default_headers_ (don't override existing)
+        3. Merge config_->default_headers (don't override
+           existing)
         4. Apply per-request headers from opts
-        5. Apply authentication if set
-        6. Add Cookie header from cookie_jar
-        7. Set Content-Type and body if opts.json or opts.data set
-        8. Return the built request
+        5. Add Cookie header from cookie_jar
+        6. Set Content-Type and body if opts.json or opts.data set
+        7. If config_->expect and
+           continue_wait::should_expect(body size, threshold),
+           set Expect: 100-continue. A body of unknown length
+           counts as large. do_request removes the header
+           again when it repeats a request after a 417
+        8. Apply authentication, if set, last so a signature
+           covers the final headers: build an auth_context
+           and, only if auth->needs_payload_hash(), set its
+           payload_hash to the hex SHA-256 of the body (the
+           empty hash when there is none); then
+           auth->apply(req, ctx). A redirect or 417 retry
+           rebuilds the request and so signs it again
+        9. Return the built request
     */
     http::request
     build_request(
@@ -130,25 +616,99 @@ struct session::impl
     /** Acquire a connection from the pool or create a new one.
     
         TODO: Implementation steps:
-        1. Build pool_key from URL (host, port, https)
-        2. Check if pool has available connection
-        3. If available, return it
-        4. Otherwise, create new connection:
-           a. Resolve hostname via DNS
-           b. Connect TCP socket
-           c. If HTTPS, wrap in TLS stream and handshake
-        5. Return the connection
+        1. Build pool_key from URL (host, port, https). The key
+           always names the URL's host, so overrides never
+           change SNI or the Host header. If alt_svc_
+           and HTTPS, alt = shared_->alt_svc.find(host, port,
+           proto_h1 | proto_h2, now); h3 needs QUIC, which is
+           not supported. An alternative replaces the target
+           of step 2a, offers its protocol in ALPN, and is
+           tried first in step 5, but SNI and certificate
+           verification still use the URL's host (RFC 7838
+           2.1)
+        2. If endpoints_ has no entry for the key, or its DNS
+           answer is stale, find the addresses and assign()
+           them to the key's endpoint_set:
+           a. target = resolve_table_.route(host, port)
+           b. If resolve_table_.lookup(target.host, target.port)
+              returns addresses, use them without DNS
+           c. Otherwise use shared_->dns.find(target.host, now)
+              if present, else resolve target.host via DNS and
+              put() the answer with its TTL
+           d. Connect to target.port
+        3. address = endpoints_[key].acquire(now). Then
+           conn_key is the key with settings =
+           detail::connection_settings(https,
+           opts.verify.value_or(config_->verify), target,
+           resolve_table_.lookup(target.host, target.port),
+           alt, socket_options_for(key)). Pools and TLS
+           sessions may be shared with sessions whose settings
+           differ, so steps 4 and 5 use conn_key and neither
+           is used unless the settings match
+        4. If any pool for the origin and settings (the range
+           of shared_->pools from conn_key with an empty
+           source) has an idle connection to that address,
+           return it and disarm() it
+        5. Otherwise, create new connection:
+           a. Open the socket, apply_socket_options() with
+              socket_options_for(key) to its native handle
+           b. If !sources_.empty(), bind to sources_.next() for
+              the address's family (AF_INET or AF_INET6) and,
+              with a port range, each port from first_port() to
+              last_port() until one is free; pool the connection
+              under conn_key with source set to that address. If
+              next() returns nullptr, no source can reach the
+              address: treat it as failed (step 5f) without
+              connecting
+           c. Connect it to the address. With tcp_fastopen the
+              request is written right after connect() so it can
+              ride in the SYN
+           d. If HTTPS, wrap in TLS stream and handshake. Offer
+              the session in shared_->tls_sessions for conn_key
+              (SSL_set_session) and store the new one after the
+              handshake, so connections from other sessions of
+              a share resume instead of doing a full handshake.
+              Record origin_h2 if ALPN chose h2 and
+              origin_tls_resumption if the session was resumed
+              in shared_->capabilities for the key
+           e. conn->state.on_connected(); if maintenance_,
+              conn->retire_at = maintenance_->retire_at(now)
+           f. On failure, release() the address as failed and
+              retry from step 3 with another address. When
+              connecting to an alternative fails, or its
+              handshake does, shared_->alt_svc.remove() it,
+              clear endpoints_[key] and start over from step 2
+              with the origin itself
+        6. Set conn->address and conn->key = conn_key, which
+           release_connection pools it under, and return the
+           connection
     */
     capy::io_task<std::unique_ptr<connection>>
-    acquire_connection(urls::url_view url);
+    acquire_connection(
+        urls::url_view url,
+        request_options const& opts);
 
     /** Return a connection to the pool.
     
         TODO: Implementation steps:
-        1. Check if connection is still usable (not closed)
-        2. If usable, add to pool for reuse
-        3. If not usable, let it destruct
-        4. Consider pool size limits
+        1. endpoints_[key].release(conn->address, rtt, failed,
+           now) so the address's load and health are updated
+        2. Check if connection is still usable: not closed,
+           not past conn->retire_at, and conn->state.reusable().
+           A request cancelled or timed out mid-message leaves
+           the stream out of step with the peer, so such a
+           connection is closed
+        3. If usable, clear timed_out and cancelled, set
+           idle_since = now and add it to the pool for reuse,
+           shared_->pools[conn->key], never to the pool of
+           another origin or settings.
+           Without maintenance_, also arm(*conn, now +
+           idle_timeout_); acquire_connection calls disarm()
+           when it takes the connection back out. With it, the
+           maintenance task reaps idle connections instead, so
+           no timer is armed per release
+        4. If not usable, let it destruct
+        5. Consider pool size limits
     */
     void
     release_connection(pool_key const& key, std::unique_ptr<connection> conn);
@@ -158,51 +718,149 @@ struct session::impl
         TODO: Implementation steps:
         1. Create http::serializer
         2. Start serialization with request
-        3. Loop: prepare() -> write to socket -> consume()
-        4. If request has body, serialize body chunks
+        3. Loop: prepare() -> write to socket -> consume(),
+           calling conn.state.on_send(n) for each write and
+           on_sent() at the end
+           a. Limit each write to the upload quantum of the
+              tightest of xfer.upload_limit and upload_limit_
+           b. reserve_both() the bytes about to be written
+           c. If the returned time is in the future, wait on
+              admission_waiters_ until then (no per-byte checks)
+        4. If request has body, serialize body chunks. With
+           Expect: 100-continue, write the head only, then
+           xfer.expect.start(now + config_->expect->timeout)
+           and read responses, waking at deadline() on the
+           session timer:
+           a. For a 1xx, on_interim(status); send the body on
+              send_body (100 Continue)
+           b. For a final response, on_final(status) and
+              conn.state.on_truncated(): the body is never
+              sent, and read_response continues with the
+              parsed head
+           c. When the timer fires, on_timer(now); send the
+              body on send_body, as the server may not know
+              the expectation
         5. Handle write errors
     */
     capy::io_task<>
-    send_request(connection& conn, http::request const& req);
+    send_request(
+        connection& conn,
+        http::request const& req,
+        transfer& xfer);
 
     /** Read an HTTP response from a connection.
     
         TODO: Implementation steps:
         1. Create http::response_parser
-        2. Loop until headers complete:
+        2. Loop until headers complete, unless send_request
+           already read them while waiting for 100 Continue:
            a. prepare() buffer
            b. Read from socket
-           c. commit() bytes read
-           d. parse()
-        3. Extract http::response from parser
+           c. commit() bytes read, conn.state.on_receive(n)
+           d. parse(); skip interim (1xx) responses
+        3. Extract http::response from parser. If xfer.digest
+           and the response has a body to check (not a
+           redirect about to be followed, not HEAD, 204 or
+           304), pass each header to xfer.digest->on_header();
+           for a 206, skip Repr-Digest, which covers the whole
+           representation rather than the range received
         4. Loop until body complete:
-           a. pull_body() to get chunks
-           b. Append to body buffer
-           c. consume_body()
-           d. Continue reading if needed
-        5. Update cookie_jar from Set-Cookie headers
+           a. Size the read to the download quantum of the
+              tightest of xfer.download_limit and download_limit_
+           b. After reading, reserve_both() the bytes received
+              and wait on admission_waiters_ if the returned
+              time is in the future, before issuing the next read
+           c. pull_body() to get chunks
+           d. Append to body buffer, and xfer.digest->update()
+              the chunk; the parser removes chunked framing
+              but Content-Encoding is undone after, so the
+              digest covers the bytes the headers describe
+           e. consume_body()
+           f. Continue reading if needed
+        5. conn.state.on_complete(). If xfer.digest was fed and
+           !verify(), fail with error::digest_mismatch; the body
+           was read in full, so the connection is still pooled
+        6. Update cookies_.write() from Set-Cookie headers;
+           a derived session gets its own jar only then
+        7. If hsts_ and conn.tls, shared_->hsts.update() the
+           host with each Strict-Transport-Security header. The
+           header is ignored over plain HTTP (RFC 6797 8.1)
+        8. If alt_svc_ and conn.tls, shared_->alt_svc.update()
+           the origin with the Alt-Svc header. If the preferred
+           alternative changed, clear endpoints_ for the origin
+           so the next connection goes to the new one
     */
     capy::io_task<>
-    read_response(connection& conn, response<std::string>& resp);
+    read_response(
+        connection& conn,
+        response<std::string>& resp,
+        transfer& xfer);
+
+    /** Return the largest chunk to move in one throttled I/O.
+    */
+    static
+    std::size_t
+    io_quantum(
+        detail::token_bucket const& a,
+        detail::token_bucket const& b) noexcept
+    {
+        return static_cast<std::size_t>((std::min)(
+            a.quantum(io_buffer_size),
+            b.quantum(io_buffer_size)));
+    }
 
     /** Execute a complete request with redirect handling.
     
         TODO: Implementation steps:
         1. Initialize redirect counter
-        2. Parse URL into urls::url
-        3. Loop:
-           a. Acquire connection for current URL
-           b. Build and send request
-           c. Read response
-           d. If not redirect or max redirects reached, break
-           e. Extract Location header
-           f. Resolve relative URL against current URL
-           g. Handle scheme changes (HTTP<->HTTPS)
-           h. Update request for new URL (may change method on 303)
-           i. Store response in history
-           j. Increment redirect counter
-        4. Release connection to pool
-        5. Return final response
+        2. Parse URL into urls::url. If hsts_ and the URL is
+           http to a host shared_->hsts.secure(), set the
+           scheme to https, and an explicit port 80 to 443,
+           before anything is looked up or connected
+        3. Create a transfer from opts; it lives across redirects
+           so per-request limits cover the whole exchange. If
+           opts.digest->expected is set but is not hex, fail
+           with std::errc::invalid_argument before connecting.
+           Call xfer.reset_digest() before each redirect
+        4. If opts.stop_token.stop_possible(), register a
+           std::stop_callback for the whole call. It posts to
+           the session's executor, which sets cancelled on the
+           current connection and cancels its pending resolve,
+           connect, handshake, write or read. A bandwidth wait
+           on admission_waiters_ is removed with cancel() and
+           resumed with ec = cancelled. The callback is
+           destroyed before the connection is released
+        5. Loop:
+           a. If stop is requested, fail with error::cancelled.
+              Acquire connection for current URL
+           b. arm() its timer for the request's deadline, the
+              earlier of start + opts.timeout.value_or(
+              config_->timeout) and opts.deadline when it is set;
+              the deadline covers the whole exchange, redirects
+              included
+           c. Build and send request
+           d. Read response, then disarm(). If conn.timed_out,
+              fail with error::deadline_exceeded when opts.deadline
+              was the earlier limit and error::timeout otherwise;
+              if conn.cancelled, fail
+              with error::cancelled. If
+              xfer.expect.retry_without_expect() and not
+              xfer.expect_refused, set xfer.expect_refused,
+              erase the Expect header and go back to 5a on a
+              new connection; the 417 is not a redirect and is
+              not returned
+           e. If not redirect or max redirects reached, break
+           f. Extract Location header
+           g. Resolve relative URL against current URL
+           h. Handle scheme changes (HTTP<->HTTPS). If hsts_
+              and the new URL is http to a host
+              shared_->hsts.secure(), upgrade it as in step 2
+           i. Update request for new URL (may change method on 303)
+           j. Store response in history
+           k. Increment redirect counter
+        6. Release connection to pool on every exit path; it
+           is pooled only if its state is still reusable
+        7. Return final response
     */
     capy::io_task<response<std::string>>
     do_request(
@@ -211,6 +869,108 @@ struct session::impl
         request_options const& opts);
 };
 
+//----------------------------------------------------------
+
+namespace {
+
+// Read a whole file
+std::error_code
+read_file(std::string const& path, std::string& data)
+{
+    std::FILE* f = std::fopen(path.c_str(), "rb");
+    if(!f)
+        return {errno, std::generic_category()};
+    char buf[4096];
+    std::size_t n;
+    while((n = std::fread(buf, 1, sizeof(buf), f)) > 0)
+        data.append(buf, n);
+    std::error_code ec;
+    if(std::ferror(f))
+        ec.assign(errno, std::generic_category());
+    std::fclose(f);
+    return ec;
+}
+
+// Create a new file next to path, readable and writable by
+// the owner only, and open it for writing
+std::FILE*
+open_temp_file(std::string const& path, std::string& tmp)
+{
+#ifdef _WIN32
+    std::random_device rd;
+    for(int attempt = 0; attempt < 16; ++attempt)
+    {
+        tmp = path + "." + std::to_string(rd()) + ".tmp";
+        int fd = -1;
+        if(::_sopen_s(&fd, tmp.c_str(),
+            _O_CREAT | _O_EXCL | _O_WRONLY | _O_BINARY,
+            _SH_DENYRW, _S_IREAD | _S_IWRITE) == 0)
+        {
+            std::FILE* f = ::_fdopen(fd, "wb");
+            if(!f)
+            {
+                ::_close(fd);
+                ::_unlink(tmp.c_str());
+            }
+            return f;
+        }
+        if(errno != EEXIST)
+            return nullptr;
+    }
+    return nullptr;
+#else
+    // mkstemp creates with O_CREAT | O_EXCL and mode 0600
+    std::string name = path + ".XXXXXX";
+    int const fd = ::mkstemp(name.data());
+    if(fd < 0)
+        return nullptr;
+    tmp = std::move(name);
+    std::FILE* f = ::fdopen(fd, "wb");
+    if(!f)
+    {
+        int const e = errno;
+        ::close(fd);
+        ::unlink(tmp.c_str());
+        errno = e;
+    }
+    return f;
+#endif
+}
+
+// Replace a file. The data is written beside it and renamed
+// over it, so that a crash never leaves a torn file behind
+std::error_code
+replace_file(std::string const& path, std::string_view data)
+{
+    // The data may hold TLS session secrets and cookies, so
+    // the file is readable by its owner only, and created
+    // under a fresh name so nothing already there is written
+    // through
+    std::string tmp;
+    std::FILE* f = open_temp_file(path, tmp);
+    if(!f)
+        return {errno, std::generic_category()};
+    bool ok = std::fwrite(data.data(), 1, data.size(), f) == data.size();
+    std::error_code ec;
+    if(!ok)
+        ec.assign(errno, std::generic_category());
+    if(std::fclose(f) != 0 && ok)
+    {
+        ok = false;
+        ec.assign(errno, std::generic_category());
+    }
+    if(ok)
+        std::filesystem::rename(tmp, path, ec);
+    if(ec)
+    {
+        std::error_code ignored;
+        std::filesystem::remove(tmp, ignored);
+    }
+    return ec;
+}
+
+} // namespace
+
 //----------------------------------------------------------
 // session public interface implementation
 //----------------------------------------------------------
@@ -218,7 +978,18 @@ struct session::impl
 session::session(
     corosio::io_context& ioc,
     corosio::tls::context& tls_ctx)
-    : impl_(std::make_unique<impl>(ioc, tls_ctx))
+    : impl_(std::make_shared<impl>(ioc, tls_ctx))
+{
+}
+
+session::session(share const& sh)
+    : impl_(std::make_shared<impl>(sh.state_))
+{
+    impl_->owns_shared_ = false;
+}
+
+session::session(std::shared_ptr<impl> p) noexcept
+    : impl_(std::move(p))
 {
 }
 
@@ -229,6 +1000,31 @@ session::session(session&&) noexcept = default;
 session&
 session::operator=(session&&) noexcept = default;
 
+session
+session::derive() const
+{
+    auto p = std::make_shared<impl>(impl_->shared_);
+    p->owns_shared_ = false;
+
+    // Shared until either side changes them. While an editor
+    // from headers() or cookies() lives, the copy is made now
+    // instead, since the caller may still write through it
+    p->config_ = impl_->config_;
+    p->cookies_ = impl_->cookies_;
+
+    // How connections are made
+    p->idle_timeout_ = impl_->idle_timeout_;
+    p->balancing_ = impl_->balancing_;
+    p->resolve_table_ = impl_->resolve_table_;
+    p->socket_opts_ = impl_->socket_opts_;
+    p->origin_socket_opts_ = impl_->origin_socket_opts_;
+    p->sources_ = impl_->sources_;
+    p->hsts_ = impl_->hsts_;
+    p->alt_svc_ = impl_->alt_svc_;
+
+    return session(std::move(p));
+}
+
 corosio::io_context&
 session::get_io_context() noexcept
 {
@@ -247,52 +1043,220 @@ session::tls_context() const noexcept
     return impl_->tls_ctx_;
 }
 
-http::fields&
-session::headers() noexcept
+session::editor<http::fields>
+session::headers()
 {
-    return impl_->default_headers_;
+    return editor<http::fields>(
+        *impl_, impl_->config_.lend().default_headers);
 }
 
 http::fields const&
 session::headers() const noexcept
 {
-    return impl_->default_headers_;
+    return impl_->config_->default_headers;
 }
 
-cookie_jar&
-session::cookies() noexcept
+session::editor<cookie_jar>
+session::cookies()
 {
-    return impl_->cookies_;
+    return editor<cookie_jar>(*impl_, impl_->cookies_.lend());
 }
 
 cookie_jar const&
 session::cookies() const noexcept
 {
-    return impl_->cookies_;
+    return *impl_->cookies_;
+}
+
+void
+session::end_edit(impl& i, http::fields const*) noexcept
+{
+    i.config_.unlend();
+}
+
+void
+session::end_edit(impl& i, cookie_jar const*) noexcept
+{
+    i.cookies_.unlend();
 }
 
 void
 session::set_auth(std::shared_ptr<auth_base> auth)
 {
-    impl_->auth_ = std::move(auth);
+    impl_->config_.write().auth = std::move(auth);
 }
 
 void
 session::set_verify(verify_config v)
 {
-    impl_->verify_ = std::move(v);
+    impl_->config_.write().verify = std::move(v);
 }
 
 void
 session::set_max_redirects(int n)
 {
-    impl_->max_redirects_ = n;
+    impl_->config_.write().max_redirects = n;
 }
 
 void
 session::set_timeout(std::chrono::milliseconds timeout)
 {
-    impl_->timeout_ = timeout;
+    impl_->config_.write().timeout = timeout;
+}
+
+void
+session::set_expect_continue(std::optional<expect_continue> cfg)
+{
+    impl_->config_.write().expect = cfg;
+}
+
+void
+session::set_limit_rate(bandwidth_limit limit)
+{
+    impl_->upload_limit_ = impl::make_bucket(limit.upload);
+    impl_->download_limit_ = impl::make_bucket(limit.download);
+}
+
+void
+session::set_request_rate(request_rate rate)
+{
+    impl_->request_rate_ = impl::make_bucket(rate);
+}
+
+void
+session::set_origin_request_rate(request_rate rate)
+{
+    impl_->origin_rate_ = rate;
+    impl_->origin_rates_.clear();
+}
+
+void
+session::set_max_in_flight(std::size_t n)
+{
+    impl_->scheduler_.set_max_in_flight(n);
+}
+
+void
+session::set_max_in_flight_per_origin(std::size_t n)
+{
+    impl_->scheduler_.set_max_in_flight_per_origin(n);
+}
+
+void
+session::set_origin_weight(urls::url_view origin, unsigned weight)
+{
+    impl_->scheduler_.set_weight(
+        impl::make_pool_key(origin), weight);
+}
+
+void
+session::set_adaptive_concurrency(
+    std::optional<adaptive_concurrency> cfg)
+{
+    // Drop learned limits; origins restart from the initial limit
+    for(auto const& [key, limit] : impl_->adaptive_limits_)
+        impl_->scheduler_.set_limit(key, 0);
+    impl_->adaptive_limits_.clear();
+    impl_->adaptive_ = std::move(cfg);
+}
+
+void
+session::set_load_balancing(load_balancing lb)
+{
+    // Statistics gathered under the old policy are dropped
+    impl_->balancing_ = lb;
+    impl_->endpoints_.clear();
+}
+
+void
+session::set_socket_options(socket_options opts)
+{
+    impl_->socket_opts_ = opts;
+}
+
+void
+session::set_origin_socket_options(
+    urls::url_view origin,
+    socket_options opts)
+{
+    impl_->origin_socket_opts_[
+        impl::make_pool_key(origin)] = opts;
+}
+
+void
+session::set_pool_options(std::optional<pool_options> opts)
+{
+    // TODO: Start run_maintenance() when enabling, and
+    // re-arm the idle timers of pooled connections when
+    // disabling
+    if(!opts)
+    {
+        impl_->maintenance_.reset();
+        return;
+    }
+    impl_->idle_timeout_ = opts->idle_timeout;
+    impl_->maintenance_.emplace(*opts,
+        static_cast<std::uint32_t>(std::random_device{}()));
+}
+
+void
+session::set_origin_min_idle(
+    urls::url_view origin,
+    std::size_t n)
+{
+    impl_->origin_min_idle_[
+        impl::make_pool_key(origin)] = n;
+}
+
+void
+session::set_source_binding(source_binding b)
+{
+    impl_->sources_.assign(b);
+}
+
+void
+session::add_resolve_override(resolve_override r)
+{
+    // Addresses chosen earlier may no longer apply
+    impl_->endpoints_.clear();
+    impl_->resolve_table_.add(std::move(r));
+}
+
+void
+session::add_connect_override(connect_override c)
+{
+    impl_->endpoints_.clear();
+    impl_->resolve_table_.add(std::move(c));
+}
+
+void
+session::clear_resolver_overrides()
+{
+    impl_->endpoints_.clear();
+    impl_->resolve_table_.clear();
+}
+
+void
+session::set_circuit_breaker(
+    std::optional<circuit_breaker_config> cfg)
+{
+    impl_->breakers_.clear();
+    impl_->breaker_cfg_ = std::move(cfg);
+}
+
+void
+session::set_hsts(bool enable)
+{
+    impl_->hsts_ = enable;
+}
+
+void
+session::set_alt_svc(bool enable)
+{
+    impl_->alt_svc_ = enable;
+
+    // Addresses chosen earlier may no longer apply
+    impl_->endpoints_.clear();
 }
 
 //----------------------------------------------------------
@@ -303,9 +1267,70 @@ capy::io_task<response<std::string>>
 session::request(http::method method, urls::url_view url, request_options opts)
 {
     // TODO: Implementation steps:
-    // 1. Validate URL (has host, valid scheme)
-    // 2. Call impl_->do_request(method, url, opts)
-    // 3. Handle errors appropriately
+    // 0. If !impl_->gate_.enter(), fail with
+    //    error::session_closed. Every exit path below calls
+    //    impl_->gate_.leave(); if it returns true, resume the
+    //    drain_waiters_
+    // 1. Validate URL (has host, valid scheme). If
+    //    opts.stop_token.stop_requested(), fail with
+    //    error::cancelled before taking any resources. Upgrade
+    //    the URL with HSTS as in do_request step 2, so that
+    //    the steps below use the https origin's key
+    // 2. permit = impl_->check_circuit(key, now); if denied, fail
+    //    with error::circuit_open without waiting or connecting.
+    //    If the request fails with deadline_exceeded or overloaded
+    //    before it is sent, hand the permit back with abandon()
+    // 3. Wait for admission:
+    //    a. ready = impl_->admit(make_pool_key(url), now)
+    //    b. If ready is in the future, push &waiter onto
+    //       admission_waiters_ and suspend; if it became the
+    //       earliest entry, wake the session timer (run_timer)
+    //    c. The session timer resumes it when it is due
+    //    d. On wake, fail with waiter.ec if it is set. Each
+    //       admission is charged when it is queued, so with a
+    //       backlog the Nth waiter sleeps about N intervals,
+    //       hours at a rate of 1/h. Whatever ends the wait
+    //       early calls admission_waiters_.cancel(&waiter) and,
+    //       if it was still queued, resumes it with waiter.ec
+    //       set; the token it reserved is not given back
+    //    e. While suspended, a std::stop_callback on
+    //       opts.stop_token posts to the session's executor,
+    //       which calls admission_waiters_.cancel(&waiter) and,
+    //       if it was still queued, resumes it with
+    //       waiter.ec = cancelled. The callback is destroyed
+    //       before step 4 registers its own
+    // 4. Take a concurrency slot:
+    //    a. If opts.deadline has passed, fail with deadline_exceeded
+    //    b. If impl_->overloaded(key), fail with error::overloaded.
+    //       If adaptive_, call adaptive_limit_for(key) first, so
+    //       that a new origin starts at the initial limit
+    //    c. If !scheduler_.acquire(key, &waiter,
+    //       priority_class(opts), deadline), suspend; the slot is
+    //       already held when it is resumed
+    //    d. The session timer calls scheduler_.expire() once
+    //       earliest_deadline() is reached, with the origin's
+    //       expected_rtt() as the lead
+    //       when adaptive limits are on; expired waiters are
+    //       resumed with waiter.ec = deadline_exceeded and hold
+    //       no slot
+    //    e. While suspended, a std::stop_callback on
+    //       opts.stop_token posts to the session's executor,
+    //       which calls scheduler_.cancel(key, &waiter) and, if
+    //       it was still queued, resumes it with
+    //       waiter.ec = cancelled; a waiter already dispatched
+    //       holds its slot and sees the stop in do_request
+    // 5. Note the start time and scheduler_.in_flight(key), then
+    //    call impl_->do_request(method, url, opts)
+    // 6. scheduler_.release(key, ready) on every exit path, then
+    //    on_complete(key, rtt, in_flight, failed, ready) where
+    //    failed means a timeout, connection error or 503; resume
+    //    the waiters in ready
+    // 7. record_circuit(key, permit, failed, now) where failed
+    //    means a resolve, connect or TLS failure, a timeout, or
+    //    a 5xx response. A cancelled request says nothing about
+    //    the origin: abandon() its permit instead, and leave it
+    //    out of on_complete's failures
+    // 8. Handle errors appropriately
     
     co_return {make_error_code(error::not_implemented), {}};
 }
@@ -389,6 +1414,32 @@ session::post(urls::url_view url, as_json_t, request_options opts)
     co_return {make_error_code(error::not_implemented), {}};
 }
 
+capy::io_task<response<json_view>>
+session::get(urls::url_view url, as_json_view_t, request_options opts)
+{
+    // TODO: Implementation steps:
+    // 1. Call get(url, opts) to get string response
+    // 2. Construct json_view from the moved body; this indexes
+    //    it without parsing
+    // 3. If !view.valid(), return error::invalid_response
+    // 4. Construct response<json_view>, copying headers, URL,
+    //    elapsed, history from string response
+
+    co_return {make_error_code(error::not_implemented), {}};
+}
+
+capy::io_task<response<json_view>>
+session::post(urls::url_view url, as_json_view_t, request_options opts)
+{
+    // TODO: Implementation steps:
+    // 1. Call post(url, opts) to get string response
+    // 2. Construct json_view from the moved body
+    // 3. If !view.valid(), return error::invalid_response
+    // 4. Construct response<json_view> with the view as body
+
+    co_return {make_error_code(error::not_implemented), {}};
+}
+
 //----------------------------------------------------------
 // HTTP request methods - streaming
 //----------------------------------------------------------
@@ -400,7 +1451,11 @@ session::get_streamed(urls::url_view url, request_options opts)
     // 1. Acquire connection
     // 2. Build and send request
     // 3. Read response headers only (not body)
-    // 4. Create buffer_source that reads body chunks on demand
+    // 4. Create buffer_source that reads body chunks on demand.
+    //    With opts.digest, each chunk read updates the digest
+    //    (headers as in read_response step 3), and the read
+    //    which reaches the end fails with digest_mismatch
+    //    instead of reporting the end of the body
     // 5. Return streamed_response with source attached
     // 6. Connection released when source is destroyed
     
@@ -415,6 +1470,77 @@ session::post_streamed(urls::url_view url, request_options opts)
     co_return {make_error_code(error::not_implemented), {}};
 }
 
+//----------------------------------------------------------
+// Pagination
+//----------------------------------------------------------
+
+paginator
+session::paginate(
+    urls::url_view url,
+    request_options opts,
+    paginate_options popts)
+{
+    // The paginator's handle keeps the state alive, so that
+    // moving or destroying this session leaves it usable
+    return paginator(std::make_shared<paginator::impl>(
+        session(impl_), url, std::move(opts), std::move(popts)));
+}
+
+//----------------------------------------------------------
+// WebSocket
+//----------------------------------------------------------
+
+capy::io_task<websocket_stream>
+session::websocket(urls::url_view url, websocket_options opts)
+{
+    // TODO: Implementation steps:
+    // 1. Map ws:// to http:// and wss:// to https://; fail with
+    //    error::invalid_scheme for any other scheme. Apply the
+    //    HSTS upgrade to the mapped URL, as request() does
+    // 2. Enter the request gate and take a concurrency slot as
+    //    request() steps 2-4 do, then acquire_connection(url,
+    //    {}).
+    //    The slot is released once the handshake completes:
+    //    an open WebSocket does not count against the origin
+    // 3. build_request(http::method::get, url, {}) for the
+    //    cookies, authentication and default headers, then
+    //    add opts.headers and:
+    //    - Upgrade: websocket, Connection: Upgrade
+    //    - Sec-WebSocket-Key: base64_encode of 16 bytes from
+    //      RAND_bytes
+    //    - Sec-WebSocket-Version: 13
+    //    - Sec-WebSocket-Protocol: opts.protocols joined by
+    //      ", ", if any
+    //    - Sec-WebSocket-Extensions: detail::deflate_offer,
+    //      when BOOST_BURL_HAS_ZLIB and opts.permessage_deflate,
+    //      and only if a permessage_deflate constructed with
+    //      the offered parameters is valid(); if zlib cannot
+    //      start, compression is not offered
+    // 4. send_request, then read_response headers only. Store
+    //    Set-Cookie headers in the jar, and follow redirects
+    //    the way do_request does for a GET
+    // 5. Anything but 101 fails with websocket_handshake_failed,
+    //    as does:
+    //    - Upgrade not "websocket" or Connection without
+    //      "upgrade", compared case-insensitively
+    //    - Sec-WebSocket-Accept != websocket_accept(key)
+    //    - a Sec-WebSocket-Protocol that was not offered
+    //    - parse_deflate_response() failing, or accepting
+    //      deflate when it was not offered
+    //    The connection is closed, not pooled, on failure
+    // 6. Construct websocket_stream::impl with the connection
+    //    and opts; set protocol, and if deflate was accepted,
+    //    compressed = true, emplace deflate with the params and
+    //    construct sequence with true. Should that deflate not
+    //    be valid(), close the connection with 1011 and fail
+    //    with websocket_handshake_failed. Bytes read past the
+    //    response headers go into read_buf
+    // 7. Disarm the connection's timer; it never returns to
+    //    the pool. Return websocket_stream(std::move(impl))
+
+    co_return {make_error_code(error::not_implemented), {}};
+}
+
 //----------------------------------------------------------
 // Connection management
 //----------------------------------------------------------
@@ -426,7 +1552,163 @@ session::close()
     // 1. Close all pooled connections
     // 2. Clear connection pools
     
-    impl_->pools_.clear();
+    impl_->gate_.close();
+    impl_->maintenance_.reset();
+    impl_->take_idle();
+}
+
+std::error_code
+session::save_state(std::string const& path) const
+{
+    auto const now = std::chrono::steady_clock::now();
+    auto const wall = std::chrono::system_clock::now();
+    auto to_wall = [&](std::chrono::steady_clock::time_point t)
+    {
+        return wall + std::chrono::duration_cast<
+            std::chrono::system_clock::duration>(t - now);
+    };
+
+    auto const& sh = *impl_->shared_;
+    detail::warm_state ws;
+    sh.dns.for_each(now,
+        [&](std::string const& host,
+            std::vector<std::string> const& addresses,
+            std::chrono::steady_clock::time_point expires)
+        {
+            ws.dns.push_back({host, addresses, to_wall(expires)});
+        });
+    sh.tls_sessions.for_each(now,
+        [&](detail::pool_key const& key,
+            std::string const& der,
+            std::chrono::steady_clock::time_point expires)
+        {
+            ws.tls_sessions.push_back(
+                {key.host, key.port, key.settings, to_wall(expires), der});
+        });
+    for(auto const& c : *impl_->cookies_)
+        if(!c.is_expired())
+            ws.cookies.push_back(c);
+    for(auto const& [key, flags] : sh.capabilities)
+        ws.origins.push_back({key.host, key.port, key.https, flags});
+
+    return replace_file(path, detail::encode_warm_state(ws));
+}
+
+std::error_code
+session::load_state(std::string const& path)
+{
+    std::string data;
+    auto ec = read_file(path, data);
+    if(ec)
+        return ec;
+
+    detail::warm_state ws;
+    ec = detail::decode_warm_state(data, ws);
+    if(ec)
+        return ec;
+
+    auto const now = std::chrono::steady_clock::now();
+    auto const wall = std::chrono::system_clock::now();
+    auto to_steady = [&](std::chrono::system_clock::time_point t)
+    {
+        return now + std::chrono::duration_cast<
+            std::chrono::steady_clock::duration>(t - wall);
+    };
+
+    auto& sh = *impl_->shared_;
+    for(auto& e : ws.dns)
+        if(e.expires > wall)
+            sh.dns.put(e.host, std::move(e.addresses),
+                to_steady(e.expires));
+    for(auto& e : ws.tls_sessions)
+        if(e.expires > wall)
+            sh.tls_sessions.put(
+                {e.host, e.port, true, std::move(e.settings), {}},
+                std::move(e.session), to_steady(e.expires));
+    if(!ws.cookies.empty())
+    {
+        auto& jar = impl_->cookies_.write();
+        for(auto& c : ws.cookies)
+            if(!c.is_expired())
+                jar.set(std::move(c));
+    }
+    for(auto const& e : ws.origins)
+        sh.capabilities[{e.host, e.port, e.https, {}, {}}] |= e.flags;
+    return {};
+}
+
+std::error_code
+session::load_hsts(std::string const& path)
+{
+    std::string data;
+    auto ec = read_file(path, data);
+    if(ec)
+        return ec;
+    impl_->shared_->hsts.load(
+        data, std::chrono::system_clock::now());
+    return {};
+}
+
+std::error_code
+session::save_hsts(std::string const& path) const
+{
+    return replace_file(path, impl_->shared_->hsts.save(
+        std::chrono::system_clock::now()));
+}
+
+std::error_code
+session::load_alt_svc(std::string const& path)
+{
+    std::string data;
+    auto ec = read_file(path, data);
+    if(ec)
+        return ec;
+    impl_->shared_->alt_svc.load(
+        data, std::chrono::system_clock::now());
+    impl_->endpoints_.clear();
+    return {};
+}
+
+std::error_code
+session::save_alt_svc(std::string const& path) const
+{
+    return replace_file(path, impl_->shared_->alt_svc.save(
+        std::chrono::system_clock::now()));
+}
+
+capy::io_task<>
+session::shutdown(std::chrono::steady_clock::time_point deadline)
+{
+    // TODO: Implementation steps:
+    // 1. impl_->gate_.close(); from now on request() fails at
+    //    once with error::session_closed. Stop the maintenance
+    //    task so it opens no more connections
+    // 2. Close the idle connections, all at the same time:
+    //    start close_connection() for each of take_idle() and
+    //    await them together. With thousands of connections
+    //    the close_notify round trips overlap instead of
+    //    adding up
+    // 3. Connections released while draining are closed the
+    //    same way instead of being pooled
+    // 4. Unless the gate is closed, push this coroutine onto
+    //    drain_waiters_ and suspend. It is resumed by the
+    //    request whose gate_.leave() returns true, or by the
+    //    session timer at the deadline
+    // 5. At the deadline, cancel what is left as a stop token
+    //    would: queued waiters are removed with
+    //    scheduler_.clear_pending(), and the admission and
+    //    bandwidth waits with admission_waiters_.pop_all(),
+    //    and each is resumed with ec = cancelled. The I/O of
+    //    each connection in use is cancelled, so those
+    //    requests fail with error::cancelled and their
+    //    connections are closed
+    // 6. Wait for the last request to leave, then for step 2
+    //    and any closes from step 3 to complete
+    
+    impl_->gate_.close();
+    impl_->maintenance_.reset();
+    (void)deadline;
+    co_return {make_error_code(error::not_implemented)};
 }
 
 } // namespace burl
@@ -0,0 +1,46 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/burl/share.hpp>
+
+#include "src/detail/shared_state.hpp"
+
+namespace boost {
+namespace burl {
+
+share::share(
+    corosio::io_context& ioc,
+    corosio::tls::context& tls_ctx)
+    : state_(std::make_shared<detail::shared_state>(ioc, tls_ctx))
+{
+}
+
+corosio::io_context&
+share::get_io_context() const noexcept
+{
+    return state_->ioc;
+}
+
+corosio::tls::context&
+share::tls_context() const noexcept
+{
+    return state_->tls_ctx;
+}
+
+std::size_t
+share::idle_connections() const noexcept
+{
+    std::size_t n = 0;
+    for(auto const& [key, pool] : state_->pools)
+        n += pool.size();
+    return n;
+}
+
+} // namespace burl
+} // namespace boost
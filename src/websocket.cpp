@@ -0,0 +1,165 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/burl/websocket.hpp>
+
+#include "src/detail/websocket_impl.hpp"
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+std::string const empty_string;
+
+} // namespace
+
+websocket_stream::websocket_stream() noexcept = default;
+
+websocket_stream::websocket_stream(std::unique_ptr<impl> p) noexcept
+    : impl_(std::move(p))
+{
+}
+
+websocket_stream::~websocket_stream() = default;
+
+websocket_stream::websocket_stream(websocket_stream&&) noexcept = default;
+
+websocket_stream&
+websocket_stream::operator=(websocket_stream&&) noexcept = default;
+
+bool
+websocket_stream::is_open() const noexcept
+{
+    return impl_ && impl_->st == impl::state::open;
+}
+
+std::string const&
+websocket_stream::protocol() const noexcept
+{
+    return impl_ ? impl_->protocol : empty_string;
+}
+
+bool
+websocket_stream::compressed() const noexcept
+{
+    return impl_ && impl_->compressed;
+}
+
+std::uint16_t
+websocket_stream::close_code() const noexcept
+{
+    return impl_ ? impl_->close_code : 0;
+}
+
+std::string const&
+websocket_stream::close_reason() const noexcept
+{
+    return impl_ ? impl_->close_reason : empty_string;
+}
+
+capy::io_task<websocket_message>
+websocket_stream::read()
+{
+    // TODO: Implementation steps:
+    // 1. Fail with connection_closed if !is_open()
+    // 2. Loop, reading into impl_->read_buf as needed:
+    //    a. parse_frame_header; on bad, fail (step 4) with 1002.
+    //       sequence.on_header() false is also 1002
+    //    b. Read the payload; a text or binary frame whose
+    //       length would take message past opts.max_message_size
+    //       fails with 1009 before it is read. A compressed
+    //       message is limited after decompression instead
+    //    c. Data frames append to message. For an uncompressed
+    //       text message, utf8.write() each payload as it
+    //       arrives so bad text fails early, with 1007
+    //    d. ping: send a pong with the same payload, masked
+    //       with next_key(), then keep reading. If next_key()
+    //       fails, close the connection and fail with
+    //       std::errc::resource_unavailable_try_again
+    //    e. pong: ignore
+    //    f. close: parse_close_payload (1002 if it fails), set
+    //       close_code and close_reason, echo the code in a
+    //       close frame unless state is already closing, close
+    //       the connection and fail with connection_closed
+    // 3. On the final frame of a message:
+    //    a. If compressed, deflate->decompress(message, out,
+    //       opts.max_message_size); failure is 1009 if the
+    //       limit was hit and 1007 otherwise, and text is
+    //       validated after
+    //    b. utf8.finish() for text; reset utf8 and message
+    //    c. Return websocket_message{data, op == binary}
+    // 4. On a protocol failure, send a close frame with the
+    //    code, close the connection, set state closed and fail
+    //    with websocket_protocol_error
+    // 5. If opts.ping_interval is nonzero, a read that has
+    //    waited that long sends a ping; a second interval with
+    //    nothing received fails with timeout
+
+    co_return {make_error_code(error::not_implemented), {}};
+}
+
+capy::io_task<>
+websocket_stream::write(std::string_view data, bool binary)
+{
+    // TODO: Implementation steps:
+    // 1. Fail with connection_closed if !is_open()
+    // 2. If compressed and data.size() >= opts.compress_threshold,
+    //    deflate->compress(data, payload) and set rsv1; if the
+    //    result is not smaller, send data as is instead. A
+    //    message sent uncompressed does not touch the window
+    // 3. fragmenter f(op, rsv1, payload.size(), opts.fragment_size)
+    // 4. Until f.done(): h = f.next(key) after
+    //    impl_->next_key(key); every frame gets a fresh key. If
+    //    next_key() fails, fail with
+    //    std::errc::resource_unavailable_try_again before
+    //    writing anything of the frame. Copy the frame's payload into
+    //    the write buffer after its header and mask_bytes() it
+    //    there, never in the caller's data, then write header
+    //    and payload in one gathered write
+    // 5. On a write error set state closed and return it
+
+    co_return {make_error_code(error::not_implemented)};
+}
+
+capy::io_task<>
+websocket_stream::ping(std::string_view payload)
+{
+    // TODO: Implementation steps:
+    // 1. Fail with connection_closed if !is_open(), and with
+    //    std::errc::invalid_argument if payload is over
+    //    detail::max_control_payload
+    // 2. Write one masked ping frame with next_key(); if it
+    //    fails, fail with std::errc::resource_unavailable_try_again
+
+    co_return {make_error_code(error::not_implemented)};
+}
+
+capy::io_task<>
+websocket_stream::close(std::uint16_t code, std::string_view reason)
+{
+    // TODO: Implementation steps:
+    // 1. If not open, return success
+    // 2. Fail with std::errc::invalid_argument unless
+    //    valid_close_code(code)
+    // 3. Send a masked close frame holding
+    //    make_close_payload(code, reason); set state closing.
+    //    If next_key() fails, send nothing, do step 5 and fail
+    //    with std::errc::resource_unavailable_try_again
+    // 4. Read frames, discarding data, until the server's close
+    //    frame arrives or one second passes; record its code
+    //    and reason
+    // 5. Shut down TLS if any, close the socket, set state
+    //    closed
+
+    co_return {make_error_code(error::not_implemented)};
+}
+
+} // namespace burl
+} // namespace boost
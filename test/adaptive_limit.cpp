@@ -0,0 +1,131 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/adaptive_limit.hpp"
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using detail::adaptive_limit;
+using namespace std::chrono_literals;
+
+adaptive_concurrency
+make_config(adaptive_concurrency::algorithm algo)
+{
+    adaptive_concurrency cfg;
+    cfg.algo = algo;
+    cfg.initial_limit = 10;
+    cfg.min_limit = 2;
+    cfg.max_limit = 100;
+    return cfg;
+}
+
+void test_initial_limit()
+{
+    auto cfg = make_config(adaptive_concurrency::algorithm::aimd);
+    adaptive_limit l(cfg);
+    BOOST_TEST(l.limit() == 10);
+    BOOST_TEST(l.expected_rtt() == 0ns);
+
+    // The initial limit is clamped
+    cfg.initial_limit = 1000;
+    adaptive_limit l2(cfg);
+    BOOST_TEST(l2.limit() == 100);
+}
+
+void test_aimd_grows_when_busy()
+{
+    adaptive_limit l(make_config(
+        adaptive_concurrency::algorithm::aimd));
+    for(int i = 0; i < 5; ++i)
+        l.on_sample(10ms, l.limit(), false);
+    BOOST_TEST(l.limit() == 15);
+}
+
+void test_aimd_holds_when_idle()
+{
+    adaptive_limit l(make_config(
+        adaptive_concurrency::algorithm::aimd));
+    for(int i = 0; i < 5; ++i)
+        l.on_sample(10ms, 1, false);
+    BOOST_TEST(l.limit() == 10);
+}
+
+void test_aimd_backs_off()
+{
+    adaptive_limit l(make_config(
+        adaptive_concurrency::algorithm::aimd));
+    l.on_sample(10ms, 10, true);
+    BOOST_TEST(l.limit() == 9);
+
+    // Never below the minimum
+    for(int i = 0; i < 100; ++i)
+        l.on_sample(10ms, 10, true);
+    BOOST_TEST(l.limit() == 2);
+}
+
+void test_gradient_grows_at_steady_rtt()
+{
+    adaptive_limit l(make_config(
+        adaptive_concurrency::algorithm::gradient));
+    for(int i = 0; i < 50; ++i)
+        l.on_sample(10ms, l.limit(), false);
+    BOOST_TEST(l.limit() > 10);
+    BOOST_TEST(l.expected_rtt() == 10ms);
+}
+
+void test_gradient_shrinks_on_latency()
+{
+    adaptive_limit l(make_config(
+        adaptive_concurrency::algorithm::gradient));
+    for(int i = 0; i < 50; ++i)
+        l.on_sample(10ms, l.limit(), false);
+    auto const before = l.limit();
+
+    // Injected latency: RTT quadruples under load
+    for(int i = 0; i < 20; ++i)
+        l.on_sample(40ms, l.limit(), false);
+    BOOST_TEST(l.limit() < before);
+}
+
+void test_gradient_shrinks_on_failure()
+{
+    adaptive_limit l(make_config(
+        adaptive_concurrency::algorithm::gradient));
+    for(int i = 0; i < 10; ++i)
+        l.on_sample(10ms, l.limit(), false);
+    auto const before = l.limit();
+    for(int i = 0; i < 10; ++i)
+        l.on_sample(10ms, l.limit(), true);
+    BOOST_TEST(l.limit() < before);
+}
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_initial_limit();
+    test_aimd_grows_when_busy();
+    test_aimd_holds_when_idle();
+    test_aimd_backs_off();
+    test_gradient_grows_at_steady_rtt();
+    test_gradient_shrinks_on_latency();
+    test_gradient_shrinks_on_failure();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,173 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/alt_svc_cache.hpp"
+
+#include <string>
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using cache = detail::alt_svc_cache;
+using namespace std::chrono_literals;
+
+// 2025-01-01 00:00:00 UTC
+cache::time_point const t0{std::chrono::seconds(1735689600)};
+
+unsigned const h1h2 = cache::proto_h1 | cache::proto_h2;
+
+void test_update()
+{
+    cache c;
+    bool valid = c.update("Example.com", 443,
+        "h3=\":443\"; ma=60, h2=\"alt.example.com:8443\"; ma=120, "
+        "http%2F1.1=\":8080\"",
+        t0);
+    BOOST_TEST(valid);
+    BOOST_TEST(c.size() == 3);
+
+    // h3 is skipped when the caller cannot speak it
+    auto a = c.find("example.com", 443, h1h2, t0);
+    BOOST_TEST(a);
+    BOOST_TEST(a->proto == cache::proto_h2);
+    BOOST_TEST(a->host == "alt.example.com");
+    BOOST_TEST(a->port == 8443);
+
+    a = c.find("example.com", 443, cache::proto_h3, t0);
+    BOOST_TEST(a && a->host == "example.com" && a->port == 443);
+
+    // Expiry follows ma, 24 hours by default
+    a = c.find("example.com", 443, h1h2, t0 + 2min);
+    BOOST_TEST(a && a->proto == cache::proto_h1 && a->port == 8080);
+    BOOST_TEST(!c.find("example.com", 443, h1h2, t0 + 24h));
+
+    // Other origins are not affected
+    BOOST_TEST(!c.find("example.com", 8443, h1h2, t0));
+
+    // A new header replaces every alternative
+    valid = c.update("example.com", 443, "h2=\"b.test:1\"", t0);
+    BOOST_TEST(valid);
+    BOOST_TEST(c.size() == 1);
+    BOOST_TEST(c.find("example.com", 443, h1h2, t0)->host == "b.test");
+
+    valid = c.update("example.com", 443, "clear", t0);
+    BOOST_TEST(valid);
+    BOOST_TEST(c.size() == 0);
+}
+
+void test_invalid()
+{
+    cache c;
+    bool valid = c.update("a.test", 443, "h2=\":8443\"", t0);
+    BOOST_TEST(valid);
+
+    // Invalid headers change nothing
+    valid = c.update("a.test", 443, "", t0);
+    BOOST_TEST(!valid);
+    valid = c.update("a.test", 443, "h2=:8443", t0);
+    BOOST_TEST(!valid);
+    valid = c.update("a.test", 443, "h2=\"a.test\"", t0);
+    BOOST_TEST(!valid);
+    valid = c.update("a.test", 443, "h2=\":0\"", t0);
+    BOOST_TEST(!valid);
+    valid = c.update("a.test", 443, "h2=\":443\"; ma=x", t0);
+    BOOST_TEST(!valid);
+    valid = c.update("a.test", 443, "h%2=\":443\"", t0);
+    BOOST_TEST(!valid);
+    BOOST_TEST(c.size() == 1);
+
+    // Unknown protocols and parameters are ignored
+    valid = c.update("a.test", 443,
+        "foo=\":1\", h2=\":2\"; persist=1; bar=baz", t0);
+    BOOST_TEST(valid);
+    BOOST_TEST(c.size() == 1);
+    auto a = c.find("a.test", 443, h1h2, t0);
+    BOOST_TEST(a && a->port == 2 && a->persist);
+
+    // An IPv6 alternative keeps its brackets
+    valid = c.update("a.test", 443, "h2=\"[::1]:8443\"", t0);
+    BOOST_TEST(valid);
+    BOOST_TEST(c.find("a.test", 443, h1h2, t0)->host == "[::1]");
+}
+
+void test_remove()
+{
+    cache c;
+    c.update("a.test", 443, "h2=\"x.test:1\", h2=\"y.test:2\"", t0);
+    auto const first = *c.find("a.test", 443, h1h2, t0);
+    bool removed = c.remove("a.test", 443, first);
+    BOOST_TEST(removed);
+    removed = c.remove("a.test", 443, first);
+    BOOST_TEST(!removed);
+
+    // The next alternative is used as the fallback
+    BOOST_TEST(c.find("a.test", 443, h1h2, t0)->host == "y.test");
+    removed = c.remove("a.test", 443, *c.find("a.test", 443, h1h2, t0));
+    BOOST_TEST(removed);
+    BOOST_TEST(!c.find("a.test", 443, h1h2, t0));
+    BOOST_TEST(c.size() == 0);
+}
+
+void test_file()
+{
+    cache c;
+    auto const n = c.load(
+        "# comment\n"
+        "\n"
+        "h2 example.com 443 h2 alt.example.com 8443 \"20250102 03:04:05\" 1 0\n"
+        "h1 a.test 443 h1 a.test 8080 \"unlimited\" 0 0\r\n"
+        "h2 old.test 443 h2 old.test 8443 \"20240101 00:00:00\" 0 0\n"
+        "h2 bad.test 443 h9 bad.test 8443 \"20250102 00:00:00\" 0 0\n"
+        "h2 bad.test 443 h2 bad.test 8443 20250102 0 0\n"
+        "h2 bad.test 443 h2\n",
+        t0);
+    BOOST_TEST(n == 2);
+    auto a = c.find("example.com", 443, h1h2, t0);
+    BOOST_TEST(a && a->host == "alt.example.com" && a->persist);
+    BOOST_TEST(!c.find("example.com", 443, h1h2, t0 + 28h));
+    BOOST_TEST(c.find("a.test", 443, h1h2, t0 + 24h * 365 * 100));
+    BOOST_TEST(!c.find("old.test", 443, h1h2, t0));
+
+    auto const text = c.save(t0);
+    BOOST_TEST(text.find(
+        "h1 example.com 443 h2 alt.example.com 8443 "
+        "\"20250102 03:04:05\" 1 0\n") != std::string::npos);
+
+    // Saving and loading round trips
+    cache c2;
+    auto const loaded = c2.load(text, t0);
+    BOOST_TEST(loaded == 2);
+    BOOST_TEST(c2.save(t0) == text);
+
+    // Expired entries are left out
+    BOOST_TEST(c.save(t0 + 48h).find("example.com") == std::string::npos);
+    c.prune(t0 + 48h);
+    BOOST_TEST(c.size() == 1);
+}
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_update();
+    test_invalid();
+    test_remove();
+    test_file();
+
+    return boost::report_errors();
+}
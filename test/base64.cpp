@@ -0,0 +1,67 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/base64.hpp"
+
+#include <string>
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using namespace detail;
+
+void test_encode()
+{
+    BOOST_TEST(base64_encode("", 0) == "");
+    BOOST_TEST(base64_encode("f", 1) == "Zg==");
+    BOOST_TEST(base64_encode("fo", 2) == "Zm8=");
+    BOOST_TEST(base64_encode("foo", 3) == "Zm9v");
+    BOOST_TEST(base64_encode("foobar", 6) == "Zm9vYmFy");
+}
+
+void test_decode()
+{
+    BOOST_TEST(base64_decode("") == "");
+    BOOST_TEST(base64_decode("Zg==") == "f");
+    BOOST_TEST(base64_decode("Zm8=") == "fo");
+    BOOST_TEST(base64_decode("Zm9vYmFy") == "foobar");
+
+    // Padding is optional
+    BOOST_TEST(base64_decode("Zg") == "f");
+    BOOST_TEST(base64_decode("Zm8") == "fo");
+
+    BOOST_TEST(!base64_decode("Z"));
+    BOOST_TEST(!base64_decode("Zm9v!"));
+    BOOST_TEST(!base64_decode("Zm 9v"));
+
+    // Round trip over every byte value
+    std::string all;
+    for(int i = 0; i < 256; ++i)
+        all.push_back(static_cast<char>(i));
+    BOOST_TEST(base64_decode(base64_encode(all.data(), all.size())) == all);
+}
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_encode();
+    test_decode();
+
+    return boost::report_errors();
+}
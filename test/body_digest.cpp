@@ -0,0 +1,155 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/body_digest.hpp"
+
+#include <algorithm>
+#include <string>
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using namespace detail;
+
+std::string
+digest_of(digest_kind k, std::string const& s, std::size_t step)
+{
+    body_digest d(k);
+    for(std::size_t i = 0; i < s.size(); i += step)
+        d.update(s.data() + i, (std::min)(step, s.size() - i));
+    return d.finish();
+}
+
+void test_crc32c()
+{
+    // The check value, and results which do not depend on
+    // how the input was split or which code path ran
+    BOOST_TEST(crc32c(0, "123456789", 9) == 0xe3069283);
+    BOOST_TEST(crc32c(crc32c(0, "1234", 4), "56789", 5) == 0xe3069283);
+    BOOST_TEST(crc32c(0, "", 0) == 0);
+
+    std::string big(1000, '\0');
+    for(std::size_t i = 0; i < big.size(); ++i)
+        big[i] = static_cast<char>(i * 31 + 7);
+    auto const* p = reinterpret_cast<unsigned char const*>(big.data());
+    BOOST_TEST(~crc32c_sw(~0u, p + 3, 997) == crc32c(0, p + 3, 997));
+}
+
+void test_digest()
+{
+    auto const hex = [](std::string const& s)
+    {
+        return *parse_hex_digest(s);
+    };
+
+    BOOST_TEST(digest_of(digest_kind::sha256, "abc", 1) == hex(
+        "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"));
+    BOOST_TEST(digest_of(digest_kind::md5, "abc", 2) ==
+        hex("900150983cd24fb0d6963f7d28e17f72"));
+    BOOST_TEST(digest_of(digest_kind::crc32c, "123456789", 4) ==
+        hex("e3069283"));
+
+    std::string const big(100000, 'x');
+    BOOST_TEST(digest_of(digest_kind::sha256, big, 7) ==
+        digest_of(digest_kind::sha256, big, big.size()));
+}
+
+void test_parse_hex()
+{
+    BOOST_TEST(parse_hex_digest("00ffAb") == std::string("\x00\xff\xab", 3));
+    BOOST_TEST(parse_hex_digest("") == "");
+    BOOST_TEST(!parse_hex_digest("abc"));
+    BOOST_TEST(!parse_hex_digest("zz"));
+}
+
+void test_headers()
+{
+    // sha-256 of "hello world"
+    std::string const b64 = "uU0nuZNNPgilLlLX2n2r+sSE7+N6U4DukIj3rOLvzek=";
+    auto const sha = *base64_decode(b64);
+
+    BOOST_TEST(find_header_digest(digest_kind::sha256, "Content-Digest",
+        "sha-512=:AAAA:, sha-256=:" + b64 + ":") == sha);
+    BOOST_TEST(find_header_digest(digest_kind::sha256, "repr-digest",
+        "sha-256=:" + b64 + ":") == sha);
+    BOOST_TEST(find_header_digest(digest_kind::sha256, "Digest",
+        "MD5=XrY7u+Ae7tCTyyK7j1rNww==,SHA-256=" + b64) == sha);
+
+    // Structured values need their colons
+    BOOST_TEST(!find_header_digest(digest_kind::sha256, "Content-Digest",
+        "sha-256=" + b64));
+
+    BOOST_TEST(find_header_digest(digest_kind::md5, "Content-MD5",
+        " XrY7u+Ae7tCTyyK7j1rNww== ") ==
+        *parse_hex_digest("5eb63bbbe01eeed093cb22bb8f5acdc3"));
+    BOOST_TEST(!find_header_digest(digest_kind::sha256, "Content-MD5",
+        "XrY7u+Ae7tCTyyK7j1rNww=="));
+
+    BOOST_TEST(find_header_digest(digest_kind::crc32c, "x-goog-hash",
+        "crc32c=4waSgw==,md5=XrY7u+Ae7tCTyyK7j1rNww==") ==
+        *parse_hex_digest("e3069283"));
+
+    BOOST_TEST(!find_header_digest(digest_kind::sha256, "ETag", b64));
+    BOOST_TEST(!find_header_digest(digest_kind::crc32c, "Digest",
+        "SHA-256=" + b64));
+}
+
+void test_check()
+{
+    std::string const body = "hello world";
+    auto const run = [&](digest_check_state& c)
+    {
+        c.update(body.data(), 5);
+        c.update(body.data() + 5, body.size() - 5);
+        return c.verify();
+    };
+
+    digest_check_state ok(digest_kind::md5, true);
+    ok.expect(*parse_hex_digest("5eb63bbbe01eeed093cb22bb8f5acdc3"));
+    ok.on_header("Content-MD5", "XrY7u+Ae7tCTyyK7j1rNww==");
+    bool verified = run(ok);
+    BOOST_TEST(verified);
+
+    // One wrong value fails the check
+    digest_check_state bad(digest_kind::md5, true);
+    bad.on_header("Content-MD5", "XrY7u+Ae7tCTyyK7j1rNww==");
+    bad.expect(*parse_hex_digest("00000000000000000000000000000000"));
+    verified = run(bad);
+    BOOST_TEST(!verified);
+
+    // With nothing to compare, it depends on required
+    digest_check_state none(digest_kind::sha256, true);
+    verified = run(none);
+    BOOST_TEST(!verified);
+    digest_check_state optional(digest_kind::sha256, false);
+    verified = run(optional);
+    BOOST_TEST(verified);
+}
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_crc32c();
+    test_digest();
+    test_parse_hex();
+    test_headers();
+    test_check();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,222 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/circuit_breaker.hpp"
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using detail::circuit_breaker;
+using state = circuit_breaker::state;
+using admission = circuit_breaker::admission;
+using namespace std::chrono_literals;
+
+circuit_breaker::time_point const t0{std::chrono::seconds(1000)};
+
+circuit_breaker_config
+make_config()
+{
+    circuit_breaker_config cfg;
+    cfg.failure_ratio = 0.5;
+    cfg.minimum_requests = 4;
+    cfg.window = 10s;
+    cfg.open_duration = 5s;
+    cfg.half_open_probes = 2;
+    return cfg;
+}
+
+// Run n requests with the given outcome
+void
+run(circuit_breaker& cb, int n, bool failed,
+    circuit_breaker::time_point now)
+{
+    for(int i = 0; i < n; ++i)
+    {
+        auto p = cb.allow(now);
+        BOOST_TEST(p.kind == admission::allowed);
+        cb.on_result(p, failed, now);
+    }
+}
+
+void test_stays_closed()
+{
+    circuit_breaker cb(make_config());
+    run(cb, 10, false, t0);
+    run(cb, 3, true, t0);
+    BOOST_TEST(cb.current() == state::closed);
+}
+
+void test_minimum_requests()
+{
+    circuit_breaker cb(make_config());
+
+    // Every request failed, but too few to judge
+    run(cb, 3, true, t0);
+    BOOST_TEST(cb.current() == state::closed);
+
+    run(cb, 1, true, t0);
+    BOOST_TEST(cb.current() == state::open);
+    auto p = cb.allow(t0 + 1s);
+    BOOST_TEST(p.kind == admission::denied);
+}
+
+void test_window_expires()
+{
+    circuit_breaker cb(make_config());
+    run(cb, 3, true, t0);
+
+    // The old failures have left the window
+    run(cb, 3, false, t0 + 20s);
+    run(cb, 1, true, t0 + 20s);
+    BOOST_TEST(cb.current() == state::closed);
+}
+
+void test_half_open_recovers()
+{
+    circuit_breaker cb(make_config());
+    run(cb, 4, true, t0);
+    auto p = cb.allow(t0 + 4s);
+    BOOST_TEST(p.kind == admission::denied);
+
+    // Limited probes once the open period ends
+    auto const t1 = t0 + 5s;
+    auto p1 = cb.allow(t1);
+    auto p2 = cb.allow(t1);
+    BOOST_TEST(p1.kind == admission::probe);
+    BOOST_TEST(p2.kind == admission::probe);
+    p = cb.allow(t1);
+    BOOST_TEST(p.kind == admission::denied);
+    BOOST_TEST(cb.current() == state::half_open);
+
+    cb.on_result(p1, false, t1);
+    BOOST_TEST(cb.current() == state::half_open);
+    cb.on_result(p2, false, t1);
+    BOOST_TEST(cb.current() == state::closed);
+
+    // History was reset
+    run(cb, 3, true, t1);
+    BOOST_TEST(cb.current() == state::closed);
+}
+
+void test_half_open_failure_reopens()
+{
+    circuit_breaker cb(make_config());
+    run(cb, 4, true, t0);
+
+    auto const t1 = t0 + 5s;
+    auto p = cb.allow(t1);
+    BOOST_TEST(p.kind == admission::probe);
+    cb.on_result(p, true, t1);
+    BOOST_TEST(cb.current() == state::open);
+    p = cb.allow(t1 + 4s);
+    BOOST_TEST(p.kind == admission::denied);
+    p = cb.allow(t1 + 5s);
+    BOOST_TEST(p.kind == admission::probe);
+}
+
+void test_abandon_probe()
+{
+    circuit_breaker cb(make_config());
+    run(cb, 4, true, t0);
+
+    auto const t1 = t0 + 5s;
+    auto p1 = cb.allow(t1);
+    auto p2 = cb.allow(t1);
+    auto p = cb.allow(t1);
+    BOOST_TEST(p.kind == admission::denied);
+
+    // A probe which never went out frees its slot
+    cb.abandon(p1);
+    BOOST_TEST(cb.current() == state::half_open);
+    auto p3 = cb.allow(t1);
+    BOOST_TEST(p3.kind == admission::probe);
+    cb.on_result(p2, false, t1);
+    cb.on_result(p3, false, t1);
+    BOOST_TEST(cb.current() == state::closed);
+}
+
+void test_stale_results_ignored()
+{
+    circuit_breaker cb(make_config());
+
+    // Started while closed, finishes after the circuit opened
+    auto slow = cb.allow(t0);
+    BOOST_TEST(slow.kind == admission::allowed);
+    run(cb, 4, true, t0);
+    BOOST_TEST(cb.current() == state::open);
+
+    auto const t1 = t0 + 5s;
+    auto p = cb.allow(t1);
+    BOOST_TEST(p.kind == admission::probe);
+
+    // It neither counts as a probe nor reopens the circuit
+    cb.on_result(slow, true, t1);
+    BOOST_TEST(cb.current() == state::half_open);
+    cb.on_result(p, false, t1);
+    p = cb.allow(t1);
+    BOOST_TEST(p.kind == admission::probe);
+}
+
+void test_stale_probe_ignored()
+{
+    circuit_breaker cb(make_config());
+    run(cb, 4, true, t0);
+
+    // A probe from the first half-open period is still out
+    // when a second probe reopens the circuit
+    auto const t1 = t0 + 5s;
+    auto old = cb.allow(t1);
+    auto p = cb.allow(t1);
+    BOOST_TEST(old.kind == admission::probe);
+    cb.on_result(p, true, t1);
+    BOOST_TEST(cb.current() == state::open);
+
+    // Its success and abandon count for nothing in the next
+    // period, and do not free a slot there
+    auto const t2 = t1 + 5s;
+    auto q1 = cb.allow(t2);
+    auto q2 = cb.allow(t2);
+    BOOST_TEST(q1.kind == admission::probe);
+    BOOST_TEST(q2.kind == admission::probe);
+    cb.on_result(old, false, t2);
+    cb.abandon(old);
+    BOOST_TEST(cb.current() == state::half_open);
+    p = cb.allow(t2);
+    BOOST_TEST(p.kind == admission::denied);
+
+    cb.on_result(q1, false, t2);
+    BOOST_TEST(cb.current() == state::half_open);
+    cb.on_result(q2, false, t2);
+    BOOST_TEST(cb.current() == state::closed);
+}
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_stays_closed();
+    test_minimum_requests();
+    test_window_expires();
+    test_half_open_recovers();
+    test_half_open_failure_reopens();
+    test_abandon_probe();
+    test_stale_results_ignored();
+    test_stale_probe_ignored();
+
+    return boost::report_errors();
+}
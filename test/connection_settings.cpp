@@ -0,0 +1,106 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/connection_settings.hpp"
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using detail::connection_settings;
+using target = detail::resolve_table::target;
+
+std::string
+settings(
+    bool https,
+    verify_config const& v = {},
+    target const& t = {"example.com", 443},
+    std::vector<std::string> const* pinned = nullptr,
+    detail::alt_svc_cache::alternative const* alt = nullptr,
+    socket_options const& so = {})
+{
+    return connection_settings(https, v, t, pinned, alt, so);
+}
+
+void test_verify()
+{
+    verify_config insecure;
+    insecure.verify_peer = false;
+    verify_config ca;
+    ca.ca_file = "ca.pem";
+
+    BOOST_TEST(settings(true) == settings(true));
+    BOOST_TEST(settings(true) != settings(true, insecure));
+    BOOST_TEST(settings(true) != settings(true, ca));
+
+    // Plain connections do not verify
+    BOOST_TEST(settings(false) == settings(false, insecure));
+}
+
+void test_route()
+{
+    BOOST_TEST(settings(true) != settings(true, {}, {"other.com", 443}));
+    BOOST_TEST(settings(true) != settings(true, {}, {"example.com", 8443}));
+
+    // Pinned addresses, and none, all differ
+    std::vector<std::string> const none;
+    std::vector<std::string> const a{"10.0.0.1"};
+    std::vector<std::string> const b{"10.0.0.2"};
+    BOOST_TEST(settings(true, {}, {"example.com", 443}, &none) !=
+        settings(true));
+    BOOST_TEST(settings(true, {}, {"example.com", 443}, &a) !=
+        settings(true, {}, {"example.com", 443}, &b));
+
+    detail::alt_svc_cache::alternative alt;
+    alt.proto = detail::alt_svc_cache::proto_h2;
+    alt.host = "alt.example.com";
+    alt.port = 443;
+    BOOST_TEST(settings(true, {}, {"example.com", 443}, nullptr, &alt) !=
+        settings(true));
+}
+
+void test_fields_do_not_run_together()
+{
+    // Length prefixes keep "a" + "bc" apart from "ab" + "c"
+    verify_config v1;
+    v1.ca_file = "a";
+    v1.ca_path = "bc";
+    verify_config v2;
+    v2.ca_file = "ab";
+    v2.ca_path = "c";
+    BOOST_TEST(settings(true, v1) != settings(true, v2));
+}
+
+void test_socket_options()
+{
+    socket_options so;
+    so.tcp_nodelay = false;
+    BOOST_TEST(settings(true, {}, {"example.com", 443}, nullptr, nullptr, so) !=
+        settings(true));
+}
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_verify();
+    test_route();
+    test_fields_do_not_run_together();
+    test_socket_options();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,103 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/continue_wait.hpp"
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using detail::continue_wait;
+using action = continue_wait::action;
+using namespace std::chrono_literals;
+
+continue_wait::time_point const t0{std::chrono::seconds(1000)};
+
+void test_should_expect()
+{
+    BOOST_TEST(!continue_wait::should_expect(0, 1024));
+    BOOST_TEST(!continue_wait::should_expect(1023, 1024));
+    BOOST_TEST(continue_wait::should_expect(1024, 1024));
+
+    // A body of unknown length may be large
+    BOOST_TEST(continue_wait::should_expect(std::nullopt, 1024));
+
+    // A threshold of zero expects for every body
+    BOOST_TEST(continue_wait::should_expect(1, 0));
+    BOOST_TEST(!continue_wait::should_expect(0, 0));
+}
+
+void test_continue()
+{
+    continue_wait w;
+    BOOST_TEST(!w.waiting());
+    w.start(t0 + 1s);
+    BOOST_TEST(w.waiting());
+    BOOST_TEST(w.deadline() == t0 + 1s);
+
+    // Early hints do not release the body
+    action a = w.on_interim(103);
+    BOOST_TEST(a == action::wait);
+    BOOST_TEST(w.waiting());
+    a = w.on_interim(100);
+    BOOST_TEST(a == action::send_body);
+    BOOST_TEST(!w.waiting());
+    BOOST_TEST(!w.retry_without_expect());
+}
+
+void test_timeout()
+{
+    continue_wait w;
+    w.start(t0 + 1s);
+    action a = w.on_timer(t0 + 999ms);
+    BOOST_TEST(a == action::wait);
+    a = w.on_timer(t0 + 1s);
+    BOOST_TEST(a == action::send_body);
+    BOOST_TEST(!w.waiting());
+
+    // A late 100 Continue changes nothing
+    a = w.on_interim(100);
+    BOOST_TEST(a == action::send_body);
+}
+
+void test_rejected()
+{
+    continue_wait w;
+    w.start(t0 + 1s);
+    action a = w.on_final(413);
+    BOOST_TEST(a == action::skip_body);
+    BOOST_TEST(!w.waiting());
+    BOOST_TEST(!w.retry_without_expect());
+
+    continue_wait w2;
+    w2.start(t0 + 1s);
+    a = w2.on_final(417);
+    BOOST_TEST(a == action::skip_body);
+    BOOST_TEST(w2.retry_without_expect());
+}
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_should_expect();
+    test_continue();
+    test_timeout();
+    test_rejected();
+
+    return boost::report_errors();
+}
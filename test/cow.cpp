@@ -0,0 +1,126 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/cow.hpp"
+
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using detail::cow;
+
+void test_copy_shares()
+{
+    cow<std::vector<int>> a(std::vector<int>{1, 2, 3});
+    BOOST_TEST(!a.shared());
+
+    auto b = a;
+    BOOST_TEST(a.shared());
+    BOOST_TEST(b.shared());
+    BOOST_TEST(&*a == &*b);
+    BOOST_TEST(b->size() == 3);
+}
+
+void test_write_detaches()
+{
+    cow<std::string> a(std::string("parent"));
+    auto b = a;
+
+    b.write() += "-child";
+    BOOST_TEST(*a == "parent");
+    BOOST_TEST(*b == "parent-child");
+    BOOST_TEST(!a.shared());
+    BOOST_TEST(!b.shared());
+
+    // A sole owner writes in place
+    auto const* p = &b.get();
+    b.write() = "x";
+    BOOST_TEST(&b.get() == p);
+}
+
+void test_default()
+{
+    cow<std::string> a;
+    BOOST_TEST(a->empty());
+    a.write() = "y";
+    BOOST_TEST(*a == "y");
+}
+
+void test_lend()
+{
+    cow<std::string> a(std::string("parent"));
+    auto& r = a.lend();
+
+    // A copy made while the reference lives does not see
+    // writes through it
+    auto b = a;
+    BOOST_TEST(!a.shared());
+    r = "changed";
+    BOOST_TEST(*b == "parent");
+    BOOST_TEST(*a == "changed");
+
+    // Nor does an assigned one
+    cow<std::string> c;
+    c = a;
+    r = "again";
+    BOOST_TEST(*c == "changed");
+
+    // Copies of the copy share as usual
+    auto d = b;
+    BOOST_TEST(b.shared());
+    BOOST_TEST(&*b == &*d);
+}
+
+void test_unlend()
+{
+    cow<std::string> a(std::string("parent"));
+    a.lend() = "changed";
+    a.unlend();
+
+    // Once the reference is given back, copies share again
+    auto b = a;
+    BOOST_TEST(a.shared());
+    BOOST_TEST(&*a == &*b);
+    BOOST_TEST(*b == "changed");
+
+    // Nested lends end with the last unlend
+    a.lend();
+    a.lend() = "again";
+    a.unlend();
+    auto c = a;
+    BOOST_TEST(&*a != &*c);
+    a.unlend();
+    auto d = a;
+    BOOST_TEST(&*a == &*d);
+    BOOST_TEST(*d == "again");
+}
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_copy_shares();
+    test_write_detaches();
+    test_default();
+    test_lend();
+    test_unlend();
+
+    return boost::report_errors();
+}
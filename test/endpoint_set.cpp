@@ -0,0 +1,195 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/endpoint_set.hpp"
+
+#include <map>
+#include <string>
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using endpoints = detail::endpoint_set<std::string>;
+using namespace std::chrono_literals;
+
+endpoints::time_point const t0{std::chrono::seconds(1000)};
+
+load_balancing
+make_config(load_balancing::policy algo)
+{
+    load_balancing cfg;
+    cfg.algo = algo;
+    cfg.consecutive_failures = 3;
+    cfg.minimum_requests = 2;
+    cfg.base_ejection_time = 10s;
+    cfg.max_ejection_time = 60s;
+    cfg.max_ejection_percent = 50;
+    return cfg;
+}
+
+std::vector<std::string> const addrs{
+    "10.0.0.1", "10.0.0.2", "10.0.0.3", "10.0.0.4"};
+
+void test_empty()
+{
+    endpoints s(make_config(load_balancing::policy::power_of_two));
+    auto e = s.acquire(t0);
+    BOOST_TEST(!e);
+}
+
+void test_least_outstanding_spreads()
+{
+    endpoints s(make_config(
+        load_balancing::policy::least_outstanding));
+    s.assign(addrs);
+
+    // Each address gets one before any gets two
+    std::map<std::string, int> n;
+    for(int i = 0; i < 8; ++i)
+        ++n[*s.acquire(t0)];
+    BOOST_TEST(n.size() == 4);
+    for(auto const& [ep, count] : n)
+        BOOST_TEST(count == 2);
+
+    // A freed slot is reused first
+    s.release("10.0.0.3", 1ms, false, t0);
+    auto e = *s.acquire(t0);
+    BOOST_TEST(e == "10.0.0.3");
+}
+
+void test_power_of_two_balances()
+{
+    endpoints s(make_config(load_balancing::policy::power_of_two));
+    s.assign(addrs);
+
+    // Roughly even when nothing completes
+    for(int i = 0; i < 400; ++i)
+        s.acquire(t0);
+    for(auto const& a : addrs)
+        BOOST_TEST(s.outstanding(a) >= 80 && s.outstanding(a) <= 120);
+}
+
+void test_consecutive_failures_eject()
+{
+    endpoints s(make_config(
+        load_balancing::policy::least_outstanding));
+    s.assign(addrs);
+
+    for(int i = 0; i < 3; ++i)
+    {
+        s.acquire(t0);
+        s.release("10.0.0.1", 1ms, true, t0);
+    }
+    BOOST_TEST(s.ejected("10.0.0.1", t0));
+    for(int i = 0; i < 12; ++i)
+    {
+        auto const e = *s.acquire(t0);
+        BOOST_TEST(e != "10.0.0.1");
+    }
+
+    // Back after the ejection time
+    BOOST_TEST(!s.ejected("10.0.0.1", t0 + 10s));
+}
+
+void test_ejection_grows()
+{
+    endpoints s(make_config(
+        load_balancing::policy::least_outstanding));
+    s.assign(addrs);
+
+    auto fail = [&](endpoints::time_point now)
+    {
+        for(int i = 0; i < 3; ++i)
+            s.release("10.0.0.1", 1ms, true, now);
+    };
+    fail(t0);
+    BOOST_TEST(s.ejected("10.0.0.1", t0 + 9s));
+    fail(t0 + 10s);
+    BOOST_TEST(s.ejected("10.0.0.1", t0 + 29s));
+    BOOST_TEST(!s.ejected("10.0.0.1", t0 + 30s));
+}
+
+void test_ejection_cap()
+{
+    endpoints s(make_config(
+        load_balancing::policy::least_outstanding));
+    s.assign(addrs);
+
+    for(auto const& a : addrs)
+        for(int i = 0; i < 3; ++i)
+            s.release(a, 1ms, true, t0);
+
+    // At most half the endpoints are ejected
+    int ejected = 0;
+    for(auto const& a : addrs)
+        ejected += s.ejected(a, t0);
+    BOOST_TEST(ejected == 2);
+}
+
+void test_latency_outlier()
+{
+    endpoints s(make_config(
+        load_balancing::policy::least_outstanding));
+    s.assign(addrs);
+
+    for(int i = 0; i < 2; ++i)
+    {
+        s.release("10.0.0.1", 10ms, false, t0);
+        s.release("10.0.0.2", 12ms, false, t0);
+        s.release("10.0.0.3", 11ms, false, t0);
+    }
+    BOOST_TEST(!s.ejected("10.0.0.4", t0));
+
+    s.release("10.0.0.4", 100ms, false, t0);
+    s.release("10.0.0.4", 100ms, false, t0);
+    BOOST_TEST(s.ejected("10.0.0.4", t0));
+}
+
+void test_assign_keeps_stats()
+{
+    endpoints s(make_config(
+        load_balancing::policy::least_outstanding));
+    s.assign(addrs);
+    for(int i = 0; i < 3; ++i)
+        s.release("10.0.0.2", 1ms, true, t0);
+    BOOST_TEST(s.ejected("10.0.0.2", t0));
+
+    s.assign({"10.0.0.2", "10.0.0.5"});
+    BOOST_TEST(s.size() == 2);
+    BOOST_TEST(s.ejected("10.0.0.2", t0));
+
+    // Completions for a removed address are ignored
+    s.release("10.0.0.1", 1ms, true, t0);
+    BOOST_TEST(!s.ejected("10.0.0.1", t0));
+}
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_empty();
+    test_least_outstanding_spreads();
+    test_power_of_two_balances();
+    test_consecutive_failures_eject();
+    test_ejection_grows();
+    test_ejection_cap();
+    test_latency_outlier();
+    test_assign_keeps_stats();
+
+    return boost::report_errors();
+}
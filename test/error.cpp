@@ -43,10 +43,19 @@ void test_error_values()
     error e11 = error::connection_closed;
     error e12 = error::cancelled;
     error e13 = error::not_implemented;
+    error e14 = error::deadline_exceeded;
+    error e15 = error::overloaded;
+    error e16 = error::circuit_open;
+    error e17 = error::session_closed;
+    error e18 = error::websocket_handshake_failed;
+    error e19 = error::websocket_protocol_error;
+    error e20 = error::digest_mismatch;
     
     (void)e1; (void)e2; (void)e3; (void)e4; (void)e5;
     (void)e6; (void)e7; (void)e8; (void)e9; (void)e10;
-    (void)e11; (void)e12; (void)e13;
+    (void)e11; (void)e12; (void)e13; (void)e14;
+    (void)e15; (void)e16; (void)e17; (void)e18; (void)e19;
+    (void)e20;
 }
 
 //----------------------------------------------------------
@@ -0,0 +1,106 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/exchange_state.hpp"
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using detail::exchange_state;
+using phase = exchange_state::phase;
+
+void test_connecting()
+{
+    exchange_state s;
+    BOOST_TEST(s.current() == phase::connecting);
+    BOOST_TEST(!s.reusable());
+
+    s.on_connected();
+    BOOST_TEST(s.current() == phase::idle);
+    BOOST_TEST(s.reusable());
+}
+
+void test_exchange()
+{
+    exchange_state s;
+    s.on_connected();
+
+    s.on_send(0);
+    BOOST_TEST(s.reusable());
+    s.on_send(100);
+    BOOST_TEST(s.current() == phase::sending);
+    BOOST_TEST(!s.reusable());
+    s.on_send(20);
+    s.on_sent();
+    BOOST_TEST(s.current() == phase::awaiting);
+    BOOST_TEST(!s.reusable());
+    BOOST_TEST(s.sent() == 120);
+
+    s.on_receive(50);
+    BOOST_TEST(s.current() == phase::receiving);
+    BOOST_TEST(!s.reusable());
+    s.on_complete();
+    BOOST_TEST(s.current() == phase::complete);
+    BOOST_TEST(s.reusable());
+    BOOST_TEST(s.received() == 50);
+}
+
+void test_reuse()
+{
+    exchange_state s;
+    s.on_connected();
+    s.on_send(10);
+    s.on_sent();
+    s.on_receive(10);
+    s.on_complete();
+
+    // The next exchange counts from zero
+    s.on_send(5);
+    BOOST_TEST(s.sent() == 5);
+    BOOST_TEST(s.received() == 0);
+    BOOST_TEST(!s.reusable());
+}
+
+void test_truncated()
+{
+    exchange_state s;
+    s.on_connected();
+    s.on_send(200);
+    s.on_truncated();
+    s.on_receive(30);
+    s.on_complete();
+
+    // Complete, but the peer still expects the body
+    BOOST_TEST(s.current() == phase::complete);
+    BOOST_TEST(!s.reusable());
+
+    s.on_connected();
+    BOOST_TEST(s.reusable());
+}
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_connecting();
+    test_exchange();
+    test_reuse();
+    test_truncated();
+
+    return boost::report_errors();
+}
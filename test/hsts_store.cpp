@@ -0,0 +1,150 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/hsts_store.hpp"
+
+#include <string>
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using store = detail::hsts_store;
+using namespace std::chrono_literals;
+
+// 2025-01-01 00:00:00 UTC
+store::time_point const t0{std::chrono::seconds(1735689600)};
+
+void test_update()
+{
+    store s;
+    bool valid = s.update("Example.COM", "max-age=3600", t0);
+    BOOST_TEST(valid);
+    BOOST_TEST(s.secure("example.com", t0));
+    BOOST_TEST(s.secure("EXAMPLE.com.", t0 + 59min));
+    BOOST_TEST(!s.secure("example.com", t0 + 1h));
+
+    // Without includeSubDomains only the host itself matches
+    BOOST_TEST(!s.secure("www.example.com", t0));
+    BOOST_TEST(!s.secure("other.com", t0));
+
+    // Quoted values and whitespace are allowed
+    valid = s.update("a.test", " max-age=\"60\" ; includeSubDomains", t0);
+    BOOST_TEST(valid);
+    BOOST_TEST(s.secure("a.test", t0));
+    BOOST_TEST(s.secure("x.y.a.test", t0));
+    BOOST_TEST(!s.secure("ba.test", t0));
+
+    // max-age=0 removes the entry
+    valid = s.update("a.test", "max-age=0", t0);
+    BOOST_TEST(valid);
+    BOOST_TEST(!s.secure("a.test", t0));
+    BOOST_TEST(s.size() == 1);
+}
+
+void test_invalid()
+{
+    store s;
+    bool valid = s.update("a.test", "", t0);
+    BOOST_TEST(!valid);
+    valid = s.update("a.test", "includeSubDomains", t0);
+    BOOST_TEST(!valid);
+    valid = s.update("a.test", "max-age=", t0);
+    BOOST_TEST(!valid);
+    valid = s.update("a.test", "max-age=-1", t0);
+    BOOST_TEST(!valid);
+    valid = s.update("a.test", "max-age=1; max-age=2", t0);
+    BOOST_TEST(!valid);
+    valid = s.update("a.test", "max-age=1; includeSubDomains=1", t0);
+    BOOST_TEST(!valid);
+
+    // IP literals are never recorded
+    valid = s.update("192.0.2.1", "max-age=60", t0);
+    BOOST_TEST(!valid);
+    valid = s.update("::1", "max-age=60", t0);
+    BOOST_TEST(!valid);
+    BOOST_TEST(s.size() == 0);
+
+    // Unknown directives are ignored
+    valid = s.update("a.test", "max-age=60; preload; foo=bar", t0);
+    BOOST_TEST(valid);
+    BOOST_TEST(s.secure("a.test", t0));
+}
+
+void test_suffix()
+{
+    store s;
+    s.set("example.com", {t0 + 1h, true});
+    s.set("www.example.com", {t0 + 1h, false});
+    s.set("b.example.com", {t0 - 1s, true});
+
+    BOOST_TEST(s.secure("example.com", t0));
+    BOOST_TEST(s.secure("www.example.com", t0));
+    BOOST_TEST(s.secure("a.b.example.com", t0));
+
+    // Labels match whole, not as string suffixes
+    BOOST_TEST(!s.secure("badexample.com", t0));
+    BOOST_TEST(!s.secure("com", t0));
+}
+
+void test_file()
+{
+    store s;
+    auto const n = s.load(
+        "# comment\n"
+        "\n"
+        ".example.com \"20250102 03:04:05\"\n"
+        "a.test \"unlimited\"\r\n"
+        "old.test \"20240101 00:00:00\"\n"
+        "bad.test 20250102\n"
+        "bad2.test \"20251301 00:00:00\"\n"
+        "nodate\n",
+        t0);
+    BOOST_TEST(n == 2);
+    BOOST_TEST(s.secure("www.example.com", t0));
+    BOOST_TEST(!s.secure("www.example.com", t0 + 24h + 3h + 4min + 5s));
+    BOOST_TEST(s.secure("a.test", t0 + 24h * 365 * 100));
+    BOOST_TEST(!s.secure("old.test", t0));
+
+    auto const text = s.save(t0);
+    BOOST_TEST(text.find(
+        ".example.com \"20250102 03:04:05\"\n") != std::string::npos);
+    BOOST_TEST(text.find("a.test \"unlimited\"\n") != std::string::npos);
+
+    // Saving and loading round trips
+    store s2;
+    auto const loaded = s2.load(text, t0);
+    BOOST_TEST(loaded == 2);
+    BOOST_TEST(s2.save(t0) == text);
+
+    // Expired entries are left out
+    BOOST_TEST(s.save(t0 + 48h).find("example.com") == std::string::npos);
+    s.prune(t0 + 48h);
+    BOOST_TEST(s.size() == 1);
+}
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_update();
+    test_invalid();
+    test_suffix();
+    test_file();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,143 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/json_index.hpp"
+
+#include <string>
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using namespace detail;
+
+// The first byte of every token, in order
+std::string
+tokens(std::string const& s)
+{
+    json_index idx;
+    bool ok = idx.build(s);
+    BOOST_TEST(ok);
+    std::string out;
+    for(std::size_t i = 0; i < idx.size(); ++i)
+        out.push_back(s[idx.pos(i)]);
+    return out;
+}
+
+void test_tokens()
+{
+    BOOST_TEST(tokens(R"({"a":1,"b":[true,null,-2.5e3],"c":"x"})") ==
+        R"({":1,":[t,n,-],":"})");
+    BOOST_TEST(tokens(" 42 ") == "4");
+    BOOST_TEST(tokens(R"("s")") == "\"");
+    BOOST_TEST(tokens("") == "");
+
+    // Structural characters inside strings are not tokens,
+    // and escaped quotes do not end them
+    BOOST_TEST(tokens(R"(["{[:,]}", "a\"b,", "\\", 1])") == "[\",\",\",1]");
+
+    // Neither are literals split by whitespace
+    BOOST_TEST(tokens("[1 , 2\n,\t3]") == "[1,2,3]");
+}
+
+void test_block_edges()
+{
+    // Strings, escapes and numbers across the 64-byte blocks,
+    // at every alignment
+    for(std::size_t pad = 0; pad < 70; ++pad)
+    {
+        std::string const s = std::string(pad, ' ') +
+            R"(["\\\"\\", 1234567890, "x"])";
+        json_index idx;
+        bool ok = idx.build(s);
+        BOOST_TEST(ok);
+        BOOST_TEST(idx.size() == 7);
+        BOOST_TEST(s[idx.pos(3)] == '1');
+        BOOST_TEST(s[idx.pos(5)] == '"');
+        BOOST_TEST(idx.match(0) == 6);
+    }
+
+    // A run of backslashes ending exactly at a block boundary
+    for(std::size_t n = 60; n < 70; ++n)
+    {
+        std::string s = "[\"";
+        s.append(n, 'a');
+        s += "\\\\\", 1]";
+        BOOST_TEST(tokens(s) == "[\",1]");
+    }
+}
+
+void test_match()
+{
+    std::string const s = R"({"a":[1,{"b":[]}],"c":{}})";
+    json_index idx;
+    bool ok = idx.build(s);
+    BOOST_TEST(ok);
+    BOOST_TEST(s[idx.pos(idx.match(0))] == '}');
+    BOOST_TEST(idx.match(0) == idx.size() - 1);
+    // "a" : [
+    BOOST_TEST(s[idx.pos(3)] == '[');
+    BOOST_TEST(s[idx.pos(idx.match(3) + 1)] == ',');
+}
+
+void test_invalid()
+{
+    json_index idx;
+    bool ok = idx.build(R"(["abc])");
+    BOOST_TEST(!ok);
+    ok = idx.build(R"(["abc\"])");
+    BOOST_TEST(!ok);
+    ok = idx.build("[1,2");
+    BOOST_TEST(!ok);
+    ok = idx.build("[1}");
+    BOOST_TEST(!ok);
+    ok = idx.build("]");
+    BOOST_TEST(!ok);
+}
+
+void test_unescape()
+{
+    auto u = [](std::string const& s)
+    {
+        std::string out;
+        return json_unescape(s, out) ? out : std::string("<bad>");
+    };
+    BOOST_TEST(u("plain") == "plain");
+    BOOST_TEST(u(R"(a\"b\\c\/d\n\t)") == "a\"b\\c/d\n\t");
+    BOOST_TEST(u(R"(\u00e9)") == "\xc3\xa9");
+    BOOST_TEST(u(R"(\u20AC)") == "\xe2\x82\xac");
+    BOOST_TEST(u(R"(\ud83d\ude00)") == "\xf0\x9f\x98\x80");
+
+    BOOST_TEST(u(R"(\x)") == "<bad>");
+    BOOST_TEST(u(R"(\u12)") == "<bad>");
+    BOOST_TEST(u(R"(\ud83d)") == "<bad>");
+    BOOST_TEST(u(R"(\ude00)") == "<bad>");
+    BOOST_TEST(u("a\nb") == "<bad>");
+}
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_tokens();
+    test_block_edges();
+    test_match();
+    test_invalid();
+    test_unescape();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,144 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/burl/json_view.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#include <string>
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using kind = json_view::value_kind;
+
+std::string const doc = R"({
+    "name": "burl",
+    "version": 3,
+    "ratio": -2.5e-1,
+    "big": 18446744073709551615,
+    "ok": true,
+    "none": null,
+    "items": [
+        {"id": 1, "tags": ["a", "b"]},
+        {"id": 2, "tags": []},
+        {"id": 3, "tags": ["c"]}
+    ],
+    "a/b": 1,
+    "m~n": 2,
+    "esc\"aped": "line\nbreak é",
+    "empty": {}
+})";
+
+void test_lookup()
+{
+    json_view v(doc);
+    BOOST_TEST(v.valid());
+    auto const root = v.root();
+    BOOST_TEST(root.kind() == kind::object);
+    BOOST_TEST(root.size() == 11);
+
+    BOOST_TEST(root.find("name")->get_string() == "burl");
+    BOOST_TEST(root.find("version")->get_int64() == 3);
+    BOOST_TEST(root.find("ratio")->get_double() == -0.25);
+    BOOST_TEST(root.find("ratio")->get_int64() == std::nullopt);
+    BOOST_TEST(root.find("big")->get_uint64() == 18446744073709551615ull);
+    BOOST_TEST(root.find("big")->get_int64() == std::nullopt);
+    BOOST_TEST(root.find("ok")->get_bool() == true);
+    BOOST_TEST(root.find("none")->is_null());
+    BOOST_TEST(!root.find("missing"));
+    BOOST_TEST(!root.find("empty")->find("x"));
+    BOOST_TEST(root.find("empty")->size() == 0);
+
+    // Keys are compared unescaped, strings returned unescaped
+    auto const e = root.find("esc\"aped");
+    BOOST_TEST(e);
+    BOOST_TEST(e->get_string() == "line\nbreak \xc3\xa9");
+    BOOST_TEST(e->raw() == R"("line\nbreak é")");
+
+    auto const items = root.find("items");
+    BOOST_TEST(items->kind() == kind::array);
+    BOOST_TEST(items->size() == 3);
+    BOOST_TEST(items->at(2)->find("id")->get_int64() == 3);
+    BOOST_TEST(!items->at(3));
+    BOOST_TEST(items->at(1)->find("tags")->size() == 0);
+
+    // Wrong kinds give nothing rather than throwing
+    BOOST_TEST(!items->find("id"));
+    BOOST_TEST(!root.at(0));
+    BOOST_TEST(!root.find("name")->get_int64());
+    BOOST_TEST(root.find("name")->size() == 0);
+}
+
+void test_pointer()
+{
+    json_view v(doc);
+    BOOST_TEST(v.at_pointer("")->kind() == kind::object);
+    BOOST_TEST(v.at_pointer("/items/0/tags/1")->get_string() == "b");
+    BOOST_TEST(v.at_pointer("/items/2/id")->get_int64() == 3);
+    BOOST_TEST(v.at_pointer("/a~1b")->get_int64() == 1);
+    BOOST_TEST(v.at_pointer("/m~0n")->get_int64() == 2);
+
+    BOOST_TEST(!v.at_pointer("items"));
+    BOOST_TEST(!v.at_pointer("/items/01"));
+    BOOST_TEST(!v.at_pointer("/items/-"));
+    BOOST_TEST(!v.at_pointer("/items/9"));
+    BOOST_TEST(!v.at_pointer("/name/0"));
+    BOOST_TEST(!v.at_pointer("/m~2n"));
+}
+
+void test_raw()
+{
+    json_view v(R"( [ {"a" : [1, 2]} , "x" , 7 ] )");
+    BOOST_TEST(v.valid());
+    BOOST_TEST(v.root().raw() == R"([ {"a" : [1, 2]} , "x" , 7 ])");
+    BOOST_TEST(v.at_pointer("/0")->raw() == R"({"a" : [1, 2]})");
+    BOOST_TEST(v.at_pointer("/2")->raw() == "7");
+
+    auto const jv = v.at_pointer("/0")->to_value();
+    BOOST_TEST(jv && jv->is_object());
+}
+
+void test_invalid()
+{
+    BOOST_TEST(!json_view().valid());
+    BOOST_TEST(!json_view().at_pointer(""));
+    BOOST_TEST(!json_view("").valid());
+    BOOST_TEST(!json_view("[1, 2").valid());
+    BOOST_TEST(!json_view(R"(["open)").valid());
+    BOOST_TEST(!json_view("1 2").valid());
+    BOOST_TEST(!json_view("{} []").valid());
+    BOOST_TEST(json_view(" 42 ").root().get_int64() == 42);
+
+    // Errors off the path are not seen; errors on it are
+    json_view v(R"({"a": [1, 2 3], "b": {"c" 1}, "d": 01, "e": tru})");
+    BOOST_TEST(v.valid());
+    BOOST_TEST(!v.at_pointer("/b/c"));
+    BOOST_TEST(!v.at_pointer("/d")->get_int64());
+    BOOST_TEST(!v.at_pointer("/e")->get_bool());
+    BOOST_TEST(!v.at_pointer("/a/2"));
+}
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_lookup();
+    test_pointer();
+    test_raw();
+    test_invalid();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,85 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/link_header.hpp"
+
+#include <string>
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using namespace detail;
+
+void test_parse()
+{
+    // GitHub's form
+    auto const v = parse_link_header(
+        "<https://api.github.com/repositories/1/issues?page=2>; rel=\"next\", "
+        "<https://api.github.com/repositories/1/issues?page=5>; rel=\"last\"");
+    BOOST_TEST(v.size() == 2);
+    BOOST_TEST(v[0].target ==
+        "https://api.github.com/repositories/1/issues?page=2");
+    BOOST_TEST(v[0].has_rel("next"));
+    BOOST_TEST(!v[0].has_rel("last"));
+    BOOST_TEST(v[1].has_rel("last"));
+
+    // Commas in targets and quoted values do not split links;
+    // names are case-insensitive, escapes are undone
+    auto const w = parse_link_header(
+        "</a,b>;REL=next;title=\"x, \\\"y\\\"\";anchor,</c>");
+    BOOST_TEST(w.size() == 2);
+    BOOST_TEST(w[0].target == "/a,b");
+    BOOST_TEST(w[0].param("title") == "x, \"y\"");
+    BOOST_TEST(w[0].param("anchor") == "");
+    BOOST_TEST(w[1].target == "/c");
+    BOOST_TEST(w[1].params.empty());
+
+    BOOST_TEST(parse_link_header("").empty());
+    BOOST_TEST(parse_link_header(" , ").empty());
+}
+
+void test_malformed()
+{
+    // Links before a malformed one are kept
+    BOOST_TEST(parse_link_header("</a>; rel=next, junk").size() == 1);
+    BOOST_TEST(parse_link_header("</a>; rel=next, </b").size() == 1);
+    BOOST_TEST(parse_link_header("</a>; rel=\"next").empty());
+    BOOST_TEST(parse_link_header("</a> rel=next").empty());
+    BOOST_TEST(parse_link_header("</a>; =next").empty());
+}
+
+void test_find()
+{
+    // rel may list several types, in any case
+    BOOST_TEST(find_link("</p2>; rel=\"prev NEXT\"", "next") == "/p2");
+    BOOST_TEST(find_link("</p1>; rel=prev, </p3>; rel=next", "next") == "/p3");
+    BOOST_TEST(!find_link("</p1>; rel=prev", "next"));
+    BOOST_TEST(!find_link("</p1>; rel=nextpage", "next"));
+    BOOST_TEST(!find_link("</p1>; title=next", "next"));
+}
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_parse();
+    test_malformed();
+    test_find();
+
+    return boost::report_errors();
+}
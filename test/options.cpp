@@ -47,6 +47,206 @@ void test_verify_config_aggregate_init()
     (void)v;
 }
 
+//----------------------------------------------------------
+// bandwidth_limit compilation tests
+//----------------------------------------------------------
+
+static_assert(std::is_default_constructible_v<bandwidth_limit>);
+
+void test_bandwidth_limit()
+{
+    // Unlimited by default
+    bandwidth_limit l;
+    std::uint64_t up = l.upload;
+    std::uint64_t down = l.download;
+    (void)up; (void)down;
+
+    bandwidth_limit l2{
+        .upload = 1024 * 1024,
+        .download = 10 * 1024 * 1024
+    };
+    (void)l2;
+}
+
+//----------------------------------------------------------
+// request_rate compilation tests
+//----------------------------------------------------------
+
+static_assert(std::is_default_constructible_v<request_rate>);
+
+void test_request_rate()
+{
+    // Unlimited by default
+    request_rate r;
+    std::uint64_t count = r.count;
+    std::chrono::milliseconds interval = r.interval;
+    std::uint64_t burst = r.burst;
+    (void)count; (void)interval; (void)burst;
+
+    request_rate r2{
+        .count = 100,
+        .interval = std::chrono::seconds(1),
+        .burst = 10
+    };
+    (void)r2;
+}
+
+//----------------------------------------------------------
+// adaptive_concurrency compilation tests
+//----------------------------------------------------------
+
+static_assert(std::is_default_constructible_v<adaptive_concurrency>);
+
+void test_adaptive_concurrency()
+{
+    adaptive_concurrency c;
+    adaptive_concurrency::algorithm algo = c.algo;
+    std::size_t initial = c.initial_limit;
+    double backoff = c.backoff_ratio;
+    std::size_t max_queue = c.max_queue;
+    (void)algo; (void)initial; (void)backoff; (void)max_queue;
+
+    adaptive_concurrency c2{
+        .algo = adaptive_concurrency::algorithm::gradient,
+        .min_limit = 4,
+        .max_limit = 100,
+        .rtt_tolerance = 2.0
+    };
+    (void)c2;
+}
+
+//----------------------------------------------------------
+// circuit_breaker_config compilation tests
+//----------------------------------------------------------
+
+static_assert(std::is_default_constructible_v<circuit_breaker_config>);
+
+void test_circuit_breaker_config()
+{
+    circuit_breaker_config c;
+    double ratio = c.failure_ratio;
+    std::size_t minimum = c.minimum_requests;
+    std::chrono::milliseconds window = c.window;
+    std::chrono::milliseconds open = c.open_duration;
+    std::size_t probes = c.half_open_probes;
+    (void)ratio; (void)minimum; (void)window; (void)open; (void)probes;
+}
+
+//----------------------------------------------------------
+// load_balancing compilation tests
+//----------------------------------------------------------
+
+static_assert(std::is_default_constructible_v<load_balancing>);
+
+void test_load_balancing()
+{
+    load_balancing lb;
+    load_balancing::policy algo = lb.algo;
+    std::size_t failures = lb.consecutive_failures;
+    double ratio = lb.latency_ratio;
+    std::chrono::milliseconds base = lb.base_ejection_time;
+    unsigned percent = lb.max_ejection_percent;
+    (void)algo; (void)failures; (void)ratio; (void)base; (void)percent;
+}
+
+//----------------------------------------------------------
+// socket_options compilation tests
+//----------------------------------------------------------
+
+static_assert(std::is_default_constructible_v<socket_options>);
+
+void test_socket_options()
+{
+    socket_options s;
+    bool nodelay = s.tcp_nodelay;
+    bool fastopen = s.tcp_fastopen;
+    bool keepalive = s.keepalive;
+    std::chrono::seconds idle = s.keepalive_idle;
+    std::size_t rcvbuf = s.receive_buffer;
+    bool no_port = s.bind_address_no_port;
+    (void)nodelay; (void)fastopen; (void)keepalive;
+    (void)idle; (void)rcvbuf; (void)no_port;
+}
+
+//----------------------------------------------------------
+// source_binding compilation tests
+//----------------------------------------------------------
+
+static_assert(std::is_default_constructible_v<source_binding>);
+
+void test_source_binding()
+{
+    source_binding b;
+    std::vector<std::string> addresses = b.addresses;
+    std::uint16_t first = b.first_port;
+    std::uint16_t last = b.last_port;
+    (void)addresses; (void)first; (void)last;
+}
+
+//----------------------------------------------------------
+// pool_options compilation tests
+//----------------------------------------------------------
+
+static_assert(std::is_default_constructible_v<pool_options>);
+
+void test_pool_options()
+{
+    pool_options p;
+    std::chrono::milliseconds idle = p.idle_timeout;
+    std::chrono::milliseconds age = p.max_age;
+    std::size_t min_idle = p.min_idle;
+    std::chrono::milliseconds interval = p.interval;
+    double jitter = p.jitter;
+    std::uint64_t rate = p.connect_rate;
+    (void)idle; (void)age; (void)min_idle;
+    (void)interval; (void)jitter; (void)rate;
+}
+
+//----------------------------------------------------------
+// expect_continue compilation tests
+//----------------------------------------------------------
+
+static_assert(std::is_default_constructible_v<expect_continue>);
+
+void test_expect_continue()
+{
+    expect_continue e;
+    std::uint64_t threshold = e.threshold;
+    std::chrono::milliseconds timeout = e.timeout;
+    (void)threshold; (void)timeout;
+}
+
+//----------------------------------------------------------
+// digest_check compilation tests
+//----------------------------------------------------------
+
+static_assert(std::is_default_constructible_v<digest_check>);
+
+void test_digest_check()
+{
+    digest_check d;
+    d.algorithm = digest_algorithm::crc32c;
+    d.expected = "e3069283";
+    bool required = d.required;
+    (void)required;
+}
+
+//----------------------------------------------------------
+// paginate_options compilation tests
+//----------------------------------------------------------
+
+static_assert(std::is_default_constructible_v<paginate_options>);
+
+void test_paginate_options()
+{
+    paginate_options p;
+    std::size_t lookahead = p.lookahead;
+    std::size_t max_pages = p.max_pages;
+    p.cursor_pointer = "/meta/next_cursor";
+    p.cursor_param = "cursor";
+    (void)lookahead; (void)max_pages;
+}
+
 //----------------------------------------------------------
 // request_options compilation tests
 //----------------------------------------------------------
@@ -66,10 +266,17 @@ void test_request_options_default()
     bool has_allow_redirects = opts.allow_redirects.has_value();
     bool has_verify = opts.verify.has_value();
     bool has_auth = opts.auth != nullptr;
+    bool has_limit_rate = opts.limit_rate.has_value();
+    bool has_digest = opts.digest.has_value();
+    bool has_priority = opts.priority.has_value();
+    bool has_deadline = opts.deadline.has_value();
+    bool stoppable = opts.stop_token.stop_possible();
     
     (void)has_headers; (void)has_json; (void)has_data;
     (void)has_timeout; (void)has_max_redirects;
     (void)has_allow_redirects; (void)has_verify; (void)has_auth;
+    (void)has_limit_rate; (void)has_digest; (void)has_priority;
+    (void)has_deadline; (void)stoppable;
 }
 
 void test_request_options_with_values()
@@ -98,6 +305,18 @@ void test_request_options_with_values()
     
     // Set auth
     opts.auth = std::make_shared<http_basic_auth>("user", "pass");
+
+    // Set bandwidth limit
+    opts.limit_rate = bandwidth_limit{.upload = 0, .download = 65536};
+
+    // Set scheduling
+    opts.priority = request_priority::high;
+    opts.deadline = std::chrono::steady_clock::now() +
+        std::chrono::milliseconds{250};
+
+    // Set cancellation
+    std::stop_source stop;
+    opts.stop_token = stop.get_token();
 }
 
 } // namespace burl
@@ -0,0 +1,362 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/origin_scheduler.hpp"
+
+#include <string>
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using scheduler = detail::origin_scheduler<std::string, int>;
+using namespace std::chrono_literals;
+
+scheduler::time_point const t0{std::chrono::seconds(1000)};
+
+void test_unlimited()
+{
+    scheduler s;
+    for(int i = 0; i < 100; ++i)
+    {
+        bool const ran = s.acquire("a", i);
+        BOOST_TEST(ran);
+    }
+    BOOST_TEST(s.in_flight() == 100);
+    BOOST_TEST(s.pending() == 0);
+}
+
+void test_per_origin_limit()
+{
+    scheduler s;
+    s.set_max_in_flight_per_origin(2);
+
+    bool ran = s.acquire("a", 1);
+    BOOST_TEST(ran);
+    ran = s.acquire("a", 2);
+    BOOST_TEST(ran);
+    ran = s.acquire("a", 3);
+    BOOST_TEST(!ran);
+
+    // Other origins are not affected
+    ran = s.acquire("b", 4);
+    BOOST_TEST(ran);
+    BOOST_TEST(s.in_flight("a") == 2);
+    BOOST_TEST(s.pending() == 1);
+
+    std::vector<int> out;
+    s.release("a", out);
+    BOOST_TEST((out == std::vector<int>{3}));
+    BOOST_TEST(s.in_flight("a") == 2);
+    BOOST_TEST(s.pending() == 0);
+}
+
+void test_round_robin()
+{
+    scheduler s;
+    s.set_max_in_flight(1);
+
+    // "big" has a large backlog queued first
+    bool ran = s.acquire("big", 0);
+    BOOST_TEST(ran);
+    for(int i = 1; i <= 10; ++i)
+    {
+        ran = s.acquire("big", i);
+        BOOST_TEST(!ran);
+    }
+    ran = s.acquire("small", 100);
+    BOOST_TEST(!ran);
+    ran = s.acquire("small", 101);
+    BOOST_TEST(!ran);
+
+    // Completions alternate between origins
+    std::vector<int> out;
+    s.release("big", out);
+    BOOST_TEST((out == std::vector<int>{1}));
+    out.clear();
+    s.release("big", out);
+    BOOST_TEST((out == std::vector<int>{100}));
+    out.clear();
+    s.release("small", out);
+    BOOST_TEST((out == std::vector<int>{2}));
+    out.clear();
+    s.release("big", out);
+    BOOST_TEST((out == std::vector<int>{101}));
+}
+
+void test_weighted()
+{
+    scheduler s;
+    s.set_max_in_flight(1);
+    s.set_weight("heavy", 3);
+
+    bool ran = s.acquire("heavy", 0);
+    BOOST_TEST(ran);
+    for(int i = 1; i <= 6; ++i)
+    {
+        ran = s.acquire("heavy", i);
+        BOOST_TEST(!ran);
+    }
+    ran = s.acquire("light", 100);
+    BOOST_TEST(!ran);
+    ran = s.acquire("light", 101);
+    BOOST_TEST(!ran);
+
+    // Dispatch order over several completions
+    std::vector<int> order;
+    std::string last = "heavy";
+    for(int i = 0; i < 6; ++i)
+    {
+        std::vector<int> out;
+        s.release(last, out);
+        BOOST_TEST(out.size() == 1);
+        order.push_back(out[0]);
+        last = out[0] >= 100 ? "light" : "heavy";
+    }
+    BOOST_TEST((order == std::vector<int>{1, 2, 3, 100, 4, 5}));
+}
+
+void test_global_limit_fills_all_origins()
+{
+    scheduler s;
+    s.set_max_in_flight(4);
+    s.set_max_in_flight_per_origin(4);
+
+    for(int i = 0; i < 4; ++i)
+    {
+        bool const ran = s.acquire("a", i);
+        BOOST_TEST(ran);
+    }
+    for(int i = 10; i < 14; ++i)
+    {
+        bool const ran = s.acquire("b", i);
+        BOOST_TEST(!ran);
+    }
+    for(int i = 20; i < 24; ++i)
+    {
+        bool const ran = s.acquire("c", i);
+        BOOST_TEST(!ran);
+    }
+
+    // Raising the limit dispatches fairly
+    std::vector<int> out;
+    s.set_max_in_flight(8);
+    s.dispatch(out);
+    BOOST_TEST(out.size() == 4);
+    BOOST_TEST(s.in_flight("b") == 2);
+    BOOST_TEST(s.in_flight("c") == 2);
+}
+
+void test_raise_origin_limit()
+{
+    scheduler s;
+    s.set_max_in_flight_per_origin(1);
+    bool ran = s.acquire("a", 1);
+    BOOST_TEST(ran);
+    ran = s.acquire("a", 2);
+    BOOST_TEST(!ran);
+
+    std::vector<int> out;
+    s.set_max_in_flight_per_origin(2);
+    s.dispatch(out);
+    BOOST_TEST((out == std::vector<int>{2}));
+}
+
+void test_origin_limit()
+{
+    scheduler s;
+    s.set_max_in_flight_per_origin(4);
+    s.set_limit("a", 1);
+
+    bool ran = s.acquire("a", 1);
+    BOOST_TEST(ran);
+    ran = s.acquire("a", 2);
+    BOOST_TEST(!ran);
+    ran = s.acquire("a", 3);
+    BOOST_TEST(!ran);
+    ran = s.acquire("b", 4);
+    BOOST_TEST(ran);
+    ran = s.acquire("b", 5);
+    BOOST_TEST(ran);
+    BOOST_TEST(s.pending("a") == 2);
+    BOOST_TEST(s.pending("b") == 0);
+
+    // Raising it lets the backlog run
+    std::vector<int> out;
+    s.set_limit("a", 2);
+    s.dispatch(out);
+    BOOST_TEST((out == std::vector<int>{2}));
+
+    // The default per-origin limit still caps it
+    out.clear();
+    s.set_limit("a", 100);
+    s.dispatch(out);
+    BOOST_TEST((out == std::vector<int>{3}));
+    BOOST_TEST(s.in_flight("a") == 3);
+}
+
+void test_clear_pending()
+{
+    scheduler s;
+    s.set_max_in_flight(1);
+    bool ran = s.acquire("a", 1);
+    BOOST_TEST(ran);
+    ran = s.acquire("a", 2);
+    BOOST_TEST(!ran);
+    ran = s.acquire("b", 3);
+    BOOST_TEST(!ran);
+
+    std::vector<int> out;
+    s.clear_pending(out);
+    BOOST_TEST(out.size() == 2);
+    BOOST_TEST(s.pending() == 0);
+
+    out.clear();
+    s.release("a", out);
+    BOOST_TEST(out.empty());
+    BOOST_TEST(s.in_flight() == 0);
+}
+
+void test_cancel()
+{
+    scheduler s;
+    s.set_max_in_flight_per_origin(1);
+    bool ran = s.acquire("a", 1);
+    BOOST_TEST(ran);
+    ran = s.acquire("a", 2);
+    BOOST_TEST(!ran);
+    ran = s.acquire("a", 3, 0);
+    BOOST_TEST(!ran);
+    ran = s.acquire("b", 4);
+    BOOST_TEST(ran);
+
+    bool removed = s.cancel("a", 3);
+    BOOST_TEST(removed);
+    removed = s.cancel("a", 3);
+    BOOST_TEST(!removed);
+    removed = s.cancel("b", 4);
+    BOOST_TEST(!removed);
+    removed = s.cancel("c", 1);
+    BOOST_TEST(!removed);
+    BOOST_TEST(s.pending() == 1);
+
+    // The cancelled waiter is never dispatched
+    std::vector<int> out;
+    s.release("a", out);
+    BOOST_TEST((out == std::vector<int>{2}));
+    s.release("a", out);
+    BOOST_TEST((out == std::vector<int>{2}));
+    BOOST_TEST(s.in_flight("a") == 0);
+}
+
+void test_priority_classes()
+{
+    scheduler s;
+    s.set_max_in_flight(1);
+
+    bool ran = s.acquire("a", 0);
+    BOOST_TEST(ran);
+    ran = s.acquire("a", 1, 2);
+    BOOST_TEST(!ran);
+    ran = s.acquire("b", 2, 1);
+    BOOST_TEST(!ran);
+    ran = s.acquire("c", 3, 0);
+    BOOST_TEST(!ran);
+
+    // The most urgent class goes first regardless of arrival
+    std::vector<int> out;
+    s.release("a", out);
+    BOOST_TEST((out == std::vector<int>{3}));
+    out.clear();
+    s.release("c", out);
+    BOOST_TEST((out == std::vector<int>{2}));
+    out.clear();
+    s.release("b", out);
+    BOOST_TEST((out == std::vector<int>{1}));
+}
+
+void test_earliest_deadline_first()
+{
+    scheduler s;
+    s.set_max_in_flight(1);
+
+    bool ran = s.acquire("a", 0);
+    BOOST_TEST(ran);
+    ran = s.acquire("a", 1, 1, t0 + 3s);
+    BOOST_TEST(!ran);
+    ran = s.acquire("a", 2, 1);
+    BOOST_TEST(!ran);
+    ran = s.acquire("a", 3, 1, t0 + 1s);
+    BOOST_TEST(!ran);
+    BOOST_TEST(s.earliest_deadline() == t0 + 1s);
+
+    std::vector<int> out;
+    s.release("a", out);
+    s.release("a", out);
+    s.release("a", out);
+    BOOST_TEST((out == std::vector<int>{3, 1, 2}));
+}
+
+void test_expire()
+{
+    scheduler s;
+    s.set_max_in_flight(1);
+
+    bool ran = s.acquire("a", 0);
+    BOOST_TEST(ran);
+    ran = s.acquire("a", 1, 1, t0 + 1s);
+    BOOST_TEST(!ran);
+    ran = s.acquire("b", 2, 1, t0 + 5s);
+    BOOST_TEST(!ran);
+    ran = s.acquire("b", 3, 1);
+    BOOST_TEST(!ran);
+
+    // Nothing has missed its deadline yet
+    std::vector<int> out;
+    s.expire(t0, 0s, out);
+    BOOST_TEST(out.empty());
+
+    // A deadline that cannot be met with 500ms of service time
+    s.expire(t0 + 600ms, 500ms, out);
+    BOOST_TEST((out == std::vector<int>{1}));
+    BOOST_TEST(s.pending() == 2);
+
+    // The remaining waiters still run
+    out.clear();
+    s.release("a", out);
+    BOOST_TEST((out == std::vector<int>{2}));
+}
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_unlimited();
+    test_per_origin_limit();
+    test_round_robin();
+    test_weighted();
+    test_global_limit_fills_all_origins();
+    test_raise_origin_limit();
+    test_origin_limit();
+    test_clear_pending();
+    test_cancel();
+    test_priority_classes();
+    test_earliest_deadline_first();
+    test_expire();
+
+    return boost::report_errors();
+}
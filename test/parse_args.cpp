@@ -8,8 +8,8 @@
 //
 
 #include <boost/burl/parse_args.hpp>
+#include <boost/core/lightweight_test.hpp>
 
-#include <cassert>
 #include <cstring>
 #include <vector>
 
@@ -57,9 +57,9 @@ void test_single_url()
     args_builder args{"burl", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.urls.size() == 1);
-    assert(result.args.urls[0] == "https://example.com");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.urls.size() == 1);
+    BOOST_TEST(result.args.urls[0] == "https://example.com");
 }
 
 void test_multiple_urls()
@@ -67,11 +67,11 @@ void test_multiple_urls()
     args_builder args{"burl", "https://a.com", "https://b.com", "https://c.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.urls.size() == 3);
-    assert(result.args.urls[0] == "https://a.com");
-    assert(result.args.urls[1] == "https://b.com");
-    assert(result.args.urls[2] == "https://c.com");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.urls.size() == 3);
+    BOOST_TEST(result.args.urls[0] == "https://a.com");
+    BOOST_TEST(result.args.urls[1] == "https://b.com");
+    BOOST_TEST(result.args.urls[2] == "https://c.com");
 }
 
 void test_urls_after_double_dash()
@@ -79,10 +79,10 @@ void test_urls_after_double_dash()
     args_builder args{"burl", "--", "-not-an-option", "--also-not"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.urls.size() == 2);
-    assert(result.args.urls[0] == "-not-an-option");
-    assert(result.args.urls[1] == "--also-not");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.urls.size() == 2);
+    BOOST_TEST(result.args.urls[0] == "-not-an-option");
+    BOOST_TEST(result.args.urls[1] == "--also-not");
 }
 
 //----------------------------------------------------------
@@ -94,8 +94,8 @@ void test_short_verbose()
     args_builder args{"burl", "-v", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.verbose);
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.verbose);
 }
 
 void test_short_silent()
@@ -103,8 +103,8 @@ void test_short_silent()
     args_builder args{"burl", "-s", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.silent);
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.silent);
 }
 
 void test_short_combined()
@@ -112,9 +112,9 @@ void test_short_combined()
     args_builder args{"burl", "-sS", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.silent);
-    assert(result.args.show_error);
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.silent);
+    BOOST_TEST(result.args.show_error);
 }
 
 void test_short_combined_vsL()
@@ -122,10 +122,10 @@ void test_short_combined_vsL()
     args_builder args{"burl", "-vsL", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.verbose);
-    assert(result.args.silent);
-    assert(result.args.follow_redirects);
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.verbose);
+    BOOST_TEST(result.args.silent);
+    BOOST_TEST(result.args.follow_redirects);
 }
 
 void test_short_location()
@@ -133,8 +133,8 @@ void test_short_location()
     args_builder args{"burl", "-L", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.follow_redirects);
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.follow_redirects);
 }
 
 void test_short_insecure()
@@ -142,8 +142,8 @@ void test_short_insecure()
     args_builder args{"burl", "-k", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.insecure);
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.insecure);
 }
 
 void test_short_include()
@@ -151,8 +151,8 @@ void test_short_include()
     args_builder args{"burl", "-i", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.include_headers);
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.include_headers);
 }
 
 void test_short_head()
@@ -160,8 +160,8 @@ void test_short_head()
     args_builder args{"burl", "-I", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.head_only);
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.head_only);
 }
 
 //----------------------------------------------------------
@@ -173,9 +173,9 @@ void test_short_data_separate()
     args_builder args{"burl", "-d", "key=value", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.data.size() == 1);
-    assert(result.args.data[0] == "key=value");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.data.size() == 1);
+    BOOST_TEST(result.args.data[0] == "key=value");
 }
 
 void test_short_data_attached()
@@ -183,9 +183,9 @@ void test_short_data_attached()
     args_builder args{"burl", "-dkey=value", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.data.size() == 1);
-    assert(result.args.data[0] == "key=value");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.data.size() == 1);
+    BOOST_TEST(result.args.data[0] == "key=value");
 }
 
 void test_short_data_multiple()
@@ -193,10 +193,10 @@ void test_short_data_multiple()
     args_builder args{"burl", "-d", "a=1", "-d", "b=2", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.data.size() == 2);
-    assert(result.args.data[0] == "a=1");
-    assert(result.args.data[1] == "b=2");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.data.size() == 2);
+    BOOST_TEST(result.args.data[0] == "a=1");
+    BOOST_TEST(result.args.data[1] == "b=2");
 }
 
 void test_short_header()
@@ -204,9 +204,9 @@ void test_short_header()
     args_builder args{"burl", "-H", "Content-Type: application/json", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.headers.size() == 1);
-    assert(result.args.headers[0] == "Content-Type: application/json");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.headers.size() == 1);
+    BOOST_TEST(result.args.headers[0] == "Content-Type: application/json");
 }
 
 void test_short_header_multiple()
@@ -214,10 +214,10 @@ void test_short_header_multiple()
     args_builder args{"burl", "-H", "Accept: */*", "-H", "X-Custom: foo", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.headers.size() == 2);
-    assert(result.args.headers[0] == "Accept: */*");
-    assert(result.args.headers[1] == "X-Custom: foo");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.headers.size() == 2);
+    BOOST_TEST(result.args.headers[0] == "Accept: */*");
+    BOOST_TEST(result.args.headers[1] == "X-Custom: foo");
 }
 
 void test_short_output()
@@ -225,9 +225,9 @@ void test_short_output()
     args_builder args{"burl", "-o", "output.txt", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.output.has_value());
-    assert(result.args.output.value() == "output.txt");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.output.has_value());
+    BOOST_TEST(result.args.output.value() == "output.txt");
 }
 
 void test_short_output_attached()
@@ -235,9 +235,9 @@ void test_short_output_attached()
     args_builder args{"burl", "-ooutput.txt", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.output.has_value());
-    assert(result.args.output.value() == "output.txt");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.output.has_value());
+    BOOST_TEST(result.args.output.value() == "output.txt");
 }
 
 void test_short_user()
@@ -245,9 +245,9 @@ void test_short_user()
     args_builder args{"burl", "-u", "admin:secret", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.user.has_value());
-    assert(result.args.user.value() == "admin:secret");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.user.has_value());
+    BOOST_TEST(result.args.user.value() == "admin:secret");
 }
 
 void test_short_method()
@@ -255,8 +255,8 @@ void test_short_method()
     args_builder args{"burl", "-X", "POST", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.method == "POST");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.method == "POST");
 }
 
 void test_short_user_agent()
@@ -264,9 +264,9 @@ void test_short_user_agent()
     args_builder args{"burl", "-A", "MyAgent/1.0", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.user_agent.has_value());
-    assert(result.args.user_agent.value() == "MyAgent/1.0");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.user_agent.has_value());
+    BOOST_TEST(result.args.user_agent.value() == "MyAgent/1.0");
 }
 
 void test_short_referer()
@@ -274,9 +274,9 @@ void test_short_referer()
     args_builder args{"burl", "-e", "https://google.com", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.referer.has_value());
-    assert(result.args.referer.value() == "https://google.com");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.referer.has_value());
+    BOOST_TEST(result.args.referer.value() == "https://google.com");
 }
 
 void test_short_cookie()
@@ -284,9 +284,9 @@ void test_short_cookie()
     args_builder args{"burl", "-b", "session=abc123", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.cookie.has_value());
-    assert(result.args.cookie.value() == "session=abc123");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.cookie.has_value());
+    BOOST_TEST(result.args.cookie.value() == "session=abc123");
 }
 
 void test_short_cookie_jar()
@@ -294,9 +294,9 @@ void test_short_cookie_jar()
     args_builder args{"burl", "-c", "cookies.txt", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.cookie_jar.has_value());
-    assert(result.args.cookie_jar.value() == "cookies.txt");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.cookie_jar.has_value());
+    BOOST_TEST(result.args.cookie_jar.value() == "cookies.txt");
 }
 
 //----------------------------------------------------------
@@ -308,8 +308,8 @@ void test_long_verbose()
     args_builder args{"burl", "--verbose", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.verbose);
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.verbose);
 }
 
 void test_long_silent()
@@ -317,8 +317,8 @@ void test_long_silent()
     args_builder args{"burl", "--silent", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.silent);
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.silent);
 }
 
 void test_long_location()
@@ -326,8 +326,8 @@ void test_long_location()
     args_builder args{"burl", "--location", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.follow_redirects);
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.follow_redirects);
 }
 
 void test_long_insecure()
@@ -335,8 +335,8 @@ void test_long_insecure()
     args_builder args{"burl", "--insecure", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.insecure);
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.insecure);
 }
 
 void test_long_include()
@@ -344,8 +344,8 @@ void test_long_include()
     args_builder args{"burl", "--include", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.include_headers);
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.include_headers);
 }
 
 void test_long_head()
@@ -353,8 +353,8 @@ void test_long_head()
     args_builder args{"burl", "--head", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.head_only);
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.head_only);
 }
 
 void test_long_compressed()
@@ -362,8 +362,8 @@ void test_long_compressed()
     args_builder args{"burl", "--compressed", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.compressed);
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.compressed);
 }
 
 //----------------------------------------------------------
@@ -375,9 +375,9 @@ void test_long_data_separate()
     args_builder args{"burl", "--data", "key=value", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.data.size() == 1);
-    assert(result.args.data[0] == "key=value");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.data.size() == 1);
+    BOOST_TEST(result.args.data[0] == "key=value");
 }
 
 void test_long_data_equals()
@@ -385,9 +385,9 @@ void test_long_data_equals()
     args_builder args{"burl", "--data=key=value", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.data.size() == 1);
-    assert(result.args.data[0] == "key=value");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.data.size() == 1);
+    BOOST_TEST(result.args.data[0] == "key=value");
 }
 
 void test_long_header()
@@ -395,9 +395,9 @@ void test_long_header()
     args_builder args{"burl", "--header", "X-Custom: value", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.headers.size() == 1);
-    assert(result.args.headers[0] == "X-Custom: value");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.headers.size() == 1);
+    BOOST_TEST(result.args.headers[0] == "X-Custom: value");
 }
 
 void test_long_header_equals()
@@ -405,9 +405,9 @@ void test_long_header_equals()
     args_builder args{"burl", "--header=X-Custom: value", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.headers.size() == 1);
-    assert(result.args.headers[0] == "X-Custom: value");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.headers.size() == 1);
+    BOOST_TEST(result.args.headers[0] == "X-Custom: value");
 }
 
 void test_long_output()
@@ -415,8 +415,8 @@ void test_long_output()
     args_builder args{"burl", "--output", "file.txt", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.output.value() == "file.txt");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.output.value() == "file.txt");
 }
 
 void test_long_output_equals()
@@ -424,8 +424,8 @@ void test_long_output_equals()
     args_builder args{"burl", "--output=file.txt", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.output.value() == "file.txt");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.output.value() == "file.txt");
 }
 
 void test_long_request()
@@ -433,8 +433,8 @@ void test_long_request()
     args_builder args{"burl", "--request", "DELETE", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.method == "DELETE");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.method == "DELETE");
 }
 
 void test_long_user()
@@ -442,8 +442,8 @@ void test_long_user()
     args_builder args{"burl", "--user", "name:pass", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.user.value() == "name:pass");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.user.value() == "name:pass");
 }
 
 void test_long_user_agent()
@@ -451,8 +451,8 @@ void test_long_user_agent()
     args_builder args{"burl", "--user-agent", "Bot/2.0", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.user_agent.value() == "Bot/2.0");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.user_agent.value() == "Bot/2.0");
 }
 
 void test_long_referer()
@@ -460,8 +460,8 @@ void test_long_referer()
     args_builder args{"burl", "--referer", "https://ref.com", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.referer.value() == "https://ref.com");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.referer.value() == "https://ref.com");
 }
 
 void test_long_cookie()
@@ -469,8 +469,8 @@ void test_long_cookie()
     args_builder args{"burl", "--cookie", "name=val", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.cookie.value() == "name=val");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.cookie.value() == "name=val");
 }
 
 void test_long_cookie_jar()
@@ -478,8 +478,8 @@ void test_long_cookie_jar()
     args_builder args{"burl", "--cookie-jar", "jar.txt", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.cookie_jar.value() == "jar.txt");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.cookie_jar.value() == "jar.txt");
 }
 
 void test_long_max_time()
@@ -487,9 +487,9 @@ void test_long_max_time()
     args_builder args{"burl", "--max-time", "30.5", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.max_time.has_value());
-    assert(result.args.max_time.value() == 30.5);
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.max_time.has_value());
+    BOOST_TEST(result.args.max_time.value() == 30.5);
 }
 
 void test_long_connect_timeout()
@@ -497,9 +497,31 @@ void test_long_connect_timeout()
     args_builder args{"burl", "--connect-timeout", "10", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.connect_timeout.has_value());
-    assert(result.args.connect_timeout.value() == 10.0);
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.connect_timeout.has_value());
+    BOOST_TEST(result.args.connect_timeout.value() == 10.0);
+}
+
+void test_long_expect100_timeout()
+{
+    args_builder args{"burl", "--expect100-timeout", "0.5", "https://example.com"};
+    auto result = parse_args(args.argc(), args.argv());
+    
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.expect100_timeout.value() == 0.5);
+
+    args_builder args2{"burl", "--expect100-timeout", "-1", "https://example.com"};
+    auto result2 = parse_args(args2.argc(), args2.argv());
+    
+    BOOST_TEST(result2.ec.failed());
+
+    // Not plain decimal, or too long to convert to milliseconds
+    for(char const* v : {"inf", "nan", "1e300", "0x10", " 5", "+5",
+        "86401"})
+    {
+        args_builder args3{"burl", "--expect100-timeout", v, "https://example.com"};
+        BOOST_TEST(parse_args(args3.argc(), args3.argv()).ec.failed());
+    }
 }
 
 void test_long_max_redirs()
@@ -507,8 +529,333 @@ void test_long_max_redirs()
     args_builder args{"burl", "--max-redirs", "5", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.max_redirs == 5);
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.max_redirs == 5);
+}
+
+void test_long_limit_rate()
+{
+    args_builder args{"burl", "--limit-rate", "1000", "https://example.com"};
+    auto result = parse_args(args.argc(), args.argv());
+    
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.limit_rate.has_value());
+    BOOST_TEST(result.args.limit_rate.value() == 1000);
+}
+
+void test_long_limit_rate_suffix()
+{
+    args_builder args{"burl", "--limit-rate=200K", "https://example.com"};
+    auto result = parse_args(args.argc(), args.argv());
+    
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.limit_rate.value() == 200 * 1024);
+
+    args_builder args2{"burl", "--limit-rate", "2m", "https://example.com"};
+    auto result2 = parse_args(args2.argc(), args2.argv());
+    
+    BOOST_TEST(!result2.ec.failed());
+    BOOST_TEST(result2.args.limit_rate.value() == 2 * 1024 * 1024);
+}
+
+void test_long_limit_rate_invalid()
+{
+    args_builder args{"burl", "--limit-rate", "fast", "https://example.com"};
+    auto result = parse_args(args.argc(), args.argv());
+    
+    BOOST_TEST(result.ec.failed());
+    BOOST_TEST(!result.error_message.empty());
+
+    args_builder args2{"burl", "--limit-rate", "10X", "https://example.com"};
+    auto result2 = parse_args(args2.argc(), args2.argv());
+    
+    BOOST_TEST(result2.ec.failed());
+
+    // Not plain decimal, not finite, out of range, or below
+    // one byte per second, which would mean unlimited
+    for(char const* v : {"inf", "nan", " 10", "+10", "1e3", "0x10",
+        "1.2.3", ".", "0", "0.5", "1e30", "99999999999999999999G"})
+    {
+        args_builder args3{"burl", "--limit-rate", v, "https://example.com"};
+        BOOST_TEST(parse_args(args3.argc(), args3.argv()).ec.failed());
+    }
+
+    args_builder args4{"burl", "--limit-rate", "1.5K", "https://example.com"};
+    auto result4 = parse_args(args4.argc(), args4.argv());
+    BOOST_TEST(!result4.ec.failed());
+    BOOST_TEST(result4.args.limit_rate.value() == 1536);
+}
+
+void test_long_rate()
+{
+    args_builder args{"burl", "--rate", "2/s", "https://example.com"};
+    auto result = parse_args(args.argc(), args.argv());
+    
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.rate.value() == 2);
+    BOOST_TEST(result.args.rate_period == std::chrono::seconds(1));
+
+    args_builder args2{"burl", "--rate=14/m", "https://example.com"};
+    auto result2 = parse_args(args2.argc(), args2.argv());
+    
+    BOOST_TEST(!result2.ec.failed());
+    BOOST_TEST(result2.args.rate.value() == 14);
+    BOOST_TEST(result2.args.rate_period == std::chrono::minutes(1));
+}
+
+void test_long_rate_default_unit()
+{
+    args_builder args{"burl", "--rate", "3", "https://example.com"};
+    auto result = parse_args(args.argc(), args.argv());
+    
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.rate.value() == 3);
+    BOOST_TEST(result.args.rate_period == std::chrono::hours(1));
+}
+
+void test_long_rate_invalid()
+{
+    args_builder args{"burl", "--rate", "2/w", "https://example.com"};
+    auto result = parse_args(args.argc(), args.argv());
+    
+    BOOST_TEST(result.ec.failed());
+
+    args_builder args2{"burl", "--rate", "/s", "https://example.com"};
+    auto result2 = parse_args(args2.argc(), args2.argv());
+    
+    BOOST_TEST(result2.ec.failed());
+
+    // Not plain decimal, too large, or zero, which would mean
+    // unlimited
+    for(char const* v : {" -5/s", "-5/s", "+5/s", " 5/s", "0x5/s",
+        "99999999999999999999999/s", "0/s", "0"})
+    {
+        args_builder args3{"burl", "--rate", v, "https://example.com"};
+        BOOST_TEST(parse_args(args3.argc(), args3.argv()).ec.failed());
+    }
+}
+
+void test_long_tcp_options()
+{
+    args_builder args{"burl", "https://example.com"};
+    auto result = parse_args(args.argc(), args.argv());
+    
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.tcp_nodelay);
+    BOOST_TEST(!result.args.tcp_fastopen);
+    BOOST_TEST(!result.args.no_keepalive);
+    BOOST_TEST(!result.args.keepalive_time.has_value());
+
+    args_builder args2{"burl",
+        "--tcp-nodelay", "--tcp-fastopen", "--no-keepalive",
+        "--keepalive-time", "30", "--keepalive-cnt=4",
+        "https://example.com"};
+    auto result2 = parse_args(args2.argc(), args2.argv());
+    
+    BOOST_TEST(!result2.ec.failed());
+    BOOST_TEST(result2.args.tcp_nodelay);
+    BOOST_TEST(result2.args.tcp_fastopen);
+    BOOST_TEST(result2.args.no_keepalive);
+    BOOST_TEST(result2.args.keepalive_time.value() == 30);
+    BOOST_TEST(result2.args.keepalive_cnt.value() == 4);
+}
+
+void test_long_keepalive_time_invalid()
+{
+    args_builder args{"burl", "--keepalive-time", "soon", "https://example.com"};
+    auto result = parse_args(args.argc(), args.argv());
+    
+    BOOST_TEST(result.ec.failed());
+
+    args_builder args2{"burl", "--keepalive-time", "0", "https://example.com"};
+    auto result2 = parse_args(args2.argc(), args2.argv());
+    
+    BOOST_TEST(result2.ec.failed());
+
+    // Not plain decimal, or outside 1..INT_MAX
+    for(char const* opt : {"--keepalive-time", "--keepalive-cnt"})
+    {
+        for(char const* v : {" 5", "+5", "-5", "0x5", "0",
+            "99999999999", "4294967297"})
+        {
+            args_builder args3{"burl", opt, v, "https://example.com"};
+            BOOST_TEST(parse_args(args3.argc(), args3.argv()).ec.failed());
+        }
+    }
+
+    args_builder args4{"burl", "--keepalive-cnt", "2147483647",
+        "https://example.com"};
+    auto result4 = parse_args(args4.argc(), args4.argv());
+    
+    BOOST_TEST(!result4.ec.failed());
+    BOOST_TEST(result4.args.keepalive_cnt.value() == 2147483647u);
+}
+
+void test_long_interface()
+{
+    args_builder args{"burl",
+        "--interface", "eth0",
+        "--interface=10.0.0.1,10.0.0.2",
+        "https://example.com"};
+    auto result = parse_args(args.argc(), args.argv());
+    
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST((result.args.interfaces ==
+        std::vector<std::string>{"eth0", "10.0.0.1", "10.0.0.2"}));
+
+    args_builder args2{"burl", "--interface", "a,,b", "https://example.com"};
+    auto result2 = parse_args(args2.argc(), args2.argv());
+    
+    BOOST_TEST(result2.ec.failed());
+}
+
+void test_long_local_port()
+{
+    args_builder args{"burl", "--local-port", "4000", "https://example.com"};
+    auto result = parse_args(args.argc(), args.argv());
+    
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.local_port.value() == 4000);
+    BOOST_TEST(!result.args.local_port_last.has_value());
+
+    args_builder args2{"burl", "--local-port=4000-4999", "https://example.com"};
+    auto result2 = parse_args(args2.argc(), args2.argv());
+    
+    BOOST_TEST(!result2.ec.failed());
+    BOOST_TEST(result2.args.local_port.value() == 4000);
+    BOOST_TEST(result2.args.local_port_last.value() == 4999);
+
+    args_builder args3{"burl", "--local-port", "5000-4000", "https://example.com"};
+    auto result3 = parse_args(args3.argc(), args3.argv());
+    
+    BOOST_TEST(result3.ec.failed());
+}
+
+void test_long_resolve()
+{
+    args_builder args{"burl",
+        "--resolve", "example.com:443:127.0.0.1",
+        "--resolve", "+api.example.com:8443:[::1],10.0.0.2",
+        "--resolve=-old.example.com:80",
+        "https://example.com"};
+    auto result = parse_args(args.argc(), args.argv());
+    
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.resolve.size() == 3);
+
+    auto const& r0 = result.args.resolve[0];
+    BOOST_TEST(r0.host == "example.com");
+    BOOST_TEST(r0.port == 443);
+    BOOST_TEST(r0.addresses == std::vector<std::string>{"127.0.0.1"});
+
+    auto const& r1 = result.args.resolve[1];
+    BOOST_TEST(r1.host == "api.example.com");
+    BOOST_TEST(r1.port == 8443);
+    BOOST_TEST((r1.addresses ==
+        std::vector<std::string>{"::1", "10.0.0.2"}));
+
+    // Removal has no addresses
+    auto const& r2 = result.args.resolve[2];
+    BOOST_TEST(r2.host == "old.example.com");
+    BOOST_TEST(r2.port == 80);
+    BOOST_TEST(r2.addresses.empty());
+}
+
+void test_long_resolve_invalid()
+{
+    char const* bad[] = {
+        "example.com:443",
+        "example.com:http:127.0.0.1",
+        "example.com:443:",
+        ":443:127.0.0.1",
+        "example.com:70000:127.0.0.1"};
+    for(auto v : bad)
+    {
+        args_builder args{"burl", "--resolve", v, "https://example.com"};
+        auto result = parse_args(args.argc(), args.argv());
+        
+        BOOST_TEST(result.ec.failed());
+    }
+}
+
+void test_long_connect_to()
+{
+    args_builder args{"burl",
+        "--connect-to", "example.com:443:localhost:8443",
+        "--connect-to", "::[::1]:",
+        "https://example.com"};
+    auto result = parse_args(args.argc(), args.argv());
+    
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.connect_to.size() == 2);
+
+    auto const& c0 = result.args.connect_to[0];
+    BOOST_TEST(c0.host == "example.com");
+    BOOST_TEST(c0.port == 443);
+    BOOST_TEST(c0.to_host == "localhost");
+    BOOST_TEST(c0.to_port == 8443);
+
+    // Empty fields mean any, or unchanged
+    auto const& c1 = result.args.connect_to[1];
+    BOOST_TEST(c1.host.empty());
+    BOOST_TEST(c1.port == 0);
+    BOOST_TEST(c1.to_host == "::1");
+    BOOST_TEST(c1.to_port == 0);
+}
+
+void test_long_connect_to_invalid()
+{
+    args_builder args{"burl", "--connect-to", "a:1:b", "https://example.com"};
+    auto result = parse_args(args.argc(), args.argv());
+    
+    BOOST_TEST(result.ec.failed());
+
+    args_builder args2{"burl", "--connect-to", "a:x:b:2", "https://example.com"};
+    auto result2 = parse_args(args2.argc(), args2.argv());
+    
+    BOOST_TEST(result2.ec.failed());
+}
+
+void test_long_warm_state()
+{
+    args_builder args{"burl", "--warm-state", "burl.state", "https://example.com"};
+    auto result = parse_args(args.argc(), args.argv());
+    
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.warm_state.value() == "burl.state");
+
+    args_builder args2{"burl", "https://example.com", "--warm-state"};
+    auto result2 = parse_args(args2.argc(), args2.argv());
+    
+    BOOST_TEST(result2.ec.failed());
+}
+
+void test_long_hsts()
+{
+    args_builder args{"burl", "--hsts", "hsts.txt", "http://example.com"};
+    auto result = parse_args(args.argc(), args.argv());
+    
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.hsts.value() == "hsts.txt");
+
+    args_builder args2{"burl", "http://example.com", "--hsts"};
+    auto result2 = parse_args(args2.argc(), args2.argv());
+    
+    BOOST_TEST(result2.ec.failed());
+}
+
+void test_long_alt_svc()
+{
+    args_builder args{"burl", "--alt-svc", "altsvc.txt", "https://example.com"};
+    auto result = parse_args(args.argc(), args.argv());
+    
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.alt_svc.value() == "altsvc.txt");
+
+    args_builder args2{"burl", "https://example.com", "--alt-svc"};
+    auto result2 = parse_args(args2.argc(), args2.argv());
+    
+    BOOST_TEST(result2.ec.failed());
 }
 
 //----------------------------------------------------------
@@ -520,8 +867,8 @@ void test_auth_basic()
     args_builder args{"burl", "--basic", "-u", "user:pass", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.auth == auth_type::basic);
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.auth == auth_type::basic);
 }
 
 void test_auth_digest()
@@ -529,8 +876,8 @@ void test_auth_digest()
     args_builder args{"burl", "--digest", "-u", "user:pass", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.auth == auth_type::digest);
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.auth == auth_type::digest);
 }
 
 void test_auth_ntlm()
@@ -538,8 +885,8 @@ void test_auth_ntlm()
     args_builder args{"burl", "--ntlm", "-u", "user:pass", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.auth == auth_type::ntlm);
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.auth == auth_type::ntlm);
 }
 
 void test_auth_negotiate()
@@ -547,8 +894,8 @@ void test_auth_negotiate()
     args_builder args{"burl", "--negotiate", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.auth == auth_type::negotiate);
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.auth == auth_type::negotiate);
 }
 
 void test_auth_any()
@@ -556,8 +903,8 @@ void test_auth_any()
     args_builder args{"burl", "--anyauth", "-u", "user:pass", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.auth == auth_type::any);
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.auth == auth_type::any);
 }
 
 //----------------------------------------------------------
@@ -569,8 +916,8 @@ void test_cacert()
     args_builder args{"burl", "--cacert", "/path/to/ca.crt", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.cacert.value() == "/path/to/ca.crt");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.cacert.value() == "/path/to/ca.crt");
 }
 
 void test_cert()
@@ -578,8 +925,8 @@ void test_cert()
     args_builder args{"burl", "--cert", "/path/to/client.crt", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.cert.value() == "/path/to/client.crt");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.cert.value() == "/path/to/client.crt");
 }
 
 void test_key()
@@ -587,8 +934,8 @@ void test_key()
     args_builder args{"burl", "--key", "/path/to/client.key", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.key.value() == "/path/to/client.key");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.key.value() == "/path/to/client.key");
 }
 
 //----------------------------------------------------------
@@ -600,8 +947,8 @@ void test_short_proxy()
     args_builder args{"burl", "-x", "http://proxy:8080", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.proxy.value() == "http://proxy:8080");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.proxy.value() == "http://proxy:8080");
 }
 
 void test_long_proxy()
@@ -609,8 +956,8 @@ void test_long_proxy()
     args_builder args{"burl", "--proxy", "socks5://localhost:1080", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.proxy.value() == "socks5://localhost:1080");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.proxy.value() == "socks5://localhost:1080");
 }
 
 //----------------------------------------------------------
@@ -622,9 +969,9 @@ void test_data_binary()
     args_builder args{"burl", "--data-binary", "@file.bin", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.data_binary.size() == 1);
-    assert(result.args.data_binary[0] == "@file.bin");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.data_binary.size() == 1);
+    BOOST_TEST(result.args.data_binary[0] == "@file.bin");
 }
 
 void test_data_raw()
@@ -632,9 +979,9 @@ void test_data_raw()
     args_builder args{"burl", "--data-raw", "@literally", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.data_raw.size() == 1);
-    assert(result.args.data_raw[0] == "@literally");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.data_raw.size() == 1);
+    BOOST_TEST(result.args.data_raw[0] == "@literally");
 }
 
 void test_data_urlencode()
@@ -642,9 +989,9 @@ void test_data_urlencode()
     args_builder args{"burl", "--data-urlencode", "msg=hello world", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.data_urlencode.size() == 1);
-    assert(result.args.data_urlencode[0] == "msg=hello world");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.data_urlencode.size() == 1);
+    BOOST_TEST(result.args.data_urlencode[0] == "msg=hello world");
 }
 
 void test_form()
@@ -652,9 +999,9 @@ void test_form()
     args_builder args{"burl", "-F", "file=@upload.txt", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.forms.size() == 1);
-    assert(result.args.forms[0] == "file=@upload.txt");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.forms.size() == 1);
+    BOOST_TEST(result.args.forms[0] == "file=@upload.txt");
 }
 
 void test_json()
@@ -662,9 +1009,9 @@ void test_json()
     args_builder args{"burl", "--json", R"({"key":"value"})", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.json.has_value());
-    assert(result.args.json.value() == R"({"key":"value"})");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.json.has_value());
+    BOOST_TEST(result.args.json.value() == R"({"key":"value"})");
 }
 
 void test_upload_file()
@@ -672,8 +1019,8 @@ void test_upload_file()
     args_builder args{"burl", "-T", "file.txt", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.upload_file.value() == "file.txt");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.upload_file.value() == "file.txt");
 }
 
 //----------------------------------------------------------
@@ -685,8 +1032,8 @@ void test_unknown_short_option()
     args_builder args{"burl", "-Z", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(result.ec.failed());
-    assert(result.error_message.find("-Z") != std::string::npos);
+    BOOST_TEST(result.ec.failed());
+    BOOST_TEST(result.error_message.find("-Z") != std::string::npos);
 }
 
 void test_unknown_long_option()
@@ -694,8 +1041,9 @@ void test_unknown_long_option()
     args_builder args{"burl", "--unknown-option", "https://example.com"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(result.ec.failed());
-    assert(result.error_message.find("unknown-option") != std::string::npos);
+    BOOST_TEST(result.ec.failed());
+    BOOST_TEST(result.error_message.find("unknown-option") !=
+        std::string::npos);
 }
 
 void test_missing_value_short()
@@ -703,8 +1051,8 @@ void test_missing_value_short()
     args_builder args{"burl", "-d"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(result.ec.failed());
-    assert(result.error_message.find("-d") != std::string::npos);
+    BOOST_TEST(result.ec.failed());
+    BOOST_TEST(result.error_message.find("-d") != std::string::npos);
 }
 
 void test_missing_value_long()
@@ -712,8 +1060,8 @@ void test_missing_value_long()
     args_builder args{"burl", "--data"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(result.ec.failed());
-    assert(result.error_message.find("--data") != std::string::npos);
+    BOOST_TEST(result.ec.failed());
+    BOOST_TEST(result.error_message.find("--data") != std::string::npos);
 }
 
 //----------------------------------------------------------
@@ -726,12 +1074,12 @@ void test_typical_get()
         "-o", "out.json", "https://api.example.com/data"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.silent);
-    assert(result.args.follow_redirects);
-    assert(result.args.headers.size() == 1);
-    assert(result.args.output.value() == "out.json");
-    assert(result.args.urls.size() == 1);
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.silent);
+    BOOST_TEST(result.args.follow_redirects);
+    BOOST_TEST(result.args.headers.size() == 1);
+    BOOST_TEST(result.args.output.value() == "out.json");
+    BOOST_TEST(result.args.urls.size() == 1);
 }
 
 void test_typical_post()
@@ -743,11 +1091,11 @@ void test_typical_post()
         "https://api.example.com/create"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.method == "POST");
-    assert(result.args.headers.size() == 1);
-    assert(result.args.data.size() == 1);
-    assert(result.args.user.value() == "admin:secret");
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.method == "POST");
+    BOOST_TEST(result.args.headers.size() == 1);
+    BOOST_TEST(result.args.data.size() == 1);
+    BOOST_TEST(result.args.user.value() == "admin:secret");
 }
 
 void test_help_flag()
@@ -755,8 +1103,8 @@ void test_help_flag()
     args_builder args{"burl", "--help"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.help);
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.help);
 }
 
 void test_version_flag()
@@ -764,8 +1112,8 @@ void test_version_flag()
     args_builder args{"burl", "--version"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.version);
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.version);
 }
 
 void test_no_arguments()
@@ -773,8 +1121,8 @@ void test_no_arguments()
     args_builder args{"burl"};
     auto result = parse_args(args.argc(), args.argv());
     
-    assert(!result.ec.failed());
-    assert(result.args.urls.empty());
+    BOOST_TEST(!result.ec.failed());
+    BOOST_TEST(result.args.urls.empty());
 }
 
 } // namespace
@@ -840,7 +1188,25 @@ int main()
     test_long_cookie_jar();
     test_long_max_time();
     test_long_connect_timeout();
+    test_long_expect100_timeout();
     test_long_max_redirs();
+    test_long_limit_rate();
+    test_long_limit_rate_suffix();
+    test_long_limit_rate_invalid();
+    test_long_rate();
+    test_long_rate_default_unit();
+    test_long_rate_invalid();
+    test_long_tcp_options();
+    test_long_keepalive_time_invalid();
+    test_long_interface();
+    test_long_local_port();
+    test_long_resolve();
+    test_long_resolve_invalid();
+    test_long_connect_to();
+    test_long_connect_to_invalid();
+    test_long_warm_state();
+    test_long_hsts();
+    test_long_alt_svc();
 
     // Auth type tests
     test_auth_basic();
@@ -879,5 +1245,5 @@ int main()
     test_version_flag();
     test_no_arguments();
 
-    return 0;
+    return boost::report_errors();
 }
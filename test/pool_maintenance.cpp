@@ -0,0 +1,136 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/pool_maintenance.hpp"
+
+#include <set>
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using detail::pool_maintenance;
+using namespace std::chrono_literals;
+
+pool_maintenance::time_point const t0{std::chrono::seconds(1000)};
+
+void test_reap_idle()
+{
+    pool_maintenance m;
+    auto const never = m.retire_at(t0);
+    BOOST_TEST(never == (pool_maintenance::time_point::max)());
+
+    // The default idle timeout is one minute
+    BOOST_TEST(!m.reap(t0, never, t0 + 59s));
+    BOOST_TEST(m.reap(t0, never, t0 + 60s));
+}
+
+void test_max_age()
+{
+    pool_options opts;
+    opts.max_age = 10min;
+    opts.jitter = 0.2;
+    pool_maintenance m(opts);
+
+    // Retired between 8 and 10 minutes, at different times
+    std::set<pool_maintenance::time_point> seen;
+    for(int i = 0; i < 100; ++i)
+    {
+        auto const t = m.retire_at(t0);
+        BOOST_TEST(t > t0 + 8min - 1ms);
+        BOOST_TEST(t <= t0 + 10min);
+        seen.insert(t);
+    }
+    BOOST_TEST(seen.size() > 50);
+
+    // Busy connections past their age go on release
+    auto const r = m.retire_at(t0);
+    BOOST_TEST(!m.reap(t0 + 5min, r, t0 + 5min));
+    BOOST_TEST(m.reap(t0 + 10min, r, t0 + 10min));
+}
+
+void test_no_jitter()
+{
+    pool_options opts;
+    opts.max_age = 10min;
+    opts.jitter = 0;
+    pool_maintenance m(opts);
+    auto t = m.retire_at(t0);
+    BOOST_TEST(t == t0 + 10min);
+    t = m.next_run(t0);
+    BOOST_TEST(t == t0 + 1s);
+}
+
+void test_replenish()
+{
+    pool_options opts;
+    opts.connect_rate = 4;
+    pool_maintenance m(opts);
+
+    // At or above the minimum
+    std::size_t n = m.replenish(2, 0, 2, t0);
+    BOOST_TEST(n == 0);
+    n = m.replenish(1, 1, 2, t0);
+    BOOST_TEST(n == 0);
+
+    // The rate caps a burst, and refills over time
+    n = m.replenish(0, 0, 10, t0);
+    BOOST_TEST(n == 4);
+    n = m.replenish(0, 4, 10, t0);
+    BOOST_TEST(n == 0);
+    n = m.replenish(0, 4, 10, t0 + 500ms);
+    BOOST_TEST(n == 2);
+    n = m.replenish(0, 6, 10, t0 + 10s);
+    BOOST_TEST(n == 4);
+
+    // Unlimited
+    opts.connect_rate = 0;
+    pool_maintenance u(opts);
+    n = u.replenish(0, 0, 100, t0);
+    BOOST_TEST(n == 100);
+}
+
+void test_next_run()
+{
+    pool_options opts;
+    opts.interval = 1000ms;
+    opts.jitter = 0.5;
+    pool_maintenance m(opts);
+
+    std::set<pool_maintenance::time_point> seen;
+    for(int i = 0; i < 100; ++i)
+    {
+        auto const t = m.next_run(t0);
+        BOOST_TEST(t >= t0 + 500ms);
+        BOOST_TEST(t <= t0 + 1500ms);
+        seen.insert(t);
+    }
+    BOOST_TEST(seen.size() > 50);
+}
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_reap_idle();
+    test_max_age();
+    test_no_jitter();
+    test_replenish();
+    test_next_run();
+
+    return boost::report_errors();
+}
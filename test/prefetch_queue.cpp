@@ -0,0 +1,115 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/prefetch_queue.hpp"
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using queue = detail::prefetch_queue<int>;
+
+void test_lookahead_one()
+{
+    queue q(1);
+
+    // The first page is fetched before anyone asks
+    BOOST_TEST(q.should_fetch());
+    q.start_fetch();
+    BOOST_TEST(!q.should_fetch());
+    q.on_fetched(1, false);
+
+    // One page waiting fills the lookahead
+    BOOST_TEST(q.ready());
+    BOOST_TEST(!q.should_fetch());
+
+    // Handing it over starts the next fetch, which overlaps
+    // the consumer's work on page 1
+    int v = q.pop();
+    BOOST_TEST(v == 1);
+    BOOST_TEST(q.should_fetch());
+    q.start_fetch();
+    q.on_fetched(2, true);
+
+    // The last page ends fetching
+    BOOST_TEST(!q.should_fetch());
+    BOOST_TEST(!q.done());
+    v = q.pop();
+    BOOST_TEST(v == 2);
+    BOOST_TEST(q.done());
+    BOOST_TEST(q.fetched() == 2);
+}
+
+void test_lookahead_zero()
+{
+    queue q(0);
+
+    // Nothing is fetched until the consumer waits
+    BOOST_TEST(!q.should_fetch());
+    q.wait();
+    BOOST_TEST(q.waiting());
+    BOOST_TEST(q.should_fetch());
+    q.start_fetch();
+    q.on_fetched(1, false);
+    BOOST_TEST(!q.should_fetch());
+    int v = q.pop();
+    BOOST_TEST(v == 1);
+    BOOST_TEST(!q.waiting());
+    BOOST_TEST(!q.should_fetch());
+}
+
+void test_deeper()
+{
+    queue q(3);
+    for(int i = 1; i <= 3; ++i)
+    {
+        BOOST_TEST(q.should_fetch());
+        q.start_fetch();
+        q.on_fetched(i, false);
+    }
+    BOOST_TEST(!q.should_fetch());
+    int v = q.pop();
+    BOOST_TEST(v == 1);
+    BOOST_TEST(q.should_fetch());
+}
+
+void test_stop()
+{
+    queue q(2);
+    q.start_fetch();
+    q.stop();
+
+    // The fetch in flight still counts
+    BOOST_TEST(!q.done());
+    q.on_fetched(1, false);
+    BOOST_TEST(!q.should_fetch());
+    int v = q.pop();
+    BOOST_TEST(v == 1);
+    BOOST_TEST(q.done());
+}
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_lookahead_one();
+    test_lookahead_zero();
+    test_deeper();
+    test_stop();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,97 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/request_gate.hpp"
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using detail::request_gate;
+using state = request_gate::state;
+
+void test_open()
+{
+    request_gate g;
+    BOOST_TEST(g.current() == state::open);
+    BOOST_TEST(!g.closing());
+    bool ok = g.enter();
+    BOOST_TEST(ok);
+    ok = g.enter();
+    BOOST_TEST(ok);
+    BOOST_TEST(g.in_flight() == 2);
+    bool closed = g.leave();
+    BOOST_TEST(!closed);
+    closed = g.leave();
+    BOOST_TEST(!closed);
+    BOOST_TEST(g.in_flight() == 0);
+    BOOST_TEST(g.current() == state::open);
+}
+
+void test_close_idle()
+{
+    request_gate g;
+    bool closed = g.close();
+    BOOST_TEST(closed);
+    BOOST_TEST(g.current() == state::closed);
+    bool ok = g.enter();
+    BOOST_TEST(!ok);
+    BOOST_TEST(g.in_flight() == 0);
+
+    // Closing again is harmless
+    closed = g.close();
+    BOOST_TEST(closed);
+}
+
+void test_drain()
+{
+    request_gate g;
+    bool ok = g.enter();
+    BOOST_TEST(ok);
+    ok = g.enter();
+    BOOST_TEST(ok);
+
+    bool closed = g.close();
+    BOOST_TEST(!closed);
+    BOOST_TEST(g.current() == state::draining);
+    BOOST_TEST(g.closing());
+    ok = g.enter();
+    BOOST_TEST(!ok);
+    BOOST_TEST(g.in_flight() == 2);
+
+    closed = g.leave();
+    BOOST_TEST(!closed);
+    BOOST_TEST(g.current() == state::draining);
+    closed = g.leave();
+    BOOST_TEST(closed);
+    BOOST_TEST(g.current() == state::closed);
+
+    // Only the last one out reports it
+    closed = g.leave();
+    BOOST_TEST(!closed);
+}
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_open();
+    test_close_idle();
+    test_drain();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,113 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/resolve_table.hpp"
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using detail::resolve_table;
+
+void test_empty()
+{
+    resolve_table t;
+    BOOST_TEST(t.empty());
+    BOOST_TEST(t.lookup("example.com", 443) == nullptr);
+    auto r = t.route("example.com", 443);
+    BOOST_TEST(r.host == "example.com");
+    BOOST_TEST(r.port == 443);
+}
+
+void test_resolve()
+{
+    resolve_table t;
+    t.add(resolve_override{"Example.com", 443, {"127.0.0.1", "::1"}});
+
+    auto a = t.lookup("example.COM", 443);
+    BOOST_TEST(a != nullptr);
+    BOOST_TEST(a->size() == 2);
+    BOOST_TEST((*a)[1] == "::1");
+
+    // Only the given port
+    BOOST_TEST(t.lookup("example.com", 80) == nullptr);
+
+    // A later entry replaces an earlier one
+    t.add(resolve_override{"example.com", 443, {"10.0.0.1"}});
+    BOOST_TEST(t.lookup("example.com", 443)->size() == 1);
+
+    // No addresses removes it
+    t.add(resolve_override{"example.com", 443, {}});
+    BOOST_TEST(t.lookup("example.com", 443) == nullptr);
+    BOOST_TEST(t.empty());
+}
+
+void test_resolve_wildcard()
+{
+    resolve_table t;
+    t.add(resolve_override{"*", 443, {"127.0.0.1"}});
+    t.add(resolve_override{"pinned.com", 443, {"10.0.0.1"}});
+
+    BOOST_TEST(t.lookup("any.com", 443)->front() == "127.0.0.1");
+    BOOST_TEST(t.lookup("pinned.com", 443)->front() == "10.0.0.1");
+    BOOST_TEST(t.lookup("any.com", 80) == nullptr);
+}
+
+void test_connect_to()
+{
+    resolve_table t;
+    t.add(connect_override{"example.com", 443, "localhost", 8443});
+    t.add(connect_override{"", 80, "", 8080});
+
+    auto r = t.route("EXAMPLE.com", 443);
+    BOOST_TEST(r.host == "localhost");
+    BOOST_TEST(r.port == 8443);
+
+    // Empty fields match anything and keep the original
+    r = t.route("other.com", 80);
+    BOOST_TEST(r.host == "other.com");
+    BOOST_TEST(r.port == 8080);
+
+    r = t.route("other.com", 443);
+    BOOST_TEST(r.host == "other.com");
+    BOOST_TEST(r.port == 443);
+}
+
+void test_connect_to_then_resolve()
+{
+    resolve_table t;
+    t.add(connect_override{"api.example.com", 0, "backend", 0});
+    t.add(resolve_override{"backend", 443, {"192.168.1.5"}});
+
+    auto r = t.route("api.example.com", 443);
+    auto a = t.lookup(r.host, r.port);
+    BOOST_TEST(a != nullptr);
+    BOOST_TEST(a->front() == "192.168.1.5");
+}
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_empty();
+    test_resolve();
+    test_resolve_wildcard();
+    test_connect_to();
+    test_connect_to_then_resolve();
+
+    return boost::report_errors();
+}
@@ -11,8 +11,10 @@
 
 #include <boost/burl/session.hpp>
 #include <boost/corosio/tls/context.hpp>
+#include <boost/core/lightweight_test.hpp>
 
 #include <type_traits>
+#include <utility>
 
 namespace boost {
 namespace burl {
@@ -42,6 +44,72 @@ void test_construction()
     (void)s;
 }
 
+void test_derive()
+{
+    corosio::io_context ioc;
+    corosio::tls::context tls_ctx;
+    session base(ioc, tls_ctx);
+    base.headers()->set(http::field::user_agent, "Gateway/1.0");
+    
+    // The edit is over, so the headers are still shared
+    session s = base.derive();
+    BOOST_TEST(
+        &std::as_const(s).headers() == &std::as_const(base).headers());
+    
+    // Derived sessions override only what differs
+    s.set_auth(std::make_shared<http_bearer_auth>("tenant-token"));
+    s.headers()->set("X-Tenant", "a");
+    BOOST_TEST(
+        &std::as_const(s).headers() != &std::as_const(base).headers());
+    
+    // A session derived during an edit gets its own copy
+    {
+        auto h = base.headers();
+        session s2 = base.derive();
+        h->set(http::field::user_agent, "Gateway/2.0");
+        BOOST_TEST(
+            &std::as_const(s2).headers() != &std::as_const(base).headers());
+    }
+    
+    session const& cs = s;
+    http::fields const& h = cs.headers();
+    bool same_ioc = &s.get_io_context() == &base.get_io_context();
+    (void)h; (void)same_ioc;
+}
+
+void test_warm_state_signatures()
+{
+    corosio::io_context ioc;
+    corosio::tls::context tls_ctx;
+    session s(ioc, tls_ctx);
+    
+    // Both report errors as error_code
+    std::error_code ec1 = s.load_state("burl.state");
+    std::error_code ec2 = s.save_state("burl.state");
+    
+    (void)ec1; (void)ec2;
+}
+
+void test_shared_construction()
+{
+    corosio::io_context ioc;
+    corosio::tls::context tls_ctx;
+    
+    // Sessions from one share use the same contexts
+    share sh(ioc, tls_ctx);
+    session a(sh);
+    session b(sh);
+    bool same_ioc = &a.get_io_context() == &b.get_io_context();
+    bool same_tls = &a.tls_context() == &sh.tls_context();
+    std::size_t idle = sh.idle_connections();
+    
+    // Settings stay separate
+    a.headers()->set(http::field::authorization, "Bearer a");
+    b.headers()->set(http::field::authorization, "Bearer b");
+    
+    (void)same_ioc; (void)same_tls; (void)idle;
+}
+
 //----------------------------------------------------------
 // Configuration tests
 //----------------------------------------------------------
@@ -78,9 +146,9 @@ void test_headers_access()
     corosio::tls::context tls_ctx;
     session s(ioc, tls_ctx);
     
-    // Non-const access
-    http::fields& h = s.headers();
-    h.set(http::field::user_agent, "Test/1.0");
+    // Non-const access, through a scoped editor
+    auto h = s.headers();
+    h->set(http::field::user_agent, "Test/1.0");
     
     // Const access
     session const& cs = s;
@@ -94,9 +162,10 @@ void test_cookies_access()
     corosio::tls::context tls_ctx;
     session s(ioc, tls_ctx);
     
-    // Non-const access
-    cookie_jar& jar = s.cookies();
-    (void)jar;
+    // Non-const access, through a scoped editor
+    auto jar = s.cookies();
+    cookie_jar& ref = *jar;
+    (void)ref;
     
     // Const access
     session const& cs = s;
@@ -146,6 +215,141 @@ void test_timeout_configuration()
     s.set_timeout(std::chrono::milliseconds{5000});
 }
 
+void test_limit_rate_configuration()
+{
+    corosio::io_context ioc;
+    corosio::tls::context tls_ctx;
+    session s(ioc, tls_ctx);
+    
+    s.set_limit_rate(bandwidth_limit{
+        .upload = 1024 * 1024,
+        .download = 0
+    });
+}
+
+void test_request_rate_configuration()
+{
+    corosio::io_context ioc;
+    corosio::tls::context tls_ctx;
+    session s(ioc, tls_ctx);
+    
+    s.set_request_rate(request_rate{
+        .count = 1000,
+        .interval = std::chrono::seconds(1)
+    });
+    s.set_origin_request_rate(request_rate{
+        .count = 14,
+        .interval = std::chrono::minutes(1)
+    });
+}
+
+void test_concurrency_configuration()
+{
+    corosio::io_context ioc;
+    corosio::tls::context tls_ctx;
+    session s(ioc, tls_ctx);
+    
+    s.set_max_in_flight(256);
+    s.set_max_in_flight_per_origin(16);
+    s.set_origin_weight("https://api.example.com", 4);
+}
+
+void test_adaptive_concurrency_configuration()
+{
+    corosio::io_context ioc;
+    corosio::tls::context tls_ctx;
+    session s(ioc, tls_ctx);
+    
+    s.set_adaptive_concurrency(adaptive_concurrency{
+        .algo = adaptive_concurrency::algorithm::aimd,
+        .max_limit = 64,
+        .max_queue = 100
+    });
+    s.set_adaptive_concurrency(std::nullopt);
+}
+
+void test_load_balancing_configuration()
+{
+    corosio::io_context ioc;
+    corosio::tls::context tls_ctx;
+    session s(ioc, tls_ctx);
+    
+    s.set_load_balancing(load_balancing{
+        .algo = load_balancing::policy::least_outstanding,
+        .consecutive_failures = 3
+    });
+}
+
+void test_socket_options()
+{
+    corosio::io_context ioc;
+    corosio::tls::context tls_ctx;
+    session s(ioc, tls_ctx);
+    
+    s.set_socket_options(socket_options{
+        .tcp_fastopen = true,
+        .keepalive_idle = std::chrono::seconds(30)
+    });
+    s.set_origin_socket_options("https://downloads.example.com",
+        socket_options{
+            .receive_buffer = 4 * 1024 * 1024
+        });
+}
+
+void test_pool_options()
+{
+    corosio::io_context ioc;
+    corosio::tls::context tls_ctx;
+    session s(ioc, tls_ctx);
+    
+    s.set_pool_options(pool_options{
+        .idle_timeout = std::chrono::seconds(30),
+        .max_age = std::chrono::minutes(10),
+        .min_idle = 2
+    });
+    s.set_origin_min_idle("https://api.example.com", 8);
+    s.set_pool_options(std::nullopt);
+}
+
+void test_source_binding()
+{
+    corosio::io_context ioc;
+    corosio::tls::context tls_ctx;
+    session s(ioc, tls_ctx);
+    
+    s.set_source_binding(source_binding{
+        .addresses = {"10.0.0.1", "10.0.0.2"},
+        .first_port = 20000,
+        .last_port = 20999
+    });
+}
+
+void test_resolver_overrides()
+{
+    corosio::io_context ioc;
+    corosio::tls::context tls_ctx;
+    session s(ioc, tls_ctx);
+    
+    s.add_resolve_override(resolve_override{
+        "example.com", 443, {"127.0.0.1"}});
+    s.add_connect_override(connect_override{
+        "api.example.com", 443, "localhost", 8443});
+    s.clear_resolver_overrides();
+}
+
+void test_circuit_breaker_configuration()
+{
+    corosio::io_context ioc;
+    corosio::tls::context tls_ctx;
+    session s(ioc, tls_ctx);
+    
+    s.set_circuit_breaker(circuit_breaker_config{
+        .failure_ratio = 0.25,
+        .open_duration = std::chrono::seconds(30)
+    });
+    s.set_circuit_breaker(std::nullopt);
+}
+
 //----------------------------------------------------------
 // Method signature tests
 //----------------------------------------------------------
@@ -208,6 +412,21 @@ void test_json_body_signatures()
     (void)r1; (void)r2;
 }
 
+void test_json_view_body_signatures()
+{
+    corosio::io_context ioc;
+    corosio::tls::context tls_ctx;
+    session s(ioc, tls_ctx);
+
+    urls::url_view url("https://example.com/api");
+
+    // JSON view body returns io_task<response<json_view>>
+    auto r1 = s.get(url, as_json_view);
+    auto r2 = s.post(url, as_json_view);
+
+    (void)r1; (void)r2;
+}
+
 void test_custom_type_signatures()
 {
     corosio::io_context ioc;
@@ -240,11 +459,25 @@ void test_streaming_signatures()
     (void)r1; (void)r2;
 }
 
+void test_shutdown_signatures()
+{
+    corosio::io_context ioc;
+    corosio::tls::context tls_ctx;
+    session s(ioc, tls_ctx);
+    
+    // Graceful shutdown returns io_task<>
+    auto r = s.shutdown(
+        std::chrono::steady_clock::now() + std::chrono::seconds(5));
+    
+    (void)r;
+}
+
 } // namespace burl
 } // namespace boost
 
 int main()
 {
-    // Just verify everything compiles
-    return 0;
+    // Most tests only verify that everything compiles
+    boost::burl::test_derive();
+    return boost::report_errors();
 }
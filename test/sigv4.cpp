@@ -0,0 +1,193 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/sigv4.hpp"
+
+#include <string>
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using namespace detail;
+
+constexpr std::string_view secret =
+    "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY";
+
+std::string
+hex(sigv4_key const& k)
+{
+    std::string s;
+    append_hex(s, k.data(), k.size());
+    return s;
+}
+
+void test_amz_date()
+{
+    // 2015-08-30 12:36:00 UTC
+    std::chrono::system_clock::time_point const t{
+        std::chrono::seconds(1440938160)};
+    BOOST_TEST(format_amz_date(t) == "20150830T123600Z");
+}
+
+void test_signing_key()
+{
+    // From AWS's Signature Version 4 documentation
+    BOOST_TEST(hex(sigv4_signing_key(
+        secret, "20150830", "us-east-1", "iam")) ==
+        "c4afb1cc5771d871763a393e44b703571b55cc28424d1a5e86da6ed3c154a4b9");
+
+    sigv4_key_cache cache;
+    auto const k = cache.get(secret, "20150830", "us-east-1", "iam");
+    auto k2 = cache.get(secret, "20150830", "us-east-1", "iam");
+    BOOST_TEST(k2 == k);
+    BOOST_TEST(cache.size() == 1);
+    k2 = cache.get(secret, "20150831", "us-east-1", "iam");
+    BOOST_TEST(k2 != k);
+    BOOST_TEST(cache.size() == 2);
+
+    // Full, the oldest entry is replaced
+    for(int i = 0; i < 10; ++i)
+        cache.get(secret, "2015090" + std::to_string(i), "r", "s");
+    BOOST_TEST(cache.size() == sigv4_key_cache::capacity);
+}
+
+void test_get_request()
+{
+    // AWS's example: IAM ListUsers
+    sigv4_builder b;
+    std::vector<sigv4_builder::header> const headers = {
+        {"Host", "iam.amazonaws.com"},
+        {"Content-Type", "application/x-www-form-urlencoded; charset=utf-8"},
+        {"X-Amz-Date", "20150830T123600Z"}};
+    std::string canonical, signed_headers;
+    b.canonical_request(canonical, "GET", "/",
+        "Version=2010-05-08&Action=ListUsers",
+        headers, sigv4_empty_hash, true, signed_headers);
+    BOOST_TEST(canonical ==
+        "GET\n"
+        "/\n"
+        "Action=ListUsers&Version=2010-05-08\n"
+        "content-type:application/x-www-form-urlencoded; charset=utf-8\n"
+        "host:iam.amazonaws.com\n"
+        "x-amz-date:20150830T123600Z\n"
+        "\n"
+        "content-type;host;x-amz-date\n"
+        "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    BOOST_TEST(signed_headers == "content-type;host;x-amz-date");
+
+    std::string sts;
+    sigv4_builder::string_to_sign(sts, "20150830T123600Z",
+        "20150830/us-east-1/iam/aws4_request", canonical);
+    BOOST_TEST(sts ==
+        "AWS4-HMAC-SHA256\n"
+        "20150830T123600Z\n"
+        "20150830/us-east-1/iam/aws4_request\n"
+        "f536975d06c0309214f805bb90ccff089219ecd68b2577efef23edd43b7e1a59");
+
+    std::string sig;
+    sigv4_builder::sign(sig,
+        sigv4_signing_key(secret, "20150830", "us-east-1", "iam"), sts);
+    BOOST_TEST(sig ==
+        "5d672d79c15b13162d9279b0855cfba6789a8edb4c82c400e06b5924a6f2b5d7");
+}
+
+void test_canonical_forms()
+{
+    sigv4_builder b;
+    std::string c, sh;
+    std::vector<sigv4_builder::header> const headers = {
+        {"My-Header", "  a   b  "},
+        {"host", "x"},
+        {"my-header", "c"}};
+    b.canonical_request(c, "GET", "/a b/%7Ec",
+        "b=2&a=&c=x%2fy&a=1", headers, "h", false, sh);
+    BOOST_TEST(c ==
+        "GET\n"
+        "/a%20b/~c\n"
+        "a=&a=1&b=2&c=x%2Fy\n"
+        "host:x\n"
+        "my-header:a b,c\n"
+        "\n"
+        "host;my-header\n"
+        "h");
+
+    // Other services encode the path a second time
+    c.clear();
+    b.canonical_request(c, "GET", "/a%20b", "", {}, "h", true, sh);
+    BOOST_TEST(c.rfind("GET\n/a%2520b\n\n", 0) == 0);
+}
+
+void test_chunked()
+{
+    // AWS's example: a 66560 byte PUT in 64 KiB chunks
+    BOOST_TEST(aws_chunked_length(66560, 65536) == 66824);
+    BOOST_TEST(aws_chunked_length(0, 65536) == 86);
+
+    std::string const date = "20130524T000000Z";
+    std::string const scope = "20130524/us-east-1/s3/aws4_request";
+    // The S3 examples use a slightly different secret
+    auto const key = sigv4_signing_key(
+        "wJalrXUtnFEMI/K7MDENG/bPxRfiCYEXAMPLEKEY",
+        "20130524", "us-east-1", "s3");
+
+    sigv4_builder b;
+    std::vector<sigv4_builder::header> const headers = {
+        {"Host", "s3.amazonaws.com"},
+        {"x-amz-date", date},
+        {"x-amz-storage-class", "REDUCED_REDUNDANCY"},
+        {"x-amz-content-sha256", sigv4_streaming_payload},
+        {"Content-Encoding", "aws-chunked"},
+        {"x-amz-decoded-content-length", "66560"},
+        {"Content-Length", "66824"}};
+    std::string canonical, sh, sts, seed;
+    b.canonical_request(canonical, "PUT", "/examplebucket/chunkObject.txt",
+        "", headers, sigv4_streaming_payload, false, sh);
+    sigv4_builder::string_to_sign(sts, date, scope, canonical);
+    sigv4_builder::sign(seed, key, sts);
+    BOOST_TEST(seed ==
+        "4f232c4386841ef735655705268965c44a0e4690baa4adea153f7db9fa80a0a9");
+
+    auto chunk = [&](std::string const& prev, std::string const& data)
+    {
+        std::string s, sig;
+        sigv4_builder::chunk_string_to_sign(s, date, scope, prev, data);
+        sigv4_builder::sign(sig, key, s);
+        return sig;
+    };
+    auto const c1 = chunk(seed, std::string(65536, 'a'));
+    BOOST_TEST(c1 ==
+        "ad80c730a21e5b8d04586a2213dd63b9a0e99e0e2307b0ade35a65485a288648");
+    auto const c2 = chunk(c1, std::string(1024, 'a'));
+    BOOST_TEST(c2 ==
+        "0055627c9e194cb4542bae2aa5492e3c1575bbb81b612b7d234b86a503ef5497");
+    BOOST_TEST(chunk(c2, "") ==
+        "b6c6ea8a5354eaf15b3cb7646744f4275b71ea724fed81ceb9323e279d449df9");
+}
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_amz_date();
+    test_signing_key();
+    test_get_request();
+    test_canonical_forms();
+    test_chunked();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,148 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/socket_options.hpp"
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+#ifndef _WIN32
+
+int
+get_int_option(int s, int level, int name)
+{
+    int v = 0;
+    socklen_t len = sizeof(v);
+    int rc = ::getsockopt(s, level, name, &v, &len);
+    BOOST_TEST(rc == 0);
+    (void)rc;
+    return v;
+}
+
+// A socket closed on scope exit
+struct tcp_socket
+{
+    int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+
+    ~tcp_socket()
+    {
+        if(fd >= 0)
+            ::close(fd);
+    }
+};
+
+void test_defaults()
+{
+    tcp_socket s;
+    BOOST_TEST(s.fd >= 0);
+    auto ec = detail::apply_socket_options(s.fd, socket_options{});
+    BOOST_TEST(!ec);
+    BOOST_TEST(get_int_option(s.fd, IPPROTO_TCP, TCP_NODELAY) != 0);
+    BOOST_TEST(get_int_option(s.fd, SOL_SOCKET, SO_KEEPALIVE) != 0);
+#ifdef TCP_KEEPIDLE
+    BOOST_TEST(get_int_option(s.fd, IPPROTO_TCP, TCP_KEEPIDLE) == 60);
+#endif
+}
+
+void test_disabled()
+{
+    socket_options opts;
+    opts.tcp_nodelay = false;
+    opts.keepalive = false;
+
+    tcp_socket s;
+    auto ec = detail::apply_socket_options(s.fd, opts);
+    BOOST_TEST(!ec);
+    BOOST_TEST(get_int_option(s.fd, IPPROTO_TCP, TCP_NODELAY) == 0);
+    BOOST_TEST(get_int_option(s.fd, SOL_SOCKET, SO_KEEPALIVE) == 0);
+}
+
+void test_keepalive_timing()
+{
+    socket_options opts;
+    opts.keepalive_idle = std::chrono::seconds(30);
+    opts.keepalive_interval = std::chrono::seconds(5);
+    opts.keepalive_count = 4;
+
+    tcp_socket s;
+    auto ec = detail::apply_socket_options(s.fd, opts);
+    BOOST_TEST(!ec);
+#ifdef TCP_KEEPIDLE
+    BOOST_TEST(get_int_option(s.fd, IPPROTO_TCP, TCP_KEEPIDLE) == 30);
+#endif
+#ifdef TCP_KEEPINTVL
+    BOOST_TEST(get_int_option(s.fd, IPPROTO_TCP, TCP_KEEPINTVL) == 5);
+#endif
+#ifdef TCP_KEEPCNT
+    BOOST_TEST(get_int_option(s.fd, IPPROTO_TCP, TCP_KEEPCNT) == 4);
+#endif
+}
+
+void test_buffers()
+{
+    socket_options opts;
+    opts.receive_buffer = 256 * 1024;
+    opts.send_buffer = 128 * 1024;
+
+    tcp_socket s;
+    auto ec = detail::apply_socket_options(s.fd, opts);
+    BOOST_TEST(!ec);
+
+    // The kernel may round or cap the sizes
+    BOOST_TEST(get_int_option(s.fd, SOL_SOCKET, SO_RCVBUF) > 0);
+    BOOST_TEST(get_int_option(s.fd, SOL_SOCKET, SO_SNDBUF) > 0);
+}
+
+void test_hints_never_fail()
+{
+    socket_options opts;
+    opts.tcp_fastopen = true;
+    opts.bind_address_no_port = true;
+
+    tcp_socket s;
+    auto ec = detail::apply_socket_options(s.fd, opts);
+    BOOST_TEST(!ec);
+}
+
+void test_bad_socket()
+{
+    auto ec = detail::apply_socket_options(-1, socket_options{});
+    BOOST_TEST(ec);
+}
+
+#endif
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+#ifndef _WIN32
+    using namespace boost::burl;
+
+    test_defaults();
+    test_disabled();
+    test_keepalive_timing();
+    test_buffers();
+    test_hints_never_fail();
+    test_bad_socket();
+#endif
+
+    return boost::report_errors();
+}
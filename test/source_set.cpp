@@ -0,0 +1,132 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/source_set.hpp"
+
+#include <algorithm>
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using detail::source_set;
+
+void test_numeric_address()
+{
+    BOOST_TEST(detail::is_numeric_address("127.0.0.1"));
+    BOOST_TEST(detail::is_numeric_address("::1"));
+    BOOST_TEST(detail::is_numeric_address("fe80::1"));
+    BOOST_TEST(!detail::is_numeric_address("eth0"));
+    BOOST_TEST(!detail::is_numeric_address("example.com"));
+    BOOST_TEST(!detail::is_numeric_address("[::1]"));
+}
+
+void test_empty()
+{
+    source_set s;
+    BOOST_TEST(s.empty());
+    auto a = s.next(AF_INET);
+    BOOST_TEST(a->empty());
+    a = s.next(AF_INET6);
+    BOOST_TEST(a->empty());
+}
+
+void test_round_robin()
+{
+    source_set s;
+    s.assign(source_binding{{"10.0.0.1", "::1", "10.0.0.2", "::2"}});
+    BOOST_TEST(!s.empty());
+
+    // Each family takes its own turn
+    auto a = s.next(AF_INET);
+    BOOST_TEST(*a == "10.0.0.1");
+    a = s.next(AF_INET6);
+    BOOST_TEST(*a == "::1");
+    a = s.next(AF_INET);
+    BOOST_TEST(*a == "10.0.0.2");
+    a = s.next(AF_INET);
+    BOOST_TEST(*a == "10.0.0.1");
+    a = s.next(AF_INET6);
+    BOOST_TEST(*a == "::2");
+    a = s.next(AF_INET6);
+    BOOST_TEST(*a == "::1");
+}
+
+void test_family_mismatch()
+{
+    BOOST_TEST(detail::address_family("10.0.0.1") == AF_INET);
+    BOOST_TEST(detail::address_family("::1") == AF_INET6);
+    BOOST_TEST(detail::address_family("eth0") == AF_UNSPEC);
+
+    // An IPv4 source cannot reach an IPv6 endpoint
+    source_set s;
+    s.assign(source_binding{{"10.0.0.1"}});
+    auto a = s.next(AF_INET);
+    BOOST_TEST(*a == "10.0.0.1");
+    a = s.next(AF_INET6);
+    BOOST_TEST(a == nullptr);
+}
+
+void test_port_range()
+{
+    source_set s;
+    s.assign(source_binding{{}, 4000, 4010});
+    BOOST_TEST(!s.empty());
+    auto a = s.next(AF_INET);
+    BOOST_TEST(a->empty());
+    BOOST_TEST(s.first_port() == 4000);
+    BOOST_TEST(s.last_port() == 4010);
+
+    // A single port
+    s.assign(source_binding{{}, 4000, 0});
+    BOOST_TEST(s.last_port() == 4000);
+}
+
+void test_interface_name()
+{
+#ifndef _WIN32
+    // Any loopback interface will do; its name varies
+    auto lo = detail::interface_addresses("lo");
+    if(lo.empty())
+        lo = detail::interface_addresses("lo0");
+    if(lo.empty())
+        return;
+    BOOST_TEST(std::find(lo.begin(), lo.end(), "127.0.0.1") != lo.end());
+#endif
+
+    // Unknown names are kept so that bind reports them
+    source_set s;
+    s.assign(source_binding{{"no-such-interface"}});
+    auto a = s.next(AF_INET);
+    BOOST_TEST(*a == "no-such-interface");
+    a = s.next(AF_INET6);
+    BOOST_TEST(*a == "no-such-interface");
+}
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_numeric_address();
+    test_empty();
+    test_round_robin();
+    test_family_mismatch();
+    test_port_range();
+    test_interface_name();
+
+    return boost::report_errors();
+}
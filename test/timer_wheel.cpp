@@ -0,0 +1,256 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/timer_wheel.hpp"
+
+#include <algorithm>
+#include <map>
+#include <random>
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using wheel = detail::timer_wheel<int>;
+using namespace std::chrono_literals;
+
+wheel::time_point const t0{std::chrono::seconds(1000)};
+
+void test_empty()
+{
+    wheel w(1ms, t0);
+    BOOST_TEST(w.empty());
+    BOOST_TEST(!w.next_expiry());
+
+    std::vector<int> out;
+    w.advance(t0 + 1h, out);
+    BOOST_TEST(out.empty());
+}
+
+void test_fires_in_order()
+{
+    wheel w(1ms, t0);
+    w.add(t0 + 30ms, 3);
+    w.add(t0 + 10ms, 1);
+    w.add(t0 + 20ms, 2);
+    BOOST_TEST(w.size() == 3);
+    BOOST_TEST(*w.next_expiry() == t0 + 10ms);
+
+    std::vector<int> out;
+    w.advance(t0 + 9ms, out);
+    BOOST_TEST(out.empty());
+    w.advance(t0 + 25ms, out);
+    BOOST_TEST((out == std::vector<int>{1, 2}));
+    BOOST_TEST(*w.next_expiry() == t0 + 30ms);
+    w.advance(t0 + 30ms, out);
+    BOOST_TEST((out == std::vector<int>{1, 2, 3}));
+    BOOST_TEST(w.empty());
+}
+
+void test_never_early()
+{
+    wheel w(10ms, t0);
+
+    // Rounded up to the next tick
+    w.add(t0 + 11ms, 1);
+    std::vector<int> out;
+    w.advance(t0 + 19ms, out);
+    BOOST_TEST(out.empty());
+    w.advance(t0 + 20ms, out);
+    BOOST_TEST(out.size() == 1);
+}
+
+void test_overdue()
+{
+    wheel w(1ms, t0);
+    std::vector<int> out;
+    w.advance(t0 + 100ms, out);
+
+    // Already expired: fires on the next advance
+    w.add(t0 + 50ms, 1);
+    BOOST_TEST(*w.next_expiry() == t0 + 100ms);
+    w.advance(t0 + 100ms, out);
+    BOOST_TEST((out == std::vector<int>{1}));
+}
+
+void test_cancel()
+{
+    wheel w(1ms, t0);
+    auto a = w.add(t0 + 10ms, 1);
+    auto b = w.add(t0 + 10s, 2);
+    w.add(t0 + 10ms, 3);
+
+    bool was_pending = w.cancel(a);
+    BOOST_TEST(was_pending);
+    was_pending = w.cancel(a);
+    BOOST_TEST(!was_pending);
+    was_pending = w.cancel(b);
+    BOOST_TEST(was_pending);
+    BOOST_TEST(w.size() == 1);
+
+    std::vector<int> out;
+    w.advance(t0 + 1h, out);
+    BOOST_TEST((out == std::vector<int>{3}));
+
+    // A handle to a fired timer is stale, even once its
+    // storage is reused
+    auto c = w.add(t0 + 2h, 4);
+    auto d = w.add(t0 + 2h, 5);
+    was_pending = w.cancel(a);
+    BOOST_TEST(!was_pending);
+    was_pending = w.cancel(b);
+    BOOST_TEST(!was_pending);
+    was_pending = w.cancel(d);
+    BOOST_TEST(was_pending);
+    was_pending = w.cancel(c);
+    BOOST_TEST(was_pending);
+}
+
+void test_long_timers()
+{
+    wheel w(1ms, t0);
+
+    // Beyond the top level (64^4 ms is about 4.7 hours)
+    w.add(t0 + 24h, 2);
+    w.add(t0 + 5min, 1);
+
+    std::vector<int> out;
+    w.advance(t0 + 5min - 1ms, out);
+    BOOST_TEST(out.empty());
+    w.advance(t0 + 5min, out);
+    BOOST_TEST((out == std::vector<int>{1}));
+    w.advance(t0 + 24h - 1ms, out);
+    BOOST_TEST(out.size() == 1);
+    w.advance(t0 + 24h, out);
+    BOOST_TEST((out == std::vector<int>{1, 2}));
+
+    // Late in a turn of the top level, due early in the next
+    out.clear();
+    wheel w2(1ms, t0);
+    w2.advance(t0 + 4h, out);
+    w2.add(t0 + 5h, 3);
+    w2.advance(t0 + 5h - 1ms, out);
+    BOOST_TEST(out.empty());
+    w2.advance(t0 + 5h, out);
+    BOOST_TEST((out == std::vector<int>{3}));
+}
+
+void test_next_expiry_bound()
+{
+    wheel w(1ms, t0);
+    w.add(t0 + 1s, 1);
+
+    // Never later than the timer
+    std::vector<int> out;
+    auto now = t0;
+    int steps = 0;
+    while(out.empty())
+    {
+        auto next = *w.next_expiry();
+        BOOST_TEST(next <= t0 + 1s);
+        BOOST_TEST(next > now);
+        now = next;
+        w.advance(now, out);
+        ++steps;
+    }
+    BOOST_TEST(now == t0 + 1s);
+    BOOST_TEST(steps <= 4);
+}
+
+void test_random()
+{
+    // Compare with an ordered map
+    std::mt19937 rng(42);
+    wheel w(1ms, t0);
+    std::multimap<wheel::time_point, int> ref;
+    std::vector<std::pair<wheel::handle, int>> handles;
+    std::map<int, wheel::time_point> when;
+
+    auto now = t0;
+    int id = 0;
+    for(int step = 0; step < 2000; ++step)
+    {
+        auto op = rng() % 10;
+        if(op < 6)
+        {
+            // Spread across every level
+            std::uint64_t const spans[] = {
+                50, 3000, 200000, 20000000, 100000000};
+            auto d = std::chrono::milliseconds(
+                rng() % spans[rng() % 5]);
+            auto t = now + d;
+            handles.emplace_back(w.add(t, id), id);
+            ref.emplace(t, id);
+            when[id] = t;
+            ++id;
+        }
+        else if(op < 7 && !handles.empty())
+        {
+            auto k = rng() % handles.size();
+            auto [h, v] = handles[k];
+            bool const pending = when.count(v) != 0;
+            bool const was_pending = w.cancel(h);
+            BOOST_TEST(was_pending == pending);
+            if(pending)
+            {
+                auto range = ref.equal_range(when[v]);
+                for(auto it = range.first; it != range.second; ++it)
+                {
+                    if(it->second == v)
+                    {
+                        ref.erase(it);
+                        break;
+                    }
+                }
+                when.erase(v);
+            }
+        }
+        else
+        {
+            now += std::chrono::milliseconds(rng() % 5000000);
+            std::vector<int> out;
+            w.advance(now, out);
+            std::vector<int> expect;
+            while(!ref.empty() && ref.begin()->first <= now)
+            {
+                expect.push_back(ref.begin()->second);
+                when.erase(ref.begin()->second);
+                ref.erase(ref.begin());
+            }
+            std::sort(out.begin(), out.end());
+            std::sort(expect.begin(), expect.end());
+            BOOST_TEST(out == expect);
+        }
+        BOOST_TEST(w.size() == ref.size());
+    }
+}
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_empty();
+    test_fires_in_order();
+    test_never_early();
+    test_overdue();
+    test_cancel();
+    test_long_timers();
+    test_next_expiry_bound();
+    test_random();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,135 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/token_bucket.hpp"
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using detail::token_bucket;
+using namespace std::chrono_literals;
+
+token_bucket::time_point const t0{std::chrono::seconds(1000)};
+
+void test_unlimited()
+{
+    token_bucket b;
+    BOOST_TEST(b.unlimited());
+    auto const t = b.reserve(1000000, t0);
+    BOOST_TEST(t == t0);
+    BOOST_TEST(b.quantum(65536) == 65536);
+}
+
+void test_burst_then_wait()
+{
+    // 1000 tokens per second, burst of 1000
+    token_bucket b(1000, 1s);
+    BOOST_TEST(!b.unlimited());
+
+    // The full burst is available immediately
+    auto t = b.reserve(1000, t0);
+    BOOST_TEST(t == t0);
+
+    // The next 500 tokens take half a second
+    t = b.reserve(500, t0);
+    BOOST_TEST(t == t0 + 500ms);
+
+    // Debt accumulates for the next caller
+    t = b.reserve(500, t0);
+    BOOST_TEST(t == t0 + 1000ms);
+}
+
+void test_refill()
+{
+    token_bucket b(1000, 1s);
+    auto t = b.reserve(1000, t0);
+    BOOST_TEST(t == t0);
+
+    // After a second the bucket is full again
+    t = b.reserve(1000, t0 + 1s);
+    BOOST_TEST(t == t0 + 1s);
+}
+
+void test_granularity()
+{
+    // Short waits are rounded down to zero
+    token_bucket b(1000, 1s, 1);
+    auto t = b.reserve(1, t0);
+    BOOST_TEST(t == t0);
+    t = b.reserve(5, t0);
+    BOOST_TEST(t == t0);
+
+    // Past the granularity a real wait is returned
+    t = b.reserve(20, t0);
+    BOOST_TEST(t > t0);
+}
+
+void test_peek()
+{
+    token_bucket b(1000, 1s);
+    BOOST_TEST(b.peek(1000, t0) == t0);
+    BOOST_TEST(b.peek(1500, t0) == t0 + 500ms);
+
+    // peek does not charge the bucket
+    auto const t = b.reserve(1000, t0);
+    BOOST_TEST(t == t0);
+}
+
+void test_quantum()
+{
+    // 10ms worth of 100000 bytes/sec is 1000 bytes
+    token_bucket b(100000, 1s);
+    BOOST_TEST(b.quantum(65536) == 1000);
+
+    // Never larger than the buffer
+    token_bucket fast(1000000000, 1s);
+    BOOST_TEST(fast.quantum(65536) == 65536);
+
+    // Never zero
+    token_bucket slow(1, 1s);
+    BOOST_TEST(slow.quantum(65536) == 1);
+}
+
+void test_reserve_both()
+{
+    token_bucket a(1000, 1s);
+    token_bucket b(100, 1s);
+
+    // The tighter bucket decides
+    auto t = detail::reserve_both(&a, &b, 200, t0);
+    BOOST_TEST(t == t0 + 1s);
+
+    // Null buckets are ignored
+    t = detail::reserve_both(nullptr, nullptr, 200, t0);
+    BOOST_TEST(t == t0);
+}
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_unlimited();
+    test_burst_then_wait();
+    test_refill();
+    test_granularity();
+    test_peek();
+    test_quantum();
+    test_reserve_both();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,140 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/ttl_cache.hpp"
+
+#include <string>
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using cache = detail::ttl_cache<std::string, int>;
+using namespace std::chrono_literals;
+
+cache::time_point const t0{std::chrono::seconds(1000)};
+
+void test_find()
+{
+    cache c;
+    auto found = c.find("a", t0);
+    BOOST_TEST(!found);
+
+    c.put("a", 1, t0 + 10s);
+    c.put("b", 2, t0 + 20s);
+    found = c.find("a", t0);
+    BOOST_TEST(*found == 1);
+    found = c.find("b", t0 + 15s);
+    BOOST_TEST(*found == 2);
+    BOOST_TEST(c.size() == 2);
+
+    // Replacing updates the value and expiry
+    c.put("a", 3, t0 + 30s);
+    found = c.find("a", t0 + 25s);
+    BOOST_TEST(*found == 3);
+    BOOST_TEST(c.size() == 2);
+}
+
+void test_expiry()
+{
+    cache c;
+    c.put("a", 1, t0 + 10s);
+    auto found = c.find("a", t0 + 9s);
+    BOOST_TEST(found);
+    found = c.find("a", t0 + 10s);
+    BOOST_TEST(!found);
+
+    // Expired entries are removed when found
+    BOOST_TEST(c.size() == 0);
+
+    c.put("a", 1, t0 + 10s);
+    c.put("b", 2, t0 + 20s);
+    c.prune(t0 + 15s);
+    BOOST_TEST(c.size() == 1);
+    found = c.find("b", t0 + 15s);
+    BOOST_TEST(found);
+}
+
+void test_capacity()
+{
+    cache c(2);
+    c.put("a", 1, t0 + 1h);
+    c.put("b", 2, t0 + 1h);
+
+    // Using "a" makes "b" the least recently used
+    auto found = c.find("a", t0);
+    BOOST_TEST(found);
+    c.put("c", 3, t0 + 1h);
+    BOOST_TEST(c.size() == 2);
+    found = c.find("a", t0);
+    BOOST_TEST(found);
+    found = c.find("b", t0);
+    BOOST_TEST(!found);
+    found = c.find("c", t0);
+    BOOST_TEST(found);
+}
+
+void test_for_each()
+{
+    cache c;
+    c.put("a", 1, t0 + 10s);
+    c.put("b", 2, t0 + 20s);
+    c.put("c", 3, t0 + 30s);
+    auto found = c.find("a", t0);
+    BOOST_TEST(found);
+
+    // Least recently used first, expired left out
+    std::string keys;
+    int sum = 0;
+    c.for_each(t0 + 15s,
+        [&](std::string const& k, int v, cache::time_point)
+        {
+            keys += k;
+            sum += v;
+        });
+    BOOST_TEST(keys == "bc");
+    BOOST_TEST(sum == 5);
+}
+
+void test_erase()
+{
+    cache c;
+    c.put("a", 1, t0 + 1h);
+    bool erased = c.erase("a");
+    BOOST_TEST(erased);
+    erased = c.erase("a");
+    BOOST_TEST(!erased);
+    auto found = c.find("a", t0);
+    BOOST_TEST(!found);
+
+    c.put("b", 2, t0 + 1h);
+    c.clear();
+    BOOST_TEST(c.size() == 0);
+}
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_find();
+    test_expiry();
+    test_capacity();
+    test_for_each();
+    test_erase();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,134 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/wait_queue.hpp"
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using queue_type = detail::wait_queue<int>;
+using namespace std::chrono_literals;
+
+queue_type::time_point const t0{std::chrono::seconds(1000)};
+
+void test_empty()
+{
+    queue_type q;
+    BOOST_TEST(q.empty());
+    BOOST_TEST(!q.earliest().has_value());
+
+    std::vector<int> out;
+    q.pop_due(t0, out);
+    BOOST_TEST(out.empty());
+}
+
+void test_earliest()
+{
+    queue_type q;
+
+    // The first waiter always needs the timer armed
+    bool rearm = q.push(t0 + 2s, 1);
+    BOOST_TEST(rearm);
+
+    // An earlier waiter needs it re-armed
+    rearm = q.push(t0 + 1s, 2);
+    BOOST_TEST(rearm);
+
+    // A later one does not
+    rearm = q.push(t0 + 3s, 3);
+    BOOST_TEST(!rearm);
+
+    BOOST_TEST(q.size() == 3);
+    BOOST_TEST(q.earliest() == t0 + 1s);
+}
+
+void test_pop_due()
+{
+    queue_type q;
+    q.push(t0 + 2s, 1);
+    q.push(t0 + 1s, 2);
+    q.push(t0 + 3s, 3);
+
+    std::vector<int> out;
+    q.pop_due(t0 + 2s, out);
+    BOOST_TEST(out.size() == 2);
+    BOOST_TEST(out[0] == 2);
+    BOOST_TEST(out[1] == 1);
+    BOOST_TEST(q.earliest() == t0 + 3s);
+}
+
+void test_fifo_ties()
+{
+    queue_type q;
+    q.push(t0, 1);
+    q.push(t0, 2);
+    q.push(t0, 3);
+
+    std::vector<int> out;
+    q.pop_due(t0, out);
+    BOOST_TEST((out == std::vector<int>{1, 2, 3}));
+}
+
+void test_cancel()
+{
+    queue_type q;
+    q.push(t0 + 1s, 1);
+    q.push(t0 + 2s, 2);
+    q.push(t0 + 3s, 3);
+
+    // A waiter is removed wherever it is in the queue
+    bool removed = q.cancel(2);
+    BOOST_TEST(removed);
+    removed = q.cancel(2);
+    BOOST_TEST(!removed);
+    removed = q.cancel(1);
+    BOOST_TEST(removed);
+    BOOST_TEST(q.size() == 1);
+    BOOST_TEST(q.earliest() == t0 + 3s);
+
+    std::vector<int> out;
+    q.pop_due(t0 + 3s, out);
+    BOOST_TEST((out == std::vector<int>{3}));
+    BOOST_TEST(q.empty());
+}
+
+void test_pop_all()
+{
+    queue_type q;
+    q.push(t0 + 1h, 1);
+    q.push(t0 + 1s, 2);
+
+    std::vector<int> out;
+    q.pop_all(out);
+    BOOST_TEST(out.size() == 2);
+    BOOST_TEST(q.empty());
+}
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_empty();
+    test_earliest();
+    test_pop_due();
+    test_fifo_ties();
+    test_cancel();
+    test_pop_all();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,186 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/warm_state.hpp"
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using detail::warm_state;
+using namespace std::chrono_literals;
+
+warm_state::time_point const t0{std::chrono::seconds(1700000000)};
+
+warm_state
+make_state()
+{
+    warm_state ws;
+    ws.dns.push_back({"example.com", {"93.184.216.34", "2606:2800::1"},
+        t0 + 300s});
+    ws.dns.push_back({"empty.example", {}, t0});
+    ws.tls_sessions.push_back({"example.com", 443, "1:0", t0 + 2h,
+        std::string("\x30\x82\x00\x00\xff", 5)});
+
+    cookie c;
+    c.name = "sid";
+    c.value = "abc";
+    c.domain = "example.com";
+    c.expires = t0 + 24h;
+    c.secure = true;
+    c.same_site = cookie::same_site_t::strict;
+    ws.cookies.push_back(c);
+
+    cookie s;
+    s.name = "session";
+    s.value = "";
+    s.domain = "api.example.com";
+    s.path = "/v1";
+    s.http_only = true;
+    ws.cookies.push_back(s);
+
+    ws.origins.push_back({"example.com", 443, true, 1});
+    return ws;
+}
+
+void test_round_trip()
+{
+    auto const ws = make_state();
+    auto const data = detail::encode_warm_state(ws);
+
+    warm_state r;
+    auto ec = detail::decode_warm_state(data, r);
+    BOOST_TEST(!ec);
+
+    BOOST_TEST(r.dns.size() == 2);
+    BOOST_TEST(r.dns[0].host == "example.com");
+    BOOST_TEST(r.dns[0].addresses == ws.dns[0].addresses);
+    BOOST_TEST(r.dns[0].expires == t0 + 300s);
+    BOOST_TEST(r.dns[1].addresses.empty());
+
+    BOOST_TEST(r.tls_sessions.size() == 1);
+    BOOST_TEST(r.tls_sessions[0].port == 443);
+    BOOST_TEST(r.tls_sessions[0].settings == "1:0");
+    BOOST_TEST(r.tls_sessions[0].session == ws.tls_sessions[0].session);
+    BOOST_TEST(r.tls_sessions[0].expires == t0 + 2h);
+
+    BOOST_TEST(r.cookies.size() == 2);
+    BOOST_TEST(r.cookies[0].name == "sid");
+    BOOST_TEST(r.cookies[0].expires == t0 + 24h);
+    BOOST_TEST(r.cookies[0].secure);
+    BOOST_TEST(!r.cookies[0].http_only);
+    BOOST_TEST(r.cookies[0].same_site == cookie::same_site_t::strict);
+    BOOST_TEST(!r.cookies[1].expires);
+    BOOST_TEST(r.cookies[1].path == "/v1");
+    BOOST_TEST(r.cookies[1].http_only);
+
+    BOOST_TEST(r.origins.size() == 1);
+    BOOST_TEST(r.origins[0].https);
+    BOOST_TEST(r.origins[0].flags == 1);
+}
+
+void test_empty()
+{
+    auto const data = detail::encode_warm_state({});
+    warm_state r;
+    auto const ec = detail::decode_warm_state(data, r);
+    BOOST_TEST(!ec);
+    BOOST_TEST(r.dns.empty() && r.cookies.empty());
+}
+
+void test_damaged()
+{
+    auto const data = detail::encode_warm_state(make_state());
+    warm_state r;
+
+    // Not warm state at all
+    auto ec = detail::decode_warm_state("", r);
+    BOOST_TEST(ec);
+    ec = detail::decode_warm_state("# Netscape HTTP Cookie File", r);
+    BOOST_TEST(ec);
+
+    // A cut inside a section is detected
+    std::size_t const first = 10 + static_cast<unsigned char>(data[9]);
+    for(std::size_t n = 9; n < first; ++n)
+    {
+        ec = detail::decode_warm_state(
+            std::string_view(data).substr(0, n), r);
+        BOOST_TEST(ec);
+    }
+    for(std::size_t n = data.size() - 5; n < data.size(); ++n)
+    {
+        ec = detail::decode_warm_state(
+            std::string_view(data).substr(0, n), r);
+        BOOST_TEST(ec);
+    }
+
+    // Another version
+    auto other = data;
+    other[7] = static_cast<char>(data[7] + 1);
+    ec = detail::decode_warm_state(other, r);
+    BOOST_TEST(ec);
+    other[7] = static_cast<char>(data[7] - 1);
+    ec = detail::decode_warm_state(other, r);
+    BOOST_TEST(ec);
+}
+
+void test_time_out_of_range()
+{
+    // A DNS section whose one entry expires at 2^63 seconds,
+    // which no clock can hold
+    std::string body;
+    detail::warm_format::put_uint(body, 1);
+    detail::warm_format::put_string(body, "example.com");
+    detail::warm_format::put_uint(body, std::uint64_t(1) << 63);
+    detail::warm_format::put_uint(body, 0);
+
+    std::string data(detail::warm_format::magic);
+    data.push_back(char(detail::warm_format::tag_dns));
+    detail::warm_format::put_uint(data, body.size());
+    data += body;
+
+    warm_state r;
+    auto const ec = detail::decode_warm_state(data, r);
+    BOOST_TEST(ec);
+}
+
+void test_unknown_section()
+{
+    // A later version may add sections
+    auto data = detail::encode_warm_state(make_state());
+    data.push_back(char(99));
+    data.push_back(char(3));
+    data.append("xyz");
+
+    warm_state r;
+    auto const ec = detail::decode_warm_state(data, r);
+    BOOST_TEST(!ec);
+    BOOST_TEST(r.cookies.size() == 2);
+}
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_round_trip();
+    test_empty();
+    test_damaged();
+    test_time_out_of_range();
+    test_unknown_section();
+
+    return boost::report_errors();
+}
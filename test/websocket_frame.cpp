@@ -0,0 +1,265 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/websocket_frame.hpp"
+
+#include <string>
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using namespace detail;
+
+unsigned char const* bytes(std::string const& s)
+{
+    return reinterpret_cast<unsigned char const*>(s.data());
+}
+
+void test_header_round_trip()
+{
+    for(std::uint64_t len : {0ull, 125ull, 126ull, 65535ull, 65536ull, 1ull << 40})
+    {
+        frame_header h;
+        h.op = ws_opcode::binary;
+        h.fin = false;
+        h.rsv1 = true;
+        h.masked = true;
+        h.length = len;
+        h.key = {1, 2, 3, 4};
+
+        unsigned char buf[max_frame_header];
+        auto const n = write_frame_header(h, buf);
+        BOOST_TEST(n == 2 + 4 + (len < 126 ? 0 : len <= 0xffff ? 2 : 8));
+
+        frame_header h2;
+        std::size_t used = 0;
+        auto st = parse_frame_header(buf, n, h2, used);
+        BOOST_TEST(st == header_status::ok);
+        BOOST_TEST(used == n);
+        BOOST_TEST(h2.op == ws_opcode::binary);
+        BOOST_TEST(!h2.fin && h2.rsv1 && h2.masked);
+        BOOST_TEST(h2.length == len);
+        BOOST_TEST(h2.key == h.key);
+
+        // A partial header needs more bytes
+        st = parse_frame_header(buf, n - 1, h2, used);
+        BOOST_TEST(st == header_status::need_more);
+    }
+}
+
+void test_header_invalid()
+{
+    auto parse = [](std::string const& s)
+    {
+        frame_header h;
+        std::size_t used;
+        return parse_frame_header(bytes(s), s.size(), h, used);
+    };
+
+    // RSV2, reserved opcode
+    BOOST_TEST(parse(std::string("\xa1\x00", 2)) == header_status::bad);
+    BOOST_TEST(parse(std::string("\x83\x00", 2)) == header_status::bad);
+
+    // Fragmented or oversized control frames
+    BOOST_TEST(parse(std::string("\x09\x00", 2)) == header_status::bad);
+    BOOST_TEST(parse(std::string("\x89\x7e\x00\x7e", 4)) == header_status::bad);
+    BOOST_TEST(parse(std::string("\x89\x7d", 2)) == header_status::ok);
+
+    // Lengths not in their shortest form
+    BOOST_TEST(parse(std::string("\x82\x7e\x00\x10", 4)) == header_status::bad);
+    BOOST_TEST(parse(std::string(
+        "\x82\x7f\x00\x00\x00\x00\x00\x00\xff\xff", 10)) ==
+            header_status::bad);
+    BOOST_TEST(parse(std::string(
+        "\x82\x7f\x80\x00\x00\x00\x00\x00\x00\x00", 10)) ==
+            header_status::bad);
+}
+
+void test_mask()
+{
+    // RFC 6455 section 5.7: "Hello" masked
+    std::string s = "Hello";
+    std::array<unsigned char, 4> const key = {0x37, 0xfa, 0x21, 0x3d};
+    mask_bytes(reinterpret_cast<unsigned char*>(s.data()), s.size(), key);
+    BOOST_TEST(s == "\x7f\x9f\x4d\x51\x58");
+
+    // Word-at-a-time and in pieces give the bytewise result
+    std::string big(1000, '\0');
+    for(std::size_t i = 0; i < big.size(); ++i)
+        big[i] = static_cast<char>(i * 7);
+    std::string expect = big;
+    for(std::size_t i = 0; i < expect.size(); ++i)
+        expect[i] = static_cast<char>(expect[i] ^ key[i % 4]);
+
+    auto* p = reinterpret_cast<unsigned char*>(big.data());
+    std::string whole = big;
+    mask_bytes(reinterpret_cast<unsigned char*>(whole.data()), whole.size(), key);
+    BOOST_TEST(whole == expect);
+
+    mask_bytes(p, 3, key, 0);
+    mask_bytes(p + 3, 500, key, 3);
+    mask_bytes(p + 503, 497, key, 503);
+    BOOST_TEST(big == expect);
+}
+
+void test_sequence()
+{
+    auto frame = [](ws_opcode op, bool fin, bool rsv1 = false)
+    {
+        frame_header h;
+        h.op = op;
+        h.fin = fin;
+        h.rsv1 = rsv1;
+        return h;
+    };
+
+    frame_sequence seq;
+    bool ok = seq.on_header(frame(ws_opcode::text, false));
+    BOOST_TEST(ok);
+    ok = seq.on_header(frame(ws_opcode::ping, true));
+    BOOST_TEST(ok);
+    ok = seq.on_header(frame(ws_opcode::binary, true));
+    BOOST_TEST(!ok);
+    ok = seq.on_header(frame(ws_opcode::continuation, true));
+    BOOST_TEST(ok);
+    BOOST_TEST(seq.message_op() == ws_opcode::text);
+    ok = seq.on_header(frame(ws_opcode::continuation, true));
+    BOOST_TEST(!ok);
+
+    // RSV1 needs permessage-deflate, and only on the first frame
+    ok = seq.on_header(frame(ws_opcode::text, true, true));
+    BOOST_TEST(!ok);
+    frame_sequence seq2(true);
+    ok = seq2.on_header(frame(ws_opcode::text, false, true));
+    BOOST_TEST(ok);
+    BOOST_TEST(seq2.compressed());
+    ok = seq2.on_header(frame(ws_opcode::continuation, true, true));
+    BOOST_TEST(!ok);
+
+    // Servers must not mask
+    auto masked = frame(ws_opcode::text, true);
+    masked.masked = true;
+    frame_sequence seq3;
+    ok = seq3.on_header(masked);
+    BOOST_TEST(!ok);
+}
+
+void test_fragmenter()
+{
+    fragmenter f(ws_opcode::binary, true, 10, 4);
+    std::array<unsigned char, 4> const key = {9, 9, 9, 9};
+    auto h = f.next(key);
+    BOOST_TEST(h.op == ws_opcode::binary && h.rsv1 && !h.fin && h.length == 4);
+    BOOST_TEST(h.masked && h.key == key);
+    h = f.next(key);
+    BOOST_TEST(h.op == ws_opcode::continuation && !h.rsv1 && !h.fin);
+    h = f.next(key);
+    BOOST_TEST(h.fin && h.length == 2);
+    BOOST_TEST(f.done());
+
+    // Without a limit, and for an empty message, one frame
+    fragmenter one(ws_opcode::text, false, 10, 0);
+    h = one.next(key);
+    BOOST_TEST(h.fin);
+    fragmenter empty(ws_opcode::text, false, 0, 4);
+    h = empty.next(key);
+    BOOST_TEST(h.fin && h.length == 0);
+}
+
+void test_utf8()
+{
+    auto valid = [](std::string const& s)
+    {
+        utf8_validator v;
+        return v.write(bytes(s), s.size()) && v.finish();
+    };
+    BOOST_TEST(valid(""));
+    BOOST_TEST(valid("plain ASCII text, long enough for words"));
+    BOOST_TEST(valid("\xce\xba\xe1\xbd\xb9\xcf\x83\xce\xbc\xce\xb5"));
+    BOOST_TEST(valid("\xf0\x9f\x98\x80"));
+    BOOST_TEST(valid("\xf4\x8f\xbf\xbf"));
+
+    BOOST_TEST(!valid("\xc0\xaf"));
+    BOOST_TEST(!valid("\xe0\x80\xaf"));
+    BOOST_TEST(!valid("\xed\xa0\x80"));
+    BOOST_TEST(!valid("\xf4\x90\x80\x80"));
+    BOOST_TEST(!valid("\xff"));
+    BOOST_TEST(!valid("abc\x80"));
+
+    // Code points may be split across frames
+    utf8_validator v;
+    std::string const s = "\xf0\x9f\x98\x80";
+    bool ok = v.write(bytes(s), 2);
+    BOOST_TEST(ok);
+    BOOST_TEST(!v.finish());
+    ok = v.write(bytes(s) + 2, 2);
+    BOOST_TEST(ok);
+    BOOST_TEST(v.finish());
+}
+
+void test_close()
+{
+    std::uint16_t code;
+    std::string reason;
+    bool ok = parse_close_payload(nullptr, 0, code, reason);
+    BOOST_TEST(ok);
+    BOOST_TEST(code == close_no_status);
+
+    auto const p = make_close_payload(1001, "going away");
+    ok = parse_close_payload(bytes(p), p.size(), code, reason);
+    BOOST_TEST(ok);
+    BOOST_TEST(code == 1001 && reason == "going away");
+
+    std::string const one = "\x03";
+    ok = parse_close_payload(bytes(one), 1, code, reason);
+    BOOST_TEST(!ok);
+    auto const reserved = make_close_payload(1005, "");
+    ok = parse_close_payload(bytes(reserved), 2, code, reason);
+    BOOST_TEST(!ok);
+    auto const bad_utf8 = make_close_payload(1000, "\xc0");
+    ok = parse_close_payload(bytes(bad_utf8), 3, code, reason);
+    BOOST_TEST(!ok);
+
+    BOOST_TEST(valid_close_code(1000));
+    BOOST_TEST(valid_close_code(4999));
+    BOOST_TEST(!valid_close_code(1006));
+    BOOST_TEST(!valid_close_code(2000));
+
+    // Long reasons are cut to fit, on a code point boundary
+    std::string long_reason(122, 'a');
+    long_reason += "\xe2\x82\xac";
+    auto const cut = make_close_payload(1000, long_reason);
+    BOOST_TEST(cut.size() == 124);
+    ok = parse_close_payload(bytes(cut), cut.size(), code, reason);
+    BOOST_TEST(ok);
+}
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_header_round_trip();
+    test_header_invalid();
+    test_mask();
+    test_sequence();
+    test_fragmenter();
+    test_utf8();
+    test_close();
+
+    return boost::report_errors();
+}
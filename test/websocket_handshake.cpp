@@ -0,0 +1,145 @@
+//
+// Copyright (c) 2025 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/burl
+//
+
+#include <boost/core/lightweight_test.hpp>
+
+#include "src/detail/websocket_handshake.hpp"
+#include "src/detail/websocket_deflate.hpp"
+
+#include <string>
+
+namespace boost {
+namespace burl {
+
+namespace {
+
+using namespace detail;
+
+void test_accept()
+{
+    // RFC 6455 section 1.3
+    BOOST_TEST(websocket_accept("dGhlIHNhbXBsZSBub25jZQ==") ==
+        "s3pPLMBiTxaQ9kYGzzhZRbK+xOo=");
+}
+
+void test_deflate_response()
+{
+    bool enabled;
+    deflate_params p;
+
+    BOOST_TEST(parse_deflate_response("", enabled, p));
+    BOOST_TEST(!enabled);
+
+    BOOST_TEST(parse_deflate_response("permessage-deflate", enabled, p));
+    BOOST_TEST(enabled);
+    BOOST_TEST(!p.server_no_context_takeover);
+    BOOST_TEST(p.client_max_window_bits == 15);
+
+    BOOST_TEST(parse_deflate_response(
+        "permessage-deflate; server_no_context_takeover; "
+        "client_no_context_takeover; server_max_window_bits=10; "
+        "client_max_window_bits=\"12\"",
+        enabled, p));
+    BOOST_TEST(p.server_no_context_takeover);
+    BOOST_TEST(p.client_no_context_takeover);
+    BOOST_TEST(p.server_max_window_bits == 10);
+    BOOST_TEST(p.client_max_window_bits == 12);
+
+    // Only what was offered may be accepted
+    BOOST_TEST(!parse_deflate_response("x-webkit-deflate-frame", enabled, p));
+    BOOST_TEST(!parse_deflate_response(
+        "permessage-deflate, permessage-deflate", enabled, p));
+    BOOST_TEST(!parse_deflate_response(
+        "permessage-deflate; foo", enabled, p));
+    BOOST_TEST(!parse_deflate_response(
+        "permessage-deflate; server_max_window_bits=16", enabled, p));
+    BOOST_TEST(!parse_deflate_response(
+        "permessage-deflate; client_max_window_bits=8", enabled, p));
+    BOOST_TEST(!parse_deflate_response(
+        "permessage-deflate; server_no_context_takeover; "
+        "server_no_context_takeover", enabled, p));
+    BOOST_TEST(!parse_deflate_response(
+        "permessage-deflate; server_no_context_takeover=1", enabled, p));
+}
+
+#ifdef BOOST_BURL_HAS_ZLIB
+
+void test_deflate()
+{
+    // RFC 7692 section 7.2.3.1: "Hello" compressed
+    deflate_params p;
+    permessage_deflate d(p);
+    BOOST_TEST(d.valid());
+    std::string out;
+    bool ok = d.decompress(
+        std::string_view("\xf2\x48\xcd\xc9\xc9\x07\x00", 7), out, 100);
+    BOOST_TEST(ok);
+    BOOST_TEST(out == "Hello");
+
+    // zlib refusing to start leaves it unusable, not broken
+    deflate_params bad_params;
+    bad_params.client_max_window_bits = 20;
+    permessage_deflate bad(bad_params);
+    BOOST_TEST(!bad.valid());
+    std::string ignored;
+    ok = bad.compress("x", ignored);
+    BOOST_TEST(!ok);
+
+    // Messages round trip, sharing the window
+    permessage_deflate a(p), b(p);
+    std::string const msg(2000, 'x');
+    std::string c1, c2;
+    ok = a.compress(msg, c1);
+    BOOST_TEST(ok);
+    ok = a.compress(msg, c2);
+    BOOST_TEST(ok);
+    BOOST_TEST(c2.size() < c1.size());
+    std::string m1, m2;
+    ok = b.decompress(c1, m1, 4096);
+    BOOST_TEST(ok);
+    ok = b.decompress(c2, m2, 4096);
+    BOOST_TEST(ok);
+    BOOST_TEST(m1 == msg && m2 == msg);
+
+    // Limits apply to the decompressed size
+    permessage_deflate e(p);
+    std::string big;
+    ok = e.decompress(c1, big, 1999);
+    BOOST_TEST(!ok);
+    permessage_deflate f(p);
+    big.clear();
+    ok = f.decompress(c1, big, 2000);
+    BOOST_TEST(ok);
+
+    // Garbage is refused
+    permessage_deflate g(p);
+    std::string junk;
+    ok = g.decompress(std::string_view("\xff\xff\xff\xff", 4), junk, 100);
+    BOOST_TEST(!ok);
+}
+
+#endif
+
+} // namespace
+
+} // namespace burl
+} // namespace boost
+
+int main()
+{
+    using namespace boost::burl;
+
+    test_accept();
+    test_deflate_response();
+#ifdef BOOST_BURL_HAS_ZLIB
+    test_deflate();
+#endif
+
+    return boost::report_errors();
+}